@@ -0,0 +1,60 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Animation.hpp>
+#include <vector>
+
+BENCHMARK_CASE("[Animation] Scheduler")
+{
+    const std::size_t iterations = 1000;
+    const std::size_t animationCount = 10000;
+
+    std::vector<float> opacities(animationCount);
+    std::vector<tgui::Vector2f> offsets(animationCount);
+    std::vector<tgui::Color> colors(animationCount);
+
+    // The animations last much longer than the measured frames, so the amount of running animations stays constant
+    tgui::AnimationScheduler scheduler;
+    for (std::size_t i = 0; i < animationCount; ++i)
+    {
+        scheduler.animate(0.f, 1.f, sf::seconds(1000), [&opacities,i](float value){ opacities[i] = value; }, tgui::Easing::EaseInOut);
+        scheduler.animate({0, 0}, {0, 500}, sf::seconds(1000), [&offsets,i](tgui::Vector2f value){ offsets[i] = value; }, tgui::Easing::CubicOut);
+        scheduler.animate({0, 0, 0}, {255, 255, 255}, sf::seconds(1000), [&colors,i](tgui::Color value){ colors[i] = value; });
+    }
+
+    bench::measure("frame with 30000 running animations", iterations, [&]{
+        scheduler.update(sf::milliseconds(1));
+    });
+    bench::doNotOptimize(opacities);
+
+    bench::measure("start and finish 1000 animations", iterations / 10, [&]{
+        tgui::AnimationScheduler shortLived;
+        for (std::size_t i = 0; i < 1000; ++i)
+            shortLived.animate(0.f, 1.f, sf::milliseconds(10), [&opacities,i](float value){ opacities[i] = value; });
+
+        shortLived.update(sf::milliseconds(10));
+    });
+}
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    struct Case
+    {
+        std::string name;
+        std::function<void()> function;
+    };
+
+    // Returns the list of all benchmark cases that were registered with BENCHMARK_CASE
+    std::vector<Case>& getCases();
+
+    // Helper to register a benchmark case before main is called
+    struct Registrar
+    {
+        Registrar(std::string name, std::function<void()> function)
+        {
+            getCases().push_back({std::move(name), std::move(function)});
+        }
+    };
+
+    // Amount of times that every measurement is repeated, the median of the repetitions is reported
+    std::size_t getRepetitions();
+
+    // Prints the result of a measurement and stores it for the JSON output
+    void report(const std::string& name, std::size_t iterations, const std::vector<double>& seconds);
+
+    // Storage for doNotOptimize on compilers without inline assembly, the volatile write can't be removed by the compiler
+    extern const void* volatile sink;
+
+    // Prevents the compiler from optimizing away a value that is computed in a benchmark
+    template <typename T>
+    void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        sink = static_cast<const void*>(&value);
+#endif
+    }
+
+    // Executes the function the given amount of times and reports the average time that a single iteration took.
+    // The function is executed once before measuring, so that lazily created resources don't influence the first repetition.
+    template <typename Func>
+    void measure(const std::string& name, std::size_t iterations, Func&& func)
+    {
+        func();
+
+        std::vector<double> seconds;
+        for (std::size_t repetition = 0; repetition < getRepetitions(); ++repetition)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+                func();
+            const auto end = std::chrono::steady_clock::now();
+
+            seconds.push_back(std::chrono::duration<double>(end - start).count());
+        }
+
+        report(name, iterations, seconds);
+    }
+}
+
+#define BENCHMARK_CASE_IMPL(name, id) \
+    static void id(); \
+    static bench::Registrar id##Registrar{name, &id}; \
+    static void id()
+
+#define BENCHMARK_CASE_ID(name, line) BENCHMARK_CASE_IMPL(name, benchmarkCase##line)
+#define BENCHMARK_CASE_LINE(name, line) BENCHMARK_CASE_ID(name, line)
+#define BENCHMARK_CASE(name) BENCHMARK_CASE_LINE(name, __LINE__)
+
+#endif // TGUI_BENCHMARK_HPP
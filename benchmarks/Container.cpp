@@ -0,0 +1,207 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/WidgetPrototype.hpp>
+#include <TGUI/to_string.hpp>
+
+BENCHMARK_CASE("[Container] Get")
+{
+    const std::size_t iterations = 100000;
+
+    auto group = tgui::Group::create();
+    auto innerGroup = tgui::Group::create();
+    group->add(innerGroup, "Inner");
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        group->add(tgui::ClickableWidget::create(), "Widget" + tgui::to_string(i));
+        innerGroup->add(tgui::ClickableWidget::create(), "InnerWidget" + tgui::to_string(i));
+    }
+
+    bench::measure("direct child out of 10000", iterations, [&]{
+        bench::doNotOptimize(group->get("Widget9999"));
+    });
+
+    bench::measure("path \"Inner.InnerWidget9999\"", iterations, [&]{
+        bench::doNotOptimize(group->get("Inner.InnerWidget9999"));
+    });
+
+    bench::measure("bind layout to sibling out of 10000", iterations, [&]{
+        tgui::Layout layout{"Widget9999.width"};
+        layout.connectWidget(group.get(), true, []{});
+        bench::doNotOptimize(layout);
+    });
+}
+
+BENCHMARK_CASE("[Container] Hit testing")
+{
+    const std::size_t iterations = 2000;
+
+    // A map of 100x100 tiles
+    auto group = tgui::Group::create({5000, 5000});
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        auto tile = tgui::ClickableWidget::create({50, 50});
+        tile->setPosition({(i % 100) * 50.f, (i / 100) * 50.f});
+        group->add(tile);
+    }
+
+    std::size_t frame = 0;
+    bench::measure("mouse move over 10000 widgets", iterations, [&]{
+        const float pos = static_cast<float>(++frame % 5000);
+        group->mouseMoved({pos, pos});
+    });
+
+    group->setSpatialIndexEnabled(true, 50);
+    bench::measure("mouse move over 10000 widgets with spatial index", iterations, [&]{
+        const float pos = static_cast<float>(++frame % 5000);
+        group->mouseMoved({pos, pos});
+    });
+}
+
+BENCHMARK_CASE("[Container] Update")
+{
+    const std::size_t iterations = 100000;
+
+    auto group = tgui::Group::create();
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        auto innerGroup = tgui::Group::create();
+        for (unsigned int j = 0; j < 200; ++j)
+            innerGroup->add(tgui::ClickableWidget::create());
+
+        group->add(innerGroup);
+    }
+
+    bench::measure("frame without animations, 20000 widgets", iterations, [&]{
+        group->update(sf::milliseconds(16));
+    });
+
+    auto animatedWidget = std::static_pointer_cast<tgui::Group>(group->getWidgets()[50])->getWidgets()[100];
+    animatedWidget->showWithEffect(tgui::ShowAnimationType::Fade, sf::seconds(1000));
+    bench::measure("frame with one animation, 20000 widgets", iterations, [&]{
+        group->update(sf::milliseconds(0));
+    });
+}
+
+BENCHMARK_CASE("[Container] Load hidden pages")
+{
+    const std::size_t iterations = 10;
+
+    // A form with 20 pages of 100 labels each, of which only the first page is visible
+    auto form = tgui::Group::create();
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        auto page = tgui::Panel::create();
+        page->setVisible(i == 0);
+        for (unsigned int j = 0; j < 100; ++j)
+            page->add(tgui::Label::create("Label " + tgui::to_string(j)), "Label" + tgui::to_string(j));
+
+        form->add(page, "Page" + tgui::to_string(i));
+    }
+
+    std::stringstream stream;
+    form->saveWidgetsToStream(stream);
+    const std::string file = stream.str();
+
+    bench::measure("load 20 pages", iterations, [&]{
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(std::stringstream{file});
+        bench::doNotOptimize(group);
+    });
+
+    bench::measure("load 20 pages lazily", iterations, [&]{
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(std::stringstream{file}, true);
+        bench::doNotOptimize(group);
+    });
+
+    bench::measure("load 20 pages lazily and show one", iterations, [&]{
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(std::stringstream{file}, true);
+        group->get("Page1")->setVisible(true);
+        bench::doNotOptimize(group);
+    });
+}
+
+BENCHMARK_CASE("[Container] Instantiate rows")
+{
+    const std::size_t iterations = 5;
+
+    const auto createRow = []{
+        auto row = tgui::Panel::create({400, 30});
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            auto label = tgui::Label::create("Label " + tgui::to_string(i));
+            label->setPosition({i * 60.f, 5.f});
+            row->add(label, "Label" + tgui::to_string(i));
+        }
+
+        row->add(tgui::Picture::create(), "Icon");
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            auto button = tgui::Button::create("Button");
+            button->setPosition({300 + i * 50.f, 0.f});
+            row->add(button, "Button" + tgui::to_string(i));
+        }
+
+        return row;
+    };
+
+    bench::measure("create 1000 rows", iterations, [&]{
+        auto list = tgui::Group::create();
+        list->reserveWidgets(1000);
+        for (unsigned int i = 0; i < 1000; ++i)
+            list->add(createRow());
+
+        bench::doNotOptimize(list);
+    });
+
+    const auto row = createRow();
+    bench::measure("copy 1000 rows", iterations, [&]{
+        auto list = tgui::Group::create();
+        list->reserveWidgets(1000);
+        for (unsigned int i = 0; i < 1000; ++i)
+            list->add(tgui::Panel::copy(row));
+
+        bench::doNotOptimize(list);
+    });
+
+    const auto prototype = tgui::WidgetPrototype::create(row);
+    bench::measure("instantiate 1000 rows from prototype", iterations, [&]{
+        auto list = tgui::Group::create();
+        list->reserveWidgets(1000);
+        for (auto& instance : prototype->instantiate(1000))
+            list->add(instance);
+
+        bench::doNotOptimize(list);
+    });
+}
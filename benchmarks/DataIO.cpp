@@ -0,0 +1,245 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Loading/DataDocument.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/ThreadPool.hpp>
+#include <TGUI/Texture.hpp>
+#include <TGUI/to_string.hpp>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    // Generates a form similar to the ones created by the gui builder, with about 2 MB of data
+    std::string generateForm()
+    {
+        std::string form = "Renderer.1 {\n    BackgroundColor = #F5F5F5;\n    BorderColor = Black;\n    Borders = (1, 1, 1, 1);\n}\n\n";
+        for (unsigned int i = 0; i < 4000; ++i)
+        {
+            const std::string id = tgui::to_string(i);
+            form += "Panel.\"Panel" + id + "\" {\n"
+                    "    Position = (" + tgui::to_string(i % 40 * 20) + ", " + tgui::to_string(i / 40 * 20) + ");\n"
+                    "    Size = (20, 20);\n"
+                    "    Renderer = &1;\n"
+                    "\n"
+                    "    Button.\"Button" + id + "\" {\n"
+                    "        Position = (2, 2);  // Relative to the panel\n"
+                    "        Size = (16, 16);\n"
+                    "        Text = \"Button " + id + "\";\n"
+                    "        TextSize = 13;\n"
+                    "\n"
+                    "        Renderer {\n"
+                    "            BackgroundColor = rgb(245, 245, 245);\n"
+                    "            BorderColor = #3C3C3C;\n"
+                    "            Borders = (1, 1, 1, 1);\n"
+                    "            TextColor = #3C3C3C;\n"
+                    "            TextureDown = \"Black.png\" Part(0, 64, 45, 50) Middle(10, 0, 25, 50);\n"
+                    "        }\n"
+                    "    }\n"
+                    "\n"
+                    "    ListBox.\"List" + id + "\" {\n"
+                    "        Items = [\"First item\", \"Second item\", \"Third item\"];\n"
+                    "        ItemHeight = 20;\n"
+                    "    }\n"
+                    "}\n\n";
+        }
+        return form;
+    }
+
+    // Only counts the properties, the values are thrown away while parsing
+    struct PropertyCounter : public tgui::DataIO::Visitor
+    {
+        void beginNode(const std::string&) override {}
+        void property(const std::string&, std::unique_ptr<tgui::DataIO::ValueNode>) override { ++count; }
+        void endNode() override {}
+
+        std::size_t count = 0;
+    };
+
+    std::size_t countValues(const tgui::DataIO::Node& node)
+    {
+        std::size_t count = 0;
+        for (const auto& pair : node.propertyValuePairs)
+            count += pair.second->value.getSize() + pair.second->valueList.size();
+
+        for (const auto& child : node.children)
+            count += countValues(*child);
+
+        return count;
+    }
+
+    std::size_t countValues(const tgui::DataDocument::Node& node)
+    {
+        std::size_t count = 0;
+        for (const auto* property = node.firstProperty; property; property = property->next)
+            count += property->getValue().getSize() + property->getListItems().size();
+
+        for (const auto* child = node.firstChild; child; child = child->nextSibling)
+            count += countValues(*child);
+
+        return count;
+    }
+}
+
+BENCHMARK_CASE("[DataIO] Parse large form")
+{
+    const std::size_t iterations = 10;
+    const std::string form = generateForm();
+
+    bench::measure("DataIO::parse, " + tgui::to_string(form.size() / 1024) + " KiB", iterations, [&]{
+        std::stringstream stream{form};
+        bench::doNotOptimize(tgui::DataIO::parse(stream));
+    });
+
+    bench::measure("DataDocument::parse, " + tgui::to_string(form.size() / 1024) + " KiB", iterations, [&]{
+        bench::doNotOptimize(tgui::DataDocument::parse(form.data(), form.size()));
+    });
+
+    bench::measure("DataIO::parse and read all values", iterations, [&]{
+        std::stringstream stream{form};
+        bench::doNotOptimize(countValues(*tgui::DataIO::parse(stream)));
+    });
+
+    bench::measure("DataDocument::parse and read all values", iterations, [&]{
+        bench::doNotOptimize(countValues(tgui::DataDocument::parse(form.data(), form.size())->getRoot()));
+    });
+}
+
+BENCHMARK_CASE("[DataIO] Stream large form")
+{
+    const std::size_t iterations = 10;
+    const std::string form = generateForm();
+
+    bench::measure("DataIO::parse into tree", iterations, [&]{
+        std::stringstream stream{form};
+        bench::doNotOptimize(tgui::DataIO::parse(stream));
+    });
+
+    bench::measure("DataIO::parse with visitor", iterations, [&]{
+        std::stringstream stream{form};
+        PropertyCounter counter;
+        tgui::DataIO::parse(stream, counter);
+        bench::doNotOptimize(counter.count);
+    });
+
+    std::stringstream stream{form};
+    const auto rootNode = tgui::DataIO::parse(stream);
+    bench::measure("DataIO::emit", iterations, [&]{
+        std::stringstream output;
+        tgui::DataIO::emit(rootNode, output);
+        bench::doNotOptimize(output);
+    });
+}
+
+BENCHMARK_CASE("[DataIO] Load and save widgets")
+{
+    const std::size_t iterations = 5;
+
+    auto group = tgui::Group::create();
+    for (unsigned int i = 0; i < 2000; ++i)
+    {
+        auto panel = tgui::Panel::create({20, 20});
+        panel->setPosition({(i % 40) * 20.f, (i / 40) * 20.f});
+        panel->add(tgui::Label::create("Label " + tgui::to_string(i)), "Label");
+        group->add(panel, "Panel" + tgui::to_string(i));
+    }
+
+    std::stringstream form;
+    group->saveWidgetsToStream(form);
+
+    bench::measure("save 4000 widgets", iterations, [&]{
+        std::stringstream output;
+        group->saveWidgetsToStream(output);
+        bench::doNotOptimize(output);
+    });
+
+    bench::measure("load 4000 widgets", iterations, [&]{
+        std::stringstream input{form.str()};
+        auto loadedGroup = tgui::Group::create();
+        loadedGroup->loadWidgetsFromStream(input);
+        bench::doNotOptimize(loadedGroup);
+    });
+
+    std::stringstream binaryForm;
+    group->saveWidgetsToBinaryStream(binaryForm);
+
+    bench::measure("save 4000 widgets in binary form (" + tgui::to_string(binaryForm.str().size() / 1024) + " KiB instead of "
+                   + tgui::to_string(form.str().size() / 1024) + " KiB)", iterations, [&]{
+        std::stringstream output;
+        group->saveWidgetsToBinaryStream(output);
+        bench::doNotOptimize(output);
+    });
+
+    bench::measure("load 4000 widgets from binary form", iterations, [&]{
+        std::stringstream input{binaryForm.str()};
+        auto loadedGroup = tgui::Group::create();
+        loadedGroup->loadWidgetsFromBinaryStream(input);
+        bench::doNotOptimize(loadedGroup);
+    });
+
+    bench::measure("snapshot and restore 4000 widgets", iterations, [&]{
+        auto copiedGroup = tgui::Group::create();
+        copiedGroup->restoreSnapshot(group->saveSnapshot());
+        bench::doNotOptimize(copiedGroup);
+    });
+}
+
+BENCHMARK_CASE("[DataIO] Preload textures")
+{
+    const std::size_t iterations = 5;
+
+    // Simulate an image format that takes a while to decode
+    const auto oldImageLoader = tgui::Texture::getImageLoader();
+    const auto slowImageLoader = [](const sf::String&){
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            auto image = std::make_unique<sf::Image>();
+            image->create(16, 16);
+            return image;
+        };
+    tgui::Texture::setImageLoader(slowImageLoader);
+
+    std::string form;
+    for (unsigned int i = 0; i < 64; ++i)
+        form += "Picture.Picture" + tgui::to_string(i) + " {\n    Renderer {\n        Texture = \"image" + tgui::to_string(i) + ".png\";\n    }\n}\n";
+
+    bench::measure("decode 64 images sequentially", iterations, [&]{
+        for (unsigned int i = 0; i < 64; ++i)
+            bench::doNotOptimize(slowImageLoader("image" + tgui::to_string(i) + ".png"));
+    });
+
+    // The speedup depends on the amount of threads in the default thread pool, which depends on the amount of cores
+    bench::measure("load 64 pictures (" + tgui::to_string(tgui::priv::ThreadPool::getDefault().getThreadCount()) + " decoding threads)", iterations, [&]{
+        std::stringstream input{form};
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(input);
+        bench::doNotOptimize(group);
+    });
+
+    tgui::Texture::setImageLoader(oldImageLoader);
+}
@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/to_string.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+    sf::Event createMouseEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        if (type == sf::Event::MouseMoved)
+        {
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+        }
+        else
+        {
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = x;
+            event.mouseButton.y = y;
+        }
+
+        return event;
+    }
+}
+
+BENCHMARK_CASE("[Gui] Handle events")
+{
+    // Every repetition moves the mouse along the same positions on the diagonal
+    const std::size_t iterations = 500;
+
+    sf::RenderTexture target;
+    target.create(5000, 5000);
+    tgui::Gui gui{target};
+
+    // 10000 buttons in a grid of 100x100
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        auto button = tgui::Button::create("Button");
+        button->setSize({50, 50});
+        button->setPosition({(i % 100) * 50.f, (i / 100) * 50.f});
+        gui.add(button);
+    }
+
+    std::size_t frame = 0;
+    bench::measure("mouse move over 10000 buttons", iterations, [&]{
+        const int pos = static_cast<int>((++frame % iterations) * 10);
+        gui.handleEvent(createMouseEvent(sf::Event::MouseMoved, pos, pos));
+    });
+
+    bench::measure("click on one of 10000 buttons", iterations, [&]{
+        const int pos = static_cast<int>((++frame % iterations) * 10);
+        gui.handleEvent(createMouseEvent(sf::Event::MouseButtonPressed, pos, pos));
+        gui.handleEvent(createMouseEvent(sf::Event::MouseButtonReleased, pos, pos));
+    });
+
+    auto editBox = tgui::EditBox::create();
+    editBox->setPosition({10, 10});
+    gui.add(editBox);
+    editBox->setFocused(true);
+
+    bench::measure("type in edit box next to 10000 buttons", iterations, [&]{
+        sf::Event event;
+        event.type = sf::Event::TextEntered;
+        event.text.unicode = static_cast<sf::Uint32>('a' + (++frame % 26));
+        gui.handleEvent(event);
+
+        if (editBox->getText().getSize() > 100)
+            editBox->setText("");
+    });
+}
+
+BENCHMARK_CASE("[Gui] Draw")
+{
+    const std::size_t iterations = 200;
+
+    sf::RenderTexture target;
+    target.create(1600, 1200);
+    tgui::Gui gui{target};
+
+    // A form with 100 panels, which each contain a few different widgets
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        auto panel = tgui::Panel::create({160, 120});
+        panel->setPosition({(i % 10) * 160.f, (i / 10) * 120.f});
+
+        auto label = tgui::Label::create("Panel " + tgui::to_string(i));
+        label->setPosition({5, 5});
+        panel->add(label);
+
+        auto editBox = tgui::EditBox::create();
+        editBox->setText("Text " + tgui::to_string(i));
+        editBox->setPosition({5, 30});
+        editBox->setSize({150, 22});
+        panel->add(editBox);
+
+        auto checkBox = tgui::CheckBox::create("Check");
+        checkBox->setPosition({5, 60});
+        checkBox->setChecked(i % 2 == 0);
+        panel->add(checkBox);
+
+        auto slider = tgui::Slider::create();
+        slider->setPosition({40, 62});
+        slider->setSize({110, 10});
+        panel->add(slider);
+
+        auto button = tgui::Button::create("Ok");
+        button->setPosition({5, 90});
+        button->setSize({150, 25});
+        panel->add(button);
+
+        gui.add(panel);
+    }
+
+    auto listBox = tgui::ListBox::create();
+    listBox->setSize({300, 600});
+    for (unsigned int i = 0; i < 1000; ++i)
+        listBox->addItem("Item " + tgui::to_string(i));
+    gui.add(listBox);
+
+    bench::measure("draw 600 widgets and a list box with 1000 items", iterations, [&]{
+        gui.draw();
+    });
+
+    listBox->setVisible(false);
+    bench::measure("draw 600 widgets", iterations, [&]{
+        gui.draw();
+    });
+
+    tgui::RenderCommandList commands;
+    bench::measure("record 600 widgets without drawing them", iterations, [&]{
+        gui.draw(commands);
+        bench::doNotOptimize(commands);
+    });
+}
+
+BENCHMARK_CASE("[Gui] Parallel draw")
+{
+    const std::size_t iterations = 200;
+
+    sf::RenderTexture target;
+    target.create(1600, 1200);
+    tgui::Gui gui{target};
+
+    // 8 child windows, which each contain a scrollable panel with 200 widgets
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        auto childWindow = tgui::ChildWindow::create("Window " + tgui::to_string(i));
+        childWindow->setPosition({(i % 4) * 400.f, (i / 4) * 600.f});
+        childWindow->setSize({390, 580});
+
+        auto panel = tgui::ScrollablePanel::create({390, 580});
+        for (unsigned int j = 0; j < 50; ++j)
+        {
+            auto label = tgui::Label::create("Label " + tgui::to_string(j));
+            label->setPosition({5, j * 30.f});
+            panel->add(label);
+
+            auto editBox = tgui::EditBox::create();
+            editBox->setText("Text " + tgui::to_string(j));
+            editBox->setPosition({80, j * 30.f});
+            editBox->setSize({100, 22});
+            panel->add(editBox);
+
+            auto checkBox = tgui::CheckBox::create("Check");
+            checkBox->setPosition({190, j * 30.f});
+            checkBox->setChecked(j % 2 == 0);
+            panel->add(checkBox);
+
+            auto button = tgui::Button::create("Ok");
+            button->setPosition({280, j * 30.f});
+            button->setSize({80, 25});
+            panel->add(button);
+        }
+
+        childWindow->add(panel);
+        gui.add(childWindow);
+    }
+
+    bench::measure("draw 8 child windows with 1600 widgets on 1 thread", iterations, [&]{
+        gui.draw();
+    });
+
+    // The thread that calls draw also records widgets, so one helper thread less than the amount of cores is needed
+    const unsigned int coreCount = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threadCount = 2; threadCount <= std::min(coreCount, 8u); threadCount *= 2)
+    {
+        gui.setParallelDrawingEnabled(true, threadCount - 1);
+
+        bench::measure("draw 8 child windows with 1600 widgets on " + tgui::to_string(threadCount) + " threads", iterations, [&]{
+            gui.draw();
+        });
+
+        gui.setParallelDrawingEnabled(false);
+    }
+}
+
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+// The layouts that are used in examples/scalable_login_screen
+static const char* const loginScreenLayouts[][2] = {
+    {"100%", "100%"},
+    {"66.67%", "12.5%"},
+    {"16.67%", "16.67%"},
+    {"16.67%", "41.6%"},
+    {"50%", "16.67%"},
+    {"25%", "70%"}
+};
+
+BENCHMARK_CASE("[Layout] Parse")
+{
+    const std::size_t iterations = 200000;
+
+    bench::measure("scalable login screen layouts", iterations, [&]{
+        for (const auto& layout : loginScreenLayouts)
+        {
+            tgui::Layout2d parsedLayout{tgui::Layout{layout[0]}, tgui::Layout{layout[1]}};
+            bench::doNotOptimize(parsedLayout);
+        }
+    });
+
+    bench::measure("\"&.width - 2 * (&.x + 10)\"", iterations, [&]{
+        tgui::Layout parsedLayout{"&.width - 2 * (&.x + 10)"};
+        bench::doNotOptimize(parsedLayout);
+    });
+}
+
+BENCHMARK_CASE("[Layout] Evaluate")
+{
+    const std::size_t iterations = 200000;
+
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+
+    auto picture = tgui::Picture::create();
+    picture->setSize({loginScreenLayouts[0][0], loginScreenLayouts[0][1]});
+    gui.add(picture);
+
+    auto editBoxUsername = tgui::EditBox::create();
+    editBoxUsername->setSize({loginScreenLayouts[1][0], loginScreenLayouts[1][1]});
+    editBoxUsername->setPosition({loginScreenLayouts[2][0], loginScreenLayouts[2][1]});
+    gui.add(editBoxUsername);
+
+    auto editBoxPassword = tgui::EditBox::copy(editBoxUsername);
+    editBoxPassword->setPosition({loginScreenLayouts[3][0], loginScreenLayouts[3][1]});
+    gui.add(editBoxPassword);
+
+    auto button = tgui::Button::create("Login");
+    button->setSize({loginScreenLayouts[4][0], loginScreenLayouts[4][1]});
+    button->setPosition({loginScreenLayouts[5][0], loginScreenLayouts[5][1]});
+    gui.add(button);
+
+    // Resizing the view is what happens when the window is resized, it changes the size of the root container
+    std::size_t frame = 0;
+    bench::measure("resize scalable login screen", iterations, [&]{
+        const float width = (++frame % 2) ? 800.f : 400.f;
+        gui.setView(sf::View{{0, 0, width, 300}});
+    });
+
+    bench::doNotOptimize(button->getSize());
+
+    auto widget = tgui::Button::create();
+    widget->setSize(tgui::Layout{"&.width - 2 * (&.x + 10)"}, 10);
+    gui.add(widget);
+
+    bench::measure("resize with \"&.width - 2 * (&.x + 10)\"", iterations, [&]{
+        const float width = (++frame % 2) ? 800.f : 400.f;
+        gui.setView(sf::View{{0, 0, width, 300}});
+    });
+
+    bench::doNotOptimize(widget->getSize());
+}
+
+BENCHMARK_CASE("[Layout] Cascade")
+{
+    const std::size_t iterations = 100;
+
+    sf::RenderTexture target;
+    target.create(800, 600);
+    tgui::Gui gui{target};
+
+    // Every button is placed to the right of the previous one, so moving the first button moves all of them
+    std::vector<tgui::Button::Ptr> chain;
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        auto button = tgui::Button::create();
+        button->setSize({20, 20});
+        if (!chain.empty())
+            button->setPosition({tgui::bindRight(chain.back()) + 5, tgui::bindTop(chain.back())});
+
+        gui.add(button);
+        chain.push_back(button);
+    }
+
+    std::size_t frame = 0;
+    bench::measure("move first of 1000 chained widgets", iterations, [&]{
+        chain.front()->setPosition({static_cast<float>(++frame % 100), 0});
+    });
+
+    bench::doNotOptimize(chain.back()->getPosition());
+
+    // Every widget has a size relative to its parent, which is relative to the gui
+    auto panel = tgui::Panel::create({"50%", "50%"});
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        auto button = tgui::Button::create();
+        button->setSize({"10%", "5%"});
+        button->setPosition({tgui::bindWidth(panel) * ((i % 10) / 10.f), tgui::bindHeight(panel) * ((i / 10) / 100.f)});
+        panel->add(button);
+    }
+    gui.add(panel);
+
+    bench::measure("resize gui with 1000 relatively sized widgets", iterations, [&]{
+        const float width = (++frame % 2) ? 800.f : 400.f;
+        gui.setView(sf::View{{0, 0, width, 600}});
+    });
+
+    bench::doNotOptimize(panel->getWidgets().back()->getSize());
+}
@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/SignalImpl.hpp>
+
+BENCHMARK_CASE("[Signal] Emit onValueChange")
+{
+    const std::size_t iterations = 10000000;
+
+    for (unsigned int handlerCount : {0, 1, 8})
+    {
+        tgui::Slider::Ptr slider = tgui::Slider::create();
+
+        float sum = 0;
+        for (unsigned int i = 0; i < handlerCount; ++i)
+            slider->connect("ValueChanged", [&](float value){ sum += value; });
+
+        bench::measure("emit with " + std::to_string(handlerCount) + " handler(s)", iterations, [&]{
+            slider->onValueChange.emit(slider.get(), 1.f);
+        });
+
+        bench::doNotOptimize(sum);
+    }
+}
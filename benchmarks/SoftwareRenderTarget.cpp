@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+
+BENCHMARK_CASE("[SoftwareRenderTarget] Draw")
+{
+    const std::size_t iterations = 20;
+
+    tgui::Gui gui;
+    gui.setView(sf::View{sf::FloatRect{0, 0, 1600, 1200}});
+
+    // 100 half transparent panels that each contain a few widgets
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        auto panel = tgui::Panel::create({160, 120});
+        panel->setPosition({(i % 10) * 160.f, (i / 10) * 120.f});
+        panel->getRenderer()->setOpacity(0.7f);
+
+        auto checkBox = tgui::CheckBox::create();
+        checkBox->setPosition({5, 10});
+        checkBox->setChecked(i % 2 == 0);
+        panel->add(checkBox);
+
+        auto slider = tgui::Slider::create();
+        slider->setPosition({40, 12});
+        slider->setSize({110, 10});
+        panel->add(slider);
+
+        auto button = tgui::Button::create();
+        button->setPosition({5, 60});
+        button->setSize({150, 50});
+        panel->add(button);
+
+        gui.add(panel);
+    }
+
+    tgui::SoftwareRenderTarget target{1600, 1200};
+    bench::measure("clear 1600x1200 pixels", iterations, [&]{
+        target.clear(tgui::Color::White);
+        bench::doNotOptimize(target.getPixelsPtr()[0]);
+    });
+
+    tgui::RenderCommandList commands;
+    gui.draw(commands);
+    bench::measure("rasterize 100 transparent panels with 300 widgets", iterations, [&]{
+        target.draw(commands);
+        bench::doNotOptimize(target.getPixelsPtr()[0]);
+    });
+}
@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Global.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Widgets/Label.hpp>
+
+namespace
+{
+    // Generates the same paragraph every time, so that results can be compared between runs
+    sf::String generateParagraph(std::size_t wordCount)
+    {
+        static const char* const words[] = {"Lorem", "ipsum", "dolor", "sit", "amet,", "consectetur", "adipiscing", "elit,", "sed", "do",
+                                            "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua."};
+
+        std::string paragraph;
+        for (std::size_t i = 0; i < wordCount; ++i)
+        {
+            if (i > 0)
+                paragraph += ((i % 40) == 0) ? "\n" : " ";
+
+            paragraph += words[(i * 7) % (sizeof(words) / sizeof(words[0]))];
+        }
+
+        return paragraph;
+    }
+}
+
+BENCHMARK_CASE("[Text] Word wrap")
+{
+    const std::size_t iterations = 200;
+
+    const sf::String paragraph = generateParagraph(1000);
+    const tgui::Font font = tgui::getGlobalFont();
+
+    bench::measure("wrap 1000 words at 300 pixels", iterations, [&]{
+        bench::doNotOptimize(tgui::Text::wordWrap(300, paragraph, font, 18, false));
+    });
+
+    bench::measure("wrap 1000 bold words at 80 pixels", iterations, [&]{
+        bench::doNotOptimize(tgui::Text::wordWrap(80, paragraph, font, 18, true));
+    });
+
+    auto label = tgui::Label::create();
+    label->setMaximumTextWidth(300);
+    std::size_t run = 0;
+    bench::measure("set text of label with maximum width", iterations, [&]{
+        label->setText((++run % 2) ? paragraph : paragraph + " end");
+    });
+}
@@ -0,0 +1,269 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    std::shared_ptr<tgui::RendererData> createButtonRenderer(tgui::Color textColor, tgui::Color backgroundColor)
+    {
+        return tgui::RendererData::create({
+                {"borders", {tgui::Borders{2}}},
+                {"bordercolor", {tgui::Color{60, 60, 60}}},
+                {"bordercolorhover", {tgui::Color{80, 80, 80}}},
+                {"bordercolordown", {tgui::Color{40, 40, 40}}},
+                {"bordercolorfocused", {tgui::Color{0, 0, 255}}},
+                {"bordercolordisabled", {tgui::Color{125, 125, 125}}},
+                {"textcolor", {textColor}},
+                {"textcolorhover", {textColor}},
+                {"textcolordown", {textColor}},
+                {"textcolordisabled", {tgui::Color{125, 125, 125}}},
+                {"backgroundcolor", {backgroundColor}},
+                {"backgroundcolorhover", {backgroundColor}},
+                {"backgroundcolordown", {backgroundColor}},
+                {"backgroundcolordisabled", {tgui::Color{230, 230, 230}}},
+                {"textstyle", {tgui::TextStyle{sf::Text::Bold}}},
+                {"textstylehover", {tgui::TextStyle{sf::Text::Underlined}}},
+                {"opacity", {0.9f}}
+            });
+    }
+
+    // Converts the values to their real type, like the renderers do when the widgets access them
+    float useProperties(std::map<std::string, tgui::ObjectConverter>&& properties)
+    {
+        float sum = 0;
+        for (auto& pair : properties)
+        {
+            switch (tgui::priv::getPropertyType(tgui::priv::internPropertyName(pair.first)))
+            {
+                case tgui::ObjectConverter::Type::Color:
+                    sum += pair.second.getColor().getRed();
+                    break;
+                case tgui::ObjectConverter::Type::Number:
+                    sum += pair.second.getNumber();
+                    break;
+                case tgui::ObjectConverter::Type::Outline:
+                    sum += pair.second.getOutline().getLeft();
+                    break;
+                case tgui::ObjectConverter::Type::TextStyle:
+                    sum += static_cast<unsigned int>(pair.second.getTextStyle());
+                    break;
+                case tgui::ObjectConverter::Type::RendererData:
+                    sum += useProperties(pair.second.getRenderer()->getAllProperties());
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return sum;
+    }
+}
+
+BENCHMARK_CASE("[Theme] Apply theme")
+{
+    const std::size_t iterations = 10;
+
+    tgui::Theme lightTheme;
+    lightTheme.addRenderer("Button", createButtonRenderer({0, 0, 0}, {245, 245, 245}));
+
+    tgui::Theme darkTheme;
+    darkTheme.addRenderer("Button", createButtonRenderer({255, 255, 255}, {30, 30, 30}));
+
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < 10000; ++i)
+        buttons.push_back(tgui::Button::create());
+
+    std::size_t run = 0;
+    bench::measure("apply theme to 10000 buttons", iterations, [&]{
+        auto& theme = (++run % 2) ? darkTheme : lightTheme;
+        const auto renderer = theme.getRenderer("Button");
+        for (auto& button : buttons)
+            button->setRenderer(renderer);
+    });
+
+    bench::measure("read 5 renderer properties of 10000 buttons", iterations * 10, [&]{
+        float sum = 0;
+        for (const auto& button : buttons)
+        {
+            const auto renderer = button->getSharedRenderer();
+            sum += renderer->getTextColor().getRed() + renderer->getBackgroundColor().getGreen() + renderer->getBorders().getLeft()
+                 + renderer->getOpacity() + static_cast<unsigned int>(renderer->getTextStyle());
+        }
+        bench::doNotOptimize(sum);
+    });
+}
+
+BENCHMARK_CASE("[Theme] Change shared renderer")
+{
+    const std::size_t iterations = 10;
+
+    tgui::Theme theme;
+    theme.addRenderer("Button", createButtonRenderer({0, 0, 0}, {245, 245, 245}));
+
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < 3000; ++i)
+    {
+        buttons.push_back(tgui::Button::create());
+        buttons.back()->setRenderer(theme.getRenderer("Button"));
+    }
+
+    tgui::ButtonRenderer renderer{theme.getRenderer("Button")};
+    std::size_t run = 0;
+    const auto changeProperties = [&]{
+        const auto textColor = (++run % 2) ? tgui::Color{255, 255, 255} : tgui::Color{0, 0, 0};
+        const auto backgroundColor = (run % 2) ? tgui::Color{30, 30, 30} : tgui::Color{245, 245, 245};
+        renderer.setTextColor(textColor);
+        renderer.setTextColorHover(textColor);
+        renderer.setTextColorDown(textColor);
+        renderer.setBackgroundColor(backgroundColor);
+        renderer.setBackgroundColorHover(backgroundColor);
+        renderer.setBackgroundColorDown(backgroundColor);
+        renderer.setBorders({(run % 2) ? 1.f : 2.f});
+        renderer.setOpacity((run % 2) ? 0.8f : 0.9f);
+    };
+
+    bench::measure("change 8 properties of a renderer shared by 3000 buttons", iterations, changeProperties);
+
+    bench::measure("change 8 properties of a renderer shared by 3000 buttons in one update", iterations, [&]{
+        renderer.beginUpdate();
+        changeProperties();
+        renderer.endUpdate();
+    });
+}
+
+BENCHMARK_CASE("[Theme] Override renderer property")
+{
+    const std::size_t iterations = 10;
+
+    tgui::Theme theme;
+    theme.addRenderer("Button", createButtonRenderer({0, 0, 0}, {245, 245, 245}));
+
+    std::vector<tgui::Button::Ptr> buttons;
+    for (unsigned int i = 0; i < 2000; ++i)
+        buttons.push_back(tgui::Button::create());
+
+    bench::measure("give 2000 buttons with a shared renderer their own text color", iterations, [&]{
+        for (auto& button : buttons)
+            button->setRenderer(theme.getRenderer("Button"));
+
+        unsigned char i = 0;
+        for (auto& button : buttons)
+            button->getRenderer()->setTextColor({i++, 0, 0});
+    });
+}
+
+BENCHMARK_CASE("[Theme] Load binary theme")
+{
+    const std::size_t iterations = 10;
+
+    std::ofstream file{"BenchmarkTheme.txt"};
+    file << "SharedScrollbar {\n    TrackColor = rgb(200, 200, 200);\n    ThumbColor = #808080;\n    ArrowColor = Black;\n}\n";
+    for (unsigned int i = 0; i < 300; ++i)
+    {
+        file << "Section" << i << " {\n"
+             << "    TextColor = rgb(" << (i % 256) << ", 10, 20);\n"
+             << "    TextColorHover = rgba(" << (i % 256) << ", 10, 20, 200);\n"
+             << "    BackgroundColor = #" << std::hex << (0x100000 + i) << std::dec << ";\n"
+             << "    BackgroundColorHover = White;\n"
+             << "    BorderColor = Black;\n"
+             << "    Borders = (1, 2, 1, 2);\n"
+             << "    Padding = (3, 3, 3, 3);\n"
+             << "    TextStyle = Bold | Underlined;\n"
+             << "    Opacity = 0.9;\n"
+             << "    ScrollbarWidth = 14;\n"
+             << "    Scrollbar = &SharedScrollbar;\n"
+             << "}\n";
+    }
+    file.close();
+
+    tgui::BinaryThemeLoader::compile("BenchmarkTheme.txt", "BenchmarkTheme.tgtheme");
+
+    tgui::DefaultThemeLoader textLoader;
+    const auto sections = textLoader.getSectionNames("BenchmarkTheme.txt");
+
+    bench::measure("load and convert 300 sections from text theme", iterations, [&]{
+        tgui::DefaultThemeLoader::flushCache();
+        float sum = 0;
+        for (const auto& section : sections)
+            sum += useProperties(textLoader.loadProperties("BenchmarkTheme.txt", section));
+        bench::doNotOptimize(sum);
+    });
+
+    tgui::BinaryThemeLoader binaryLoader;
+    bench::measure("load and convert 300 sections from binary theme", iterations, [&]{
+        tgui::BinaryThemeLoader::flushCache();
+        float sum = 0;
+        for (const auto& section : sections)
+            sum += useProperties(binaryLoader.loadProperties("BenchmarkTheme.tgtheme", section));
+        bench::doNotOptimize(sum);
+    });
+}
+
+BENCHMARK_CASE("[Theme] Load shared sections")
+{
+    const std::size_t iterations = 10;
+
+    // Many sections refer to the same list box, which refers to the same scrollbar as the sections themselves
+    std::ofstream file{"BenchmarkSharedSections.txt"};
+    file << "SharedScrollbar {\n"
+            "    TrackColor = rgb(200, 200, 200);\n    TrackColorHover = rgb(210, 210, 210);\n"
+            "    ThumbColor = #808080;\n    ThumbColorHover = #909090;\n"
+            "    ArrowBackgroundColor = White;\n    ArrowBackgroundColorHover = White;\n"
+            "    ArrowColor = Black;\n    ArrowColorHover = Black;\n"
+            "}\n"
+            "SharedListBox {\n"
+            "    BackgroundColor = White;\n    BackgroundColorHover = White;\n"
+            "    SelectedBackgroundColor = Blue;\n    SelectedBackgroundColorHover = Blue;\n"
+            "    TextColor = Black;\n    TextColorHover = Black;\n"
+            "    Borders = (1, 1, 1, 1);\n    Padding = (2, 2, 2, 2);\n"
+            "    Scrollbar = &SharedScrollbar;\n"
+            "}\n";
+    for (unsigned int i = 0; i < 300; ++i)
+    {
+        file << "Section" << i << " {\n"
+             << "    TextColor = rgb(" << (i % 256) << ", 10, 20);\n"
+             << "    ListBox = &SharedListBox;\n"
+             << "    Scrollbar = &SharedScrollbar;\n"
+             << "}\n";
+    }
+    file.close();
+
+    tgui::DefaultThemeLoader loader;
+    const auto sections = loader.getSectionNames("BenchmarkSharedSections.txt");
+
+    bench::measure("load and convert 300 sections referring to shared sections", iterations, [&]{
+        tgui::DefaultThemeLoader::flushCache();
+        float sum = 0;
+        for (const auto& section : sections)
+            sum += useProperties(loader.loadProperties("BenchmarkSharedSections.txt", section));
+        bench::doNotOptimize(sum);
+    });
+}
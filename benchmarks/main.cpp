@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Config.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+namespace bench
+{
+    const void* volatile sink = nullptr;
+
+    namespace
+    {
+        struct Result
+        {
+            std::string caseName;
+            std::string name;
+            std::size_t iterations;
+            std::vector<double> nanosecondsPerIteration;
+        };
+
+        std::size_t repetitions = 3;
+        std::string currentCase;
+        std::vector<Result> results;
+
+        double getMedian(std::vector<double> values)
+        {
+            std::sort(values.begin(), values.end());
+            const std::size_t middle = values.size() / 2;
+            if (values.size() % 2 == 0)
+                return (values[middle - 1] + values[middle]) / 2;
+            else
+                return values[middle];
+        }
+
+        std::string escapeJson(const std::string& str)
+        {
+            std::string result;
+            for (const char c : str)
+            {
+                if ((c == '"') || (c == '\\'))
+                    result += '\\';
+
+                result += c;
+            }
+
+            return result;
+        }
+
+        void writeJson(std::ostream& stream)
+        {
+            char date[32];
+            const std::time_t now = std::time(nullptr);
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+            stream << std::fixed << std::setprecision(1);
+            stream << "{\n";
+            stream << "  \"context\": {\n";
+            stream << "    \"date\": \"" << date << "\",\n";
+            stream << "    \"tgui_version\": \"" << TGUI_VERSION_MAJOR << "." << TGUI_VERSION_MINOR << "." << TGUI_VERSION_PATCH << "\",\n";
+#if defined(__clang__)
+            stream << "    \"compiler\": \"clang " << escapeJson(__clang_version__) << "\",\n";
+#elif defined(__GNUC__)
+            stream << "    \"compiler\": \"gcc " << escapeJson(__VERSION__) << "\",\n";
+#elif defined(_MSC_VER)
+            stream << "    \"compiler\": \"msvc " << _MSC_VER << "\",\n";
+#else
+            stream << "    \"compiler\": \"unknown\",\n";
+#endif
+#ifdef NDEBUG
+            stream << "    \"build_type\": \"release\",\n";
+#else
+            stream << "    \"build_type\": \"debug\",\n";
+#endif
+            stream << "    \"repetitions\": " << repetitions << "\n";
+            stream << "  },\n";
+            stream << "  \"benchmarks\": [";
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const auto& result = results[i];
+                const auto minmax = std::minmax_element(result.nanosecondsPerIteration.begin(), result.nanosecondsPerIteration.end());
+
+                stream << ((i > 0) ? ",\n" : "\n");
+                stream << "    {\n";
+                stream << "      \"case\": \"" << escapeJson(result.caseName) << "\",\n";
+                stream << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+                stream << "      \"iterations\": " << result.iterations << ",\n";
+                stream << "      \"median_ns\": " << getMedian(result.nanosecondsPerIteration) << ",\n";
+                stream << "      \"min_ns\": " << *minmax.first << ",\n";
+                stream << "      \"max_ns\": " << *minmax.second << ",\n";
+                stream << "      \"samples_ns\": [";
+                for (std::size_t j = 0; j < result.nanosecondsPerIteration.size(); ++j)
+                    stream << ((j > 0) ? ", " : "") << result.nanosecondsPerIteration[j];
+                stream << "]\n";
+                stream << "    }";
+            }
+            stream << "\n  ]\n";
+            stream << "}\n";
+        }
+    }
+
+    std::vector<Case>& getCases()
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    std::size_t getRepetitions()
+    {
+        return repetitions;
+    }
+
+    void report(const std::string& name, std::size_t iterations, const std::vector<double>& seconds)
+    {
+        std::vector<double> nanosecondsPerIteration;
+        for (const double value : seconds)
+            nanosecondsPerIteration.push_back(value * 1e9 / iterations);
+
+        const double median = getMedian(nanosecondsPerIteration);
+        const auto minmax = std::minmax_element(nanosecondsPerIteration.begin(), nanosecondsPerIteration.end());
+        const double spread = (median > 0) ? ((*minmax.second - *minmax.first) / 2 / median * 100) : 0;
+
+        std::cout << "    " << std::left << std::setw(60) << name
+                  << std::right << std::setw(12) << iterations << " iterations "
+                  << std::setw(14) << std::fixed << std::setprecision(2) << median << " ns/iteration"
+                  << "  +-" << std::setprecision(1) << spread << "%" << std::endl;
+
+        results.push_back({currentCase, name, iterations, std::move(nanosecondsPerIteration)});
+    }
+}
+
+// Usage: tgui-bench [--repetitions <count>] [--json <file>] [filter]
+// Only the benchmark cases which contain the filter in their name are executed.
+// Every measurement is repeated the given amount of times (3 by default) and the median is reported.
+// With --json, the results are also written to the given file, so that they can be compared between commits.
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::string jsonFilename;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if ((argument == "--repetitions") && (i + 1 < argc))
+            bench::repetitions = std::max(1, std::atoi(argv[++i]));
+        else if ((argument == "--json") && (i + 1 < argc))
+            jsonFilename = argv[++i];
+        else
+            filter = argument;
+    }
+
+    for (const auto& benchmarkCase : bench::getCases())
+    {
+        if (benchmarkCase.name.find(filter) == std::string::npos)
+            continue;
+
+        std::cout << benchmarkCase.name << std::endl;
+        bench::currentCase = benchmarkCase.name;
+        benchmarkCase.function();
+    }
+
+    if (!jsonFilename.empty())
+    {
+        std::ofstream file{jsonFilename};
+        if (!file)
+        {
+            std::cerr << "Failed to open " << jsonFilename << " for writing" << std::endl;
+            return 1;
+        }
+
+        bench::writeJson(file);
+    }
+
+    return 0;
+}
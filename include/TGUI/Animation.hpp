@@ -26,17 +26,19 @@
 #ifndef TGUI_ANIMATION_HPP
 #define TGUI_ANIMATION_HPP
 
+#include <TGUI/Color.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <SFML/System/Time.hpp>
+#include <unordered_map>
 #include <functional>
-#include <memory>
+#include <cstdint>
+#include <vector>
+#include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    class Widget;
-
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Type of animation to show/hide widget
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,98 +57,248 @@ namespace tgui
         SlideFromBottom = SlideToTop  ///< Slide from bottom to show or to the top to hide
     };
 
-    namespace priv
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Predefined curves that can be used to change the speed at which an animation progresses
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class Easing
+    {
+        Linear,       ///< Constant speed
+        EaseIn,       ///< Start slow and speed up (quadratic)
+        EaseOut,      ///< Start fast and slow down (quadratic)
+        EaseInOut,    ///< Start slow, speed up and slow down again at the end (quadratic)
+        CubicIn,      ///< Start slow and speed up (cubic)
+        CubicOut,     ///< Start fast and slow down (cubic)
+        CubicInOut,   ///< Start slow, speed up and slow down again at the end (cubic)
+        Smoothstep    ///< Smooth hermite interpolation
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Steps many animations at once
+    ///
+    /// Each animation interpolates a value between a start and an end value and passes the result to a setter function.
+    /// Animations of the same kind of value are stored together in contiguous arrays, so that updating thousands of them only
+    /// requires a single pass over each array. The gui has a scheduler that is updated every frame, see Gui::getAnimationScheduler.
+    ///
+    /// Example:
+    /// @code
+    /// gui.getAnimationScheduler().animate(button->getPosition(), {100, 50}, sf::milliseconds(300),
+    ///                                     [=](tgui::Vector2f pos){ button->setPosition(pos); }, tgui::Easing::EaseOut);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API AnimationScheduler
     {
+    public:
+
+        using Id = std::uint64_t; ///< Identifies an animation, 0 is never used as id
+        using EasingFunction = std::function<float(float)>; ///< Maps the progress of the animation (between 0 and 1) to the interpolation factor
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler() = default;
 
-        class TGUI_API Animation
-        {
-        public:
-            enum class Type
-            {
-                None = 0,
-                Move = 1,
-                Resize = 2,
-                Fade = 4
-            };
-
-            // Move constructor has to be explicitly declared since this class has a destructor
-            Animation() = default;
-            Animation(const Animation&) = default;
-            Animation(Animation&&) = default;
-            Animation& operator=(const Animation&) = default;
-            Animation& operator=(Animation&&) = default;
-            virtual ~Animation() = default;
-
-            Type getType() const;
-
-            virtual bool update(sf::Time elapsedTime) = 0;
-            virtual void finish();
-
-        protected:
-            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback);
-
-        protected:
-            Type m_type = Type::None;
-            std::shared_ptr<Widget> m_widget;
-
-            sf::Time m_totalDuration;
-            sf::Time m_elapsedTime;
-
-            std::function<void()> m_finishedCallback;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The animations contain callbacks that refer to the scheduler they were added to, so the scheduler can't be copied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler(const AnimationScheduler&) = delete;
+        AnimationScheduler& operator=(const AnimationScheduler&) = delete;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a number
+        ///
+        /// @param start            Value passed to the setter at the start of the animation
+        /// @param end              Value passed to the setter when the animation finishes
+        /// @param duration         How long the animation lasts
+        /// @param setter           Function that is called with the interpolated value every time the animation is updated
+        /// @param easing           Curve that determines how fast the value changes during the animation
+        /// @param finishedCallback Optional function that is called after the animation finished
+        ///
+        /// @return Id of the animation, which can be passed to the stop and finish functions
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                   Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
 
-        class TGUI_API MoveAnimation : public Animation
-        {
-        public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a number with a custom easing function
+        ///
+        /// @param start            Value passed to the setter at the start of the animation
+        /// @param end              Value passed to the setter when the animation finishes
+        /// @param duration         How long the animation lasts
+        /// @param setter           Function that is called with the interpolated value every time the animation is updated
+        /// @param easing           Function that maps the progress (between 0 and 1) to the interpolation factor
+        /// @param finishedCallback Optional function that is called after the animation finished
+        ///
+        /// @return Id of the animation, which can be passed to the stop and finish functions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                   EasingFunction easing, std::function<void()> finishedCallback = nullptr);
 
-            bool update(sf::Time elapsedTime) override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a vector (e.g. a position, size or scroll offset)
+        ///
+        /// @see animate(float, float, sf::Time, std::function<void(float)>, Easing, std::function<void()>)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                   Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
 
-            void finish() override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a vector (e.g. a position, size or scroll offset) with a custom easing function
+        ///
+        /// @see animate(float, float, sf::Time, std::function<void(float)>, EasingFunction, std::function<void()>)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                   EasingFunction easing, std::function<void()> finishedCallback = nullptr);
 
-        private:
-            Vector2f m_startPos;
-            Vector2f m_endPos;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a color, all four channels are interpolated
+        ///
+        /// @see animate(float, float, sf::Time, std::function<void(float)>, Easing, std::function<void()>)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(Color start, Color end, sf::Time duration, std::function<void(Color)> setter,
+                   Easing easing = Easing::Linear, std::function<void()> finishedCallback = nullptr);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts animating a color with a custom easing function, all four channels are interpolated
+        ///
+        /// @see animate(float, float, sf::Time, std::function<void(float)>, EasingFunction, std::function<void()>)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Id animate(Color start, Color end, sf::Time duration, std::function<void(Color)> setter,
+                   EasingFunction easing, std::function<void()> finishedCallback = nullptr);
 
-        class TGUI_API ResizeAnimation : public Animation
-        {
-        public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
 
-            bool update(sf::Time elapsedTime) override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Advances all animations
+        ///
+        /// @param elapsedTime  Time passed since the last update
+        ///
+        /// Animations that are added while updating (e.g. from a finished callback) will only be stepped in the next update.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime);
 
-            void finish() override;
 
-        private:
-            Vector2f m_startSize;
-            Vector2f m_endSize;
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Immediately finishes an animation
+        ///
+        /// @param id  Id that was returned when the animation was added
+        ///
+        /// The setter is called with the end value and the finished callback is called.
+        ///
+        /// @return False when the animation no longer existed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool finish(Id id);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes an animation without calling its setter or finished callback again
+        ///
+        /// @param id  Id that was returned when the animation was added
+        ///
+        /// @return False when the animation no longer existed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool stop(Id id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all animations without calling their setters or finished callbacks
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopAll();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether an animation is still running
+        ///
+        /// @param id  Id that was returned when the animation was added
+        ///
+        /// @return Whether the animation exists and hasn't finished yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRunning(Id id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of animations that are currently running
+        ///
+        /// @return Number of animations
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getAnimationCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the function that implements one of the predefined easing curves
+        ///
+        /// @param easing  Predefined curve
+        ///
+        /// @return Function that maps the progress (between 0 and 1) to the interpolation factor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static EasingFunction getEasingFunction(Easing easing);
 
-        class TGUI_API FadeAnimation : public Animation
-        {
-        public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
 
-            bool update(sf::Time elapsedTime) override;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
 
-            void finish() override;
+        // All animations that interpolate values of the same type, stored as a structure of arrays
+        template <typename T>
+        struct Track
+        {
+            std::vector<Id> ids;
+            std::vector<T> startValues;
+            std::vector<T> endValues;
+            std::vector<float> elapsedTimes;
+            std::vector<float> durations;
+            std::vector<Easing> easings;
+            std::vector<EasingFunction> customEasings;
+            std::deque<std::function<void(T)>> setters; // A deque is used as setters may add animations while being executed
+            std::vector<std::function<void()>> finishedCallbacks;
+        };
 
-        private:
-            float m_startOpacity;
-            float m_endOpacity;
+        enum class Kind : std::uint8_t
+        {
+            Float,
+            Vector,
+            Color
         };
 
+        struct Location
+        {
+            Kind kind;
+            std::size_t index;
+        };
+
+        template <typename T>
+        Id add(Track<T>& track, Kind kind, T start, T end, sf::Time duration, std::function<void(T)> setter,
+               Easing easing, EasingFunction customEasing, std::function<void()> finishedCallback);
+
+        template <typename T>
+        void updateTrack(Track<T>& track, Kind kind, float elapsedSeconds);
+
+        template <typename T>
+        void finishInTrack(Track<T>& track, Kind kind, std::size_t index);
+
+        template <typename T>
+        void removeFromTrack(Track<T>& track, Kind kind, std::size_t index);
+
+        void processPendingOperations();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Track<float> m_floatTrack;
+        Track<Vector2f> m_vectorTrack;
+        Track<Color> m_colorTrack;
 
-    } // namespace priv
+        std::unordered_map<Id, Location> m_locations;
+
+        // Animations can't be removed from the arrays while they are being iterated
+        bool m_updating = false;
+        std::vector<std::size_t> m_finishedIndices;
+        std::vector<std::pair<Id, bool>> m_pendingOperations; // Animations to finish (true) or stop (false) after updating
+        std::vector<std::function<void()>> m_finishedCallbacks;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
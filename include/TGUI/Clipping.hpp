@@ -37,6 +37,10 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    class RenderCommandList;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     class TGUI_API Clipping
     {
     public:
@@ -74,6 +78,9 @@ namespace tgui
         sf::RenderTarget& m_target;
         sf::View m_oldView;
 
+        // The command list to which the clipping was added instead of changing the view of the target, if any
+        RenderCommandList* m_commands;
+
         static sf::View m_originalView;
     };
 
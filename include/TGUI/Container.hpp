@@ -28,8 +28,10 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/SpatialIndex.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +106,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<Widget::Ptr>& getWidgets() const
         {
+            loadPendingWidgets();
             return m_widgets;
         }
 
@@ -116,6 +119,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<sf::String>& getWidgetNames() const
         {
+            loadPendingWidgets();
             return m_widgetNames;
         }
 
@@ -140,6 +144,9 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// The name may also be a path through the widget tree, with the names separated by dots (e.g. "Panel1.Tabs.Button1").
+        /// Every part of the path is then looked up in the direct children of the widget that was found for the previous part.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -187,6 +194,15 @@ namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reserves room for child widgets, so that adding many widgets at once doesn't have to grow the storage repeatedly
+        ///
+        /// @param count  Total amount of child widgets that the container is expected to have
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserveWidgets(std::size_t count);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the name of a widget
         ///
@@ -237,12 +253,27 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows or hides the container
+        ///
+        /// @param visible  Is the container visible?
+        ///
+        /// Child widgets that were not yet created because the container was hidden while loading are created when the
+        /// container is shown.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVisible(bool visible) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a text file
-        /// @param filename  Filename of the widget file
+        /// @param filename                 Filename of the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers, see loadWidgetsFromStream
         /// @throw Exception when file could not be opened or parsing failed
+        ///
+        /// The file is read while the widgets are being created, see loadWidgetsFromStream.
+        /// Files that were written with saveWidgetsToBinaryStream are recognized and loaded with loadWidgetsFromBinaryStream.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromFile(const std::string& filename);
+        void loadWidgetsFromFile(const std::string& filename, bool loadHiddenWidgetsLazily = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,27 +285,85 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a string stream
+        /// @brief Loads the child widgets from a stream
         ///
-        /// @param stream  stringstream that contains the widget file
+        /// @param stream                   Stream that contains the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of containers that are hidden in the file
+        ///
+        /// The stream is parsed while the widgets are being loaded: a top-level widget is created as soon as its section has
+        /// been read. The existing widgets are only replaced by the new ones once the whole stream was loaded successfully,
+        /// when the file contains an error then the container is left unchanged.
+        ///
+        /// When loadHiddenWidgetsLazily is true, a container that is invisible after loading its own properties only keeps
+        /// the sections of its children. The child widgets are created the first time that the container is shown or that
+        /// they are accessed through the container (e.g. with get or getWidgets). Errors in these sections are then only
+        /// reported at that moment.
+        ///
+        /// @throw Exception when parsing failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream& stream);
+        void loadWidgetsFromStream(std::istream& stream, bool loadHiddenWidgetsLazily = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
-        /// @param stream  stringstream that contains the widget file
+        /// @param stream                   stringstream that contains the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers, see the other overload
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream&& stream);
+        void loadWidgetsFromStream(std::stringstream&& stream, bool loadHiddenWidgetsLazily = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Saves the child widgets to a stream
+        ///
+        /// @param stream  Stream to which the widget file will be added
+        ///
+        /// Each top-level widget is written to the stream directly after it has been saved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a stream containing the binary form of a widget file
+        ///
+        /// @param stream                   Stream that contains the binary form, opened in binary mode
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers, see loadWidgetsFromStream
+        ///
+        /// The widgets are loaded in the same way as with loadWidgetsFromStream, but the input doesn't have to be parsed.
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @throw Exception when the stream doesn't contain a valid binary form
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void loadWidgetsFromBinaryStream(std::istream& stream, bool loadHiddenWidgetsLazily = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a stream in a compact binary form
+        ///
+        /// @param stream  Stream to which the binary form will be added, opened in binary mode
+        ///
+        /// The binary form contains the same information as the text format written by saveWidgetsToStream.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Takes a snapshot of the child widgets
+        ///
+        /// @return Child widgets in binary form, which can be passed to restoreSnapshot
+        ///
+        /// Snapshots can e.g. be used to implement undo, they are much faster to create and restore than the text format.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string saveSnapshot() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the child widgets by the ones from a snapshot
+        ///
+        /// @param snapshot  Snapshot that was returned by saveSnapshot, possibly of a different container
+        ///
+        /// @throw Exception when the snapshot is invalid, the existing widgets are kept in that case
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void restoreSnapshot(const std::string& snapshot);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,6 +409,35 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables the spatial index that is used to find the widget below the mouse
+        ///
+        /// @param enabled   Should the child widgets be stored in a spatial index?
+        /// @param cellSize  Width and height of the cells in the grid, ideally close to the size of the child widgets
+        ///
+        /// Without the index, every mouse event checks all child widgets until the one below the mouse is found.
+        /// With the index, only the widgets that are located in the same grid cell as the mouse are checked, which is a lot
+        /// faster when the container has thousands of child widgets (e.g. the tiles in a map editor).
+        ///
+        /// The index assumes that a widget can only be below the mouse when the mouse is inside the rectangle defined by
+        /// the position, widget offset and full size of the widget. Widgets that react to the mouse outside that area
+        /// (e.g. a MenuBar with an open menu) should not be placed directly inside a container that uses the index.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled, float cellSize = 64);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the spatial index is used to find the widget below the mouse
+        ///
+        /// @return Is the spatial index enabled?
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called when one of the child widgets of this container gains focus.
@@ -327,6 +445,27 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when one of the child widgets of this container was moved or resized.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a child widget starts or stops having to be updated every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childTimeDependencyChanged(Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the first direct child of which the lowercase name matches the given name, or nullptr when there is none.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getChildWidgetByLowercaseName(const std::string& lowercaseName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,10 +537,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +556,14 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget has to be updated every frame
+        ///
+        /// A container is time-dependent when one of its child widgets is.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeDependent() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -441,15 +589,85 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first direct child with the given name, or nullptr when there is none
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getChildWidgetByName(const sf::String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the child widget at oldIndex to newIndex, shifting the widgets in between.
+        // Derived classes have to reorder their children with this function, so that the name and spatial indices stay valid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveWidgetToIndex(std::size_t oldIndex, std::size_t newIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the child widget that should be stored in the name index for the given lowercase name again.
+        // This has to be called when a widget with that name was removed, renamed or moved to a different index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetNameIndex(const std::string& lowercaseName);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Puts all child widgets in the spatial index again, after widgets were added, removed or reordered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the child widgets by the ones in a widget file. The parse function has to pass the file to the visitor.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgets(const std::function<void(DataIO::Visitor&)>& parse, bool loadHiddenWidgetsLazily);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Saves the renderers and child widgets, every top-level node is passed to the function as soon as it was created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgets(const std::function<void(const DataIO::Node&)>& writeNode) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets from the sections of a widget file and adds them to the container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& childNodes, const LoadingRenderersMap& renderers);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the child widgets of which the creation was delayed because the container was hidden while being loaded.
+        // The container is logically const, as the widgets already belonged to it from the point of view of the user.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadPendingWidgets() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_widgetNames;
 
+        // Maps the lowercase widget names to the first child widget with such a name.
+        // The original name is stored as well, as get() has to distinguish between names with a different case.
+        struct NamedWidget
+        {
+            Widget::Ptr widget;
+            sf::String name;
+        };
+        std::unordered_map<std::string, NamedWidget> m_widgetNameIndex;
+
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_focusedWidget;
 
+        // The child widget on which the left mouse button went down
+        Widget::Ptr m_widgetWithMouseDown;
+
+        std::unique_ptr<priv::SpatialIndex> m_spatialIndex;
+        bool m_spatialIndexOutdated = false;
+
+        // Child widgets that have to be updated every frame. Only these widgets are visited by the update function.
+        std::vector<Widget::Ptr> m_timeDependentWidgets;
+        std::vector<Widget::Ptr> m_widgetsBeingUpdated;
+
         Vector2f m_prevInnerSize;
 
         // Did we enter handleEvent directly or because we got a MouseReleased event?
@@ -458,6 +676,10 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Sections of the child widgets that still have to be created, when the container was hidden while being loaded
+        std::vector<std::unique_ptr<DataIO::Node>> m_pendingWidgetNodes;
+        LoadingRenderersMap m_pendingRenderers;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -513,6 +735,15 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the scheduler that runs the animations of all widgets inside the gui
+        ///
+        /// @return Animation scheduler, which is updated by the gui every frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<AnimationScheduler>& getAnimationScheduler() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -537,6 +768,8 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        std::shared_ptr<AnimationScheduler> m_animationScheduler = std::make_shared<AnimationScheduler>();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -28,6 +28,10 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/PostedFunctionQueue.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderCommandList.hpp>
+#include <TGUI/ThreadPool.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -85,6 +89,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Gui& operator=(const Gui& right) = delete;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~Gui();
+
 #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets the window on which the gui should be drawn
@@ -170,6 +180,18 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records what the widgets would draw into a command list, without drawing anything
+        ///
+        /// @param commands  List that will be cleared and then filled with the commands to draw the gui
+        ///
+        /// This function does the same as draw, except that no render target is needed. The positions in the commands are in
+        /// the coordinates of the view of the gui, which can be set with setView when the gui has no target.
+        /// Drawing the command list on a render target that uses the view of the gui gives the same result as calling draw.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(RenderCommandList& commands);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -354,10 +376,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a text file
         ///
-        /// @param filename  Filename of the widget file
+        /// @param filename                 Filename of the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers
         ///
+        /// @see Container::loadWidgetsFromStream
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromFile(const std::string& filename);
+        void loadWidgetsFromFile(const std::string& filename, bool loadHiddenWidgetsLazily = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,30 +394,238 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a string stream
+        /// @brief Loads the child widgets from a stream
         ///
-        /// @param stream  stringstream that contains the widget file
+        /// @param stream                   Stream that contains the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers
         ///
+        /// @see Container::loadWidgetsFromStream
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream& stream);
+        void loadWidgetsFromStream(std::istream& stream, bool loadHiddenWidgetsLazily = false);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
-        /// @param stream  stringstream that contains the widget file
+        /// @param stream                   stringstream that contains the widget file
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromStream(std::stringstream&& stream, bool loadHiddenWidgetsLazily = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves this the child widgets to a stream
+        ///
+        /// @param stream  Stream to which the widget file will be added
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a stream containing the binary form of a widget file
+        ///
+        /// @param stream                   Stream that contains the binary form, opened in binary mode
+        /// @param loadHiddenWidgetsLazily  Delay creating the child widgets of hidden containers
+        ///
+        /// @see Container::loadWidgetsFromBinaryStream
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinaryStream(std::istream& stream, bool loadHiddenWidgetsLazily = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a stream in a compact binary form
+        ///
+        /// @param stream  Stream to which the binary form will be added, opened in binary mode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryStream(std::ostream& stream) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed on the thread that handles the events and draws the gui
+        ///
+        /// @param function  Function to execute
+        ///
+        /// This function can safely be called from any thread, e.g. to update a ProgressBar from a worker thread.
+        /// Posted functions are executed in the same order as they were posted, at the start of the next handleEvent or draw call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed on the thread that handles the events and draws the gui
+        ///
+        /// @param function  Function to execute
+        /// @param key       Identifier of the update, typically the address of the widget that is being changed
+        ///
+        /// This function can safely be called from any thread. If a function with the same key was posted earlier but hasn't
+        /// been executed yet, then only the newest function will be executed. This way a worker thread can e.g. post progress
+        /// updates as often as it wants while the progress bar will only be updated once per frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> function, const void* key);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much time can be spend per frame on executing posted functions
+        ///
+        /// @param timeBudget  Maximum time to spend on posted functions, or sf::Time::Zero to execute all of them at once
+        ///
+        /// When the time runs out, the remaining functions are executed at the next handleEvent or draw call.
+        /// At least one function is always executed, so even with a small budget the queue will keep moving.
+        /// By default there is no limit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPostedFunctionsTimeBudget(sf::Time timeBudget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much time can be spend per frame on executing posted functions
+        ///
+        /// @return Maximum time to spend on posted functions, or sf::Time::Zero when there is no limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getPostedFunctionsTimeBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the functions that were posted from other threads
+        ///
+        /// This function is called automatically by handleEvent and draw, you only need to call it yourself when you want the
+        /// posted functions to be executed at a different moment.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processPostedFunctions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts are only recalculated once per frame
+        ///
+        /// @param deferred  Should layouts only be recalculated when the gui is drawn?
+        ///
+        /// By default, the layouts that depend on a widget are recalculated immediately when the widget is moved or resized.
+        /// When the updates are deferred, the layouts are only marked as outdated and they are all recalculated together when
+        /// draw or updateLayouts is called. Until then, the position and size of widgets with such layouts won't be up-to-date.
+        ///
+        /// Only the layouts of widgets inside this gui are affected, other guis keep recalculating their layouts immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayoutUpdatesDeferred(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts are only recalculated once per frame
+        ///
+        /// @return Are layouts only recalculated when the gui is drawn?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getLayoutUpdatesDeferred() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that are outdated
+        ///
+        /// This function is called automatically by draw, you only need to call it yourself when layout updates are deferred and
+        /// you need the widgets to have their correct position and size before the gui is drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the scheduler that runs animations inside this gui
+        ///
+        /// @return Animation scheduler that is updated every frame, before the widgets are updated
+        ///
+        /// Show and hide animations of widgets in the gui are also run by this scheduler.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler& getAnimationScheduler();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether statistics are collected about every frame
+        ///
+        /// @param enabled  Should the time spent in the gui and its widgets and the amount of draw calls be measured?
+        ///
+        /// The statistics are only collected when TGUI was built with the TGUI_ENABLE_PROFILER option, which is the default.
+        /// When TGUI was built without it, all instrumentation is removed at compile time and the statistics remain empty.
+        /// Profiling is disabled by default, the cost of the instrumentation while it is disabled is a single check per call.
+        ///
+        /// Changes to the renderer of widgets that are made outside of handleEvent, updateTime and draw are counted in the
+        /// statistics of the gui that was last active. Only one gui should thus be profiled at a time.
+        ///
+        /// @see getFrameStatistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProfilingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether statistics are collected about every frame
+        ///
+        /// @return Is the profiler enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isProfilingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the statistics of the last frame
+        ///
+        /// @return Timings and draw call counts of everything that happened between the previous two calls to draw
+        ///
+        /// The statistics are empty when profiling isn't enabled or no frame has been drawn yet since it was enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const FrameStatistics& getFrameStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording every profiled function call, so that they can be viewed on a timeline
+        ///
+        /// Profiling has to be enabled for anything to be recorded. Every widget that is drawn adds an event to the trace,
+        /// so recording should be limited to a few frames.
         ///
+        /// @see stopChromeTrace
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream&& stream);
+        void startChromeTrace();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves this the child widgets to a text file
+        /// @brief Stops recording the profiled function calls and saves them to a file
+        ///
+        /// @param filename  Filename of the json file, which can be opened in chrome://tracing or similar tools
+        ///
+        /// @throw Exception when the file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopChromeTrace(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops recording the profiled function calls and writes them to a stream
+        ///
+        /// @param stream  Stream to which the events are written in the Chrome trace event format
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopChromeTrace(std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets directly inside the gui are recorded on several threads at once
+        ///
+        /// @param enabled      Should the top-level widgets be recorded in parallel?
+        /// @param threadCount  Amount of threads that help recording, or 0 to use the threads that the library shares
+        ///
+        /// When enabled, every visible widget that was added directly to the gui is recorded into its own command list.
+        /// The thread that calls draw records widgets as well, the helper threads take the next widget that nobody is
+        /// recording yet. When a thread count is given, the gui starts its own threads and keeps them until parallel drawing
+        /// is disabled or a different count is passed. The lists are drawn in the order of the widgets afterwards, so the result is identical to drawing
+        /// them on a single thread. This pays off when the gui contains several heavy subtrees (e.g. child windows or
+        /// scrollable panels with many widgets), it only adds overhead when it contains a single one.
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// The widgets are recorded on a single thread while profiling is enabled, as the profiler is not thread-safe.
+        /// Parallel drawing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParallelDrawingEnabled(bool enabled, unsigned int threadCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets directly inside the gui are recorded on several threads at once
         ///
+        /// @return Is parallel drawing enabled?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        bool isParallelDrawingEnabled() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +645,19 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes posted functions, updates the layouts and the time before the widgets are drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prepareDraw();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Records every visible top-level widget into its own list in m_subtreeCommands when parallel drawing is enabled.
+        // Returns the amount of lists that were recorded, or 0 when the widgets have to be recorded on this thread instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t recordSubtreesInParallel(sf::RenderTarget& target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -440,6 +685,22 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Functions that were posted from other threads
+        priv::PostedFunctionQueue m_postedFunctions;
+        sf::Time m_postedFunctionsTimeBudget;
+
+        bool m_layoutUpdatesDeferred = false;
+
+        priv::Profiler m_profiler;
+
+        // Commands that were recorded in the last draw call, kept to reuse the memory
+        RenderCommandList m_renderCommands;
+
+        // Commands of each top-level widget when they are recorded in parallel
+        std::vector<RenderCommandList> m_subtreeCommands;
+        bool m_parallelDrawing = false;
+        std::unique_ptr<priv::ThreadPool> m_drawThreadPool; // Only exists when a thread count was passed to setParallelDrawingEnabled
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
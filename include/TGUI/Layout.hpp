@@ -32,6 +32,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +41,11 @@ namespace tgui
     class Gui;
     class Widget;
 
+    namespace priv
+    {
+        class LayoutSolver;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Class to store the left, top, width or height of a widget
     ///
@@ -186,15 +192,44 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Marks the layout as outdated
+        ///
+        /// The value is recalculated together with all other outdated layouts, in the order of their dependencies.
+        /// This happens immediately unless the recalculation of layouts is postponed (e.g. by Gui::setLayoutUpdatesDeferred).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the circular dependency between layouts that was found most recently
+        ///
+        /// Layouts that depend on each other in a cycle (e.g. two widgets that should each be wider than the other) can't all
+        /// be satisfied. When such a cycle is found while recalculating layouts, the layouts in the cycle are only evaluated
+        /// once, a warning is printed and the cycle is remembered until clearCircularDependency is called.
+        ///
+        /// @return Description of the cycle, e.g. "Button2.size depends on Button1.size depends on Button2.size",
+        ///         or an empty string when no cycle was found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getCircularDependency();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets about the circular dependency that was found, getCircularDependency will return an empty string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearCircularDependency();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Step of the expression flattened into postfix order, the steps are executed on a stack of values
+        struct Instruction
+        {
+            Operation operation;
+            float value; // Constant value when the operation is Value
+            const Widget* widget; // Widget to read from when the operation is a binding
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // If a widget is bound, inform it that the layout no longer binds it
@@ -211,14 +246,40 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Returns true when a widget was bound.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        bool parseBindingStringRecursive(Widget* widget, bool xAxis);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Find the widget corresponding to the given name and bind it if found. Returns true when a widget was bound.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        bool parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value based on the operation, assuming that the values of the operands are already up-to-date
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the value of this top-level layout by running its compiled program, without informing anyone about changes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void evaluate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends the instructions to calculate this layout to the program and returns the stack size that they need.
+        // Operations that only depend on constants are folded into a single constant.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t compile(std::vector<Instruction>& program) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the top-level layout that its program has to be compiled again because the expression or a binding changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateProgram();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +293,14 @@ namespace tgui
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // The widget that uses this layout as its position or size
+        bool m_dirty = false; // Is the layout waiting in the layout solver to be recalculated?
+
+        std::vector<Instruction> m_program; // Compiled expression, only used by the top-level layout
+        std::size_t m_programStackSize = 0;
+        bool m_programCompiled = false;
+
+        friend class priv::LayoutSolver;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_LAYOUT_SOLVER_HPP
+#define TGUI_LAYOUT_SOLVER_HPP
+
+#include <TGUI/Config.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Layout;
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Keeps track of layouts that need to be recalculated and evaluates them in the order of their dependencies.
+        // When a widget moves or resizes, the layouts that depend on it are only marked as dirty. They are all recalculated in
+        // a single pass, so that every layout is evaluated at most once, no matter how many widgets it depends on.
+        // The solver is only meant to be used from the thread that owns the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API LayoutSolver
+        {
+        public:
+
+            // Marks the layout as dirty. It is recalculated immediately unless the solver is suspended or is already solving.
+            static void markDirty(Layout& layout);
+
+            // Removes all references to the layout, called when the layout is destroyed
+            static void forget(Layout& layout);
+
+            // Prevents layouts from being recalculated until resume is called. Calls can be nested.
+            static void suspend();
+
+            // Undoes a call to suspend and recalculates the dirty layouts when there are no more suspensions
+            static void resume();
+
+            // Recalculates all dirty layouts, even when the solver is suspended. Layouts of a deferred root are not included.
+            // When layouts depend on each other in a cycle, a warning is printed and the cycle is remembered as the circular
+            // dependency. Such layouts are only evaluated once.
+            static void solve();
+
+            // Postpones the recalculation of layouts of widgets inside the given top-level container until solveDeferred is
+            // called for it. When the root is no longer deferred, its postponed layouts are recalculated immediately.
+            static void setDeferred(const Widget& root, bool deferred);
+
+            // Recalculates the dirty layouts, including the postponed layouts of the given top-level container
+            static void solveDeferred(const Widget& root);
+
+            // Returns whether there are layouts that still need to be recalculated
+            static bool hasDirtyLayouts();
+
+            // Returns the description of the cycle that was found most recently, or an empty string when none was found since
+            // the last call to clearCircularDependency
+            static const std::string& getCircularDependency();
+
+            // Forgets about the cycle that was found
+            static void clearCircularDependency();
+
+        private:
+
+            // Fills the order with the given layouts and everything that depends on them, each layout comes after its dependencies.
+            // Layouts that are part of a cycle are added to cyclicLayouts.
+            static void sortLayouts(const std::vector<Layout*>& layouts, std::vector<Layout*>& order, std::unordered_set<Layout*>& cyclicLayouts);
+
+            // Returns the nodes that depend on the position or size that the given node determines
+            static std::vector<Layout*> getDependents(const Layout& layout);
+
+            // Returns the layout that represents the given layout in the dependency graph. This is the top-level layout, except
+            // for the y coordinate of a widget position or size, which is represented by the layout of the x coordinate.
+            static Layout& getNode(Layout& layout);
+
+            // Returns the top-level container of the widget that the node belongs to, or a nullptr if it has no widget
+            static const Widget* getRoot(const Layout& node);
+
+            // Recalculates the layout and the y coordinate that it represents, returns whether any value was changed
+            static bool evaluateNode(Layout& layout);
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LAYOUT_SOLVER_HPP
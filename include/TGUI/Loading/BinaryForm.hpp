@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BINARY_FORM_HPP
+#define TGUI_BINARY_FORM_HPP
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Reader and writer for the binary form of widget files
+    ///
+    /// A binary form contains the same sections and properties as a text widget file, but every name and value is stored
+    /// only once in a string table that is built while writing. Later occurrences only store their index in the table.
+    /// Values are stored as plain values or as lists of which the items are already split, so reading a binary form
+    /// requires no tokenizing, no trimming and no case conversions. Strings are stored as UTF-8, so unlike the text format
+    /// no characters are lost.
+    ///
+    /// The binary form is written and read sequentially, so just like the text format it can be streamed.
+    /// @internal
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BinaryForm
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Visitor that writes a binary form directly to a stream
+        ///
+        /// The header is written by the constructor. The finish function has to be called after the last section.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Writer : public DataIO::Visitor
+        {
+        public:
+            explicit Writer(std::ostream& stream);
+
+            void beginNode(const std::string& name) override;
+            void property(const std::string& key, std::unique_ptr<DataIO::ValueNode> value) override;
+            void endNode() override;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a property to the section that is currently open
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void property(const std::string& key, const DataIO::ValueNode& value);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a node, including its properties and child nodes, inside the section that is currently open
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeNode(const DataIO::Node& node);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Marks the end of the form, all sections must have been closed
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void finish();
+
+        private:
+            void writeSize(std::size_t size);
+            void writeString(const std::string& str);
+            void writeString(const sf::String& str);
+            void writeKey(const std::string& key);
+
+            std::ostream& m_stream;
+            std::unordered_map<std::string, std::size_t> m_strings;
+            std::unordered_map<std::string, std::size_t> m_keys;
+            std::string m_buffer;
+            std::size_t m_depth = 0;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a stream contains a binary form
+        ///
+        /// @param stream  Stream of which the first bytes are checked, the read position is restored afterwards
+        ///
+        /// @return True when the stream starts with the header of a binary form
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBinaryForm(std::istream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads a binary form and passes its contents to a visitor while reading it
+        ///
+        /// @param stream   Stream containing the binary form, opened in binary mode
+        /// @param visitor  Visitor that receives the sections and properties in the order in which they were written
+        ///
+        /// @throw Exception when the stream does not contain a valid binary form
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void parse(std::istream& stream, DataIO::Visitor& visitor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads a binary form
+        ///
+        /// @param stream  Stream containing the binary form, opened in binary mode
+        ///
+        /// @return Root node of the tree of nodes, like the one returned by DataIO::parse for the text format
+        ///
+        /// @throw Exception when the stream does not contain a valid binary form
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<DataIO::Node> parse(std::istream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes a tree of nodes as binary form
+        ///
+        /// @param rootNode  Root node of the tree of nodes, like the one passed to DataIO::emit
+        /// @param stream    Stream to write the binary form to, opened in binary mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emit(const DataIO::Node& rootNode, std::ostream& stream);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINARY_FORM_HPP
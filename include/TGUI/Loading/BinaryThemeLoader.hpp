@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BINARY_THEME_LOADER_HPP
+#define TGUI_BINARY_THEME_LOADER_HPP
+
+
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <ostream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Theme loader that can load precompiled binary theme files
+    ///
+    /// A binary theme is created from a normal theme file with the compile function or with the tgui-theme-compiler tool.
+    /// References between sections are already resolved in such a file and colors, numbers, outlines, text styles and the
+    /// filenames and rectangles of textures are stored as values that no longer have to be parsed. Loading a section thus
+    /// only requires decoding the textures that it uses.
+    ///
+    /// The file only contains offsets relative to the start of the file, so it can be used directly from memory.
+    /// Files that aren't binary themes are passed to the DefaultThemeLoader, so the loader can be set as theme loader
+    /// without breaking themes that haven't been compiled:
+    /// @code
+    /// tgui::Theme::setThemeLoader(std::make_shared<tgui::BinaryThemeLoader>());
+    /// tgui::Theme theme{"themes/Black.tgtheme"};
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BinaryThemeLoader : public DefaultThemeLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the theme file in cache
+        ///
+        /// @param filename  Filename of the binary or text theme file to load
+        ///
+        /// @exception Exception when the file is not a valid theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preload(const std::string& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the property-value pairs from the theme file as strings
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// For binary themes, the values are serialized again. Use loadProperties to get the values without conversion.
+        ///
+        /// @return Map of property-value pairs
+        ///
+        /// @exception Exception when file did not contain requested section
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Check if the requested property-value pairs are available
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Whether a map of property-value pairs is available
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool canLoad(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the properties of a section from the theme file
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// @return Map of lowercase property names and their values
+        ///
+        /// @exception Exception when file did not contain requested section or when a texture could not be loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadProperties(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a text theme file into a binary theme
+        ///
+        /// @param themeFilename  Filename of the text theme to compile
+        /// @param output         Stream to write the binary theme to, which should be opened in binary mode
+        ///
+        /// The filenames of textures and fonts are stored relative to the theme, so the binary theme should be placed in the
+        /// same directory as the text theme.
+        ///
+        /// @exception Exception when the theme file could not be loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compile(const std::string& themeFilename, std::ostream& output);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a text theme file into a binary theme file
+        ///
+        /// @param themeFilename   Filename of the text theme to compile
+        /// @param outputFilename  Filename of the binary theme to create
+        ///
+        /// @exception Exception when the theme file could not be loaded or the output file could not be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compile(const std::string& themeFilename, const std::string& outputFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Empties the caches and force files to be reloaded.
+        ///
+        /// @param filename  File to remove from cache.
+        ///                  If no filename is given, the entire cache is cleared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flushCache(const std::string& filename = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct ThemeFile;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the cached binary theme, or nullptr when the file is a text theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<ThemeFile> getThemeFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+        static std::map<std::string, std::shared_ptr<ThemeFile>> m_themeFiles;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BINARY_THEME_LOADER_HPP
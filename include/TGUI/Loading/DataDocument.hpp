@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DATA_DOCUMENT_HPP
+#define TGUI_DATA_DOCUMENT_HPP
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only tree of a parsed widget file
+    ///
+    /// This is an alternative to DataIO::parse for large files. All nodes are allocated from a single arena that is owned by
+    /// the document and the names and values in the nodes point directly into the parsed buffer instead of being copied.
+    /// Only names and values from which comments or whitespace had to be removed are copied into the arena. Values are
+    /// converted to sf::String when they are requested.
+    ///
+    /// The nodes contain the same information as the ones created by DataIO::parse, except that properties are kept in the
+    /// order in which they were found in the file.
+    /// @internal
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DataDocument
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Non-owning reference to a part of the parsed buffer or of the arena
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct StringView
+        {
+            const char* data = nullptr;
+            std::size_t size = 0;
+
+            bool empty() const
+            {
+                return size == 0;
+            }
+
+            std::string toString() const
+            {
+                return {data, size};
+            }
+
+            bool operator==(const std::string& other) const
+            {
+                return (other.size() == size) && (other.compare(0, size, data, size) == 0);
+            }
+
+            bool operator!=(const std::string& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Property in a node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ValueNode
+        {
+            StringView key; ///< Name of the property, in lowercase
+            StringView value;
+            ValueNode* next = nullptr;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the value as a string
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            sf::String getValue() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the value is a list (i.e. whether it is surrounded by square brackets)
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isList() const;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Splits a list value into its items
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::vector<StringView> getListItems() const;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Section in the widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Node
+        {
+            StringView name;
+            Node* parent = nullptr;
+            Node* firstChild = nullptr;
+            Node* lastChild = nullptr;
+            Node* nextSibling = nullptr;
+            ValueNode* firstProperty = nullptr;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Finds a property in this node
+            ///
+            /// @param key  Name of the property, in lowercase
+            ///
+            /// @return Property with the given name or nullptr when the node doesn't contain it
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const ValueNode* findProperty(const std::string& key) const;
+        };
+
+
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Contents of the widget file
+        /// @param size  Size of the data in bytes
+        ///
+        /// @return Parsed document
+        ///
+        /// @warning The data is not copied, it has to remain valid for as long as the document is used.
+        ///
+        /// @throw Exception when the data does not contain a valid widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<DataDocument> parse(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file and keeps its contents alive inside the document
+        ///
+        /// @param data  Contents of the widget file
+        ///
+        /// @return Parsed document
+        ///
+        /// @throw Exception when the data does not contain a valid widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<DataDocument> parse(std::string data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the root node, which contains the top-level sections and properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Node& getRoot() const
+        {
+            return *m_root;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies the document into a tree of nodes like the one returned by DataIO::parse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> toNodeTree() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of bytes that were reserved for the arena
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getArenaCapacity() const;
+
+
+        DataDocument(const DataDocument&) = delete;
+        DataDocument& operator=(const DataDocument&) = delete;
+
+
+    private:
+
+        DataDocument() = default;
+
+        void* allocate(std::size_t size);
+
+        template <typename T>
+        T* create()
+        {
+            return new (allocate(sizeof(T))) T{};
+        }
+
+        StringView storeString(const std::string& str);
+
+
+    private:
+
+        class Parser;
+
+        std::string m_buffer;
+        std::vector<std::pair<std::unique_ptr<char[]>, std::size_t>> m_blocks;
+        std::size_t m_blockUsed = 0;
+        Node* m_root = nullptr;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DATA_DOCUMENT_HPP
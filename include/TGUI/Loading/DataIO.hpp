@@ -31,6 +31,8 @@
 #include <TGUI/Config.hpp>
 #include <SFML/System/String.hpp>
 #include <sstream>
+#include <ostream>
+#include <istream>
 #include <memory>
 #include <vector>
 #include <string>
@@ -75,6 +77,77 @@ namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Receives the contents of a widget file while it is being parsed
+        ///
+        /// For every section, beginNode is called when its opening brace is found and endNode is called when it is closed.
+        /// Properties are passed to the property function when they are read and belong to the last section that was opened
+        /// and not yet closed, or to the root when there is no such section.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Visitor
+        {
+        public:
+            virtual ~Visitor() = default;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Called when a section starts
+            /// @param name  Name of the section, which is empty for sections without a name
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            virtual void beginNode(const std::string& name) = 0;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Called for every property
+            /// @param key    Name of the property, in lowercase
+            /// @param value  Value of the property
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            virtual void property(const std::string& key, std::unique_ptr<ValueNode> value) = 0;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Called when the last section that was started ends
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            virtual void endNode() = 0;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Visitor that writes the widget file directly to a stream
+        ///
+        /// The output is formatted in the same way as the one created by the emit function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Writer : public Visitor
+        {
+        public:
+            explicit Writer(std::ostream& stream);
+
+            void beginNode(const std::string& name) override;
+            void property(const std::string& key, std::unique_ptr<ValueNode> value) override;
+            void endNode() override;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a property to the section that is currently open
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void property(const std::string& key, const sf::String& value);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a node, including its properties and child nodes, inside the section that is currently open
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeNode(const Node& node);
+
+        private:
+            void writeIndentation(std::size_t level);
+            void separateChild();
+
+            struct Section
+            {
+                bool hasProperties = false;
+                bool hasChildren = false;
+            };
+
+            std::ostream& m_stream;
+            std::vector<Section> m_sections;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parses a widget file
         ///
@@ -86,6 +159,32 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file and passes its contents to a visitor while reading it
+        ///
+        /// @param stream   Stream containing the widget file
+        /// @param visitor  Visitor that receives the sections and properties in the order in which they are found
+        ///
+        /// The contents are read from the stream as they are needed, no tree of nodes is created.
+        /// When the input is invalid, an exception is thrown after the visitor received everything in front of the error.
+        /// Container::loadWidgetsFromStream only uses what its visitor collected once the whole file was parsed, so a
+        /// syntax error leaves the widgets of the container unchanged.
+        ///
+        /// @throw Exception when the stream does not contain a valid widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void parse(std::istream& stream, Visitor& visitor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Turns a value node into a list node when its value is written as a list
+        ///
+        /// @param valueNode  Value node of which the value is checked, the items are stored in its valueList
+        ///
+        /// Values like "[a, b]" are split in the same way as when parsing a widget file. Other values are left untouched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void parseList(ValueNode& valueNode);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -93,7 +192,7 @@ namespace tgui
         /// @param stream   Stream to which the widget file will be added
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+        static void emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,15 @@ namespace tgui
     public:
         static std::vector<std::string> split(const std::string& str, char delim);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Splits a serialized texture into its filename and optional parameters without loading the image
+        ///
+        /// Unlike when deserializing the texture, the resource path is not added in front of unquoted filenames.
+        ///
+        /// @exception Exception when the string contains syntax errors
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void parseTexture(const std::string& value, std::string& filename, sf::IntRect& partRect, sf::IntRect& middleRect, bool& smooth);
+
     private:
         static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;
     };
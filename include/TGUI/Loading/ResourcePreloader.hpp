@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RESOURCE_PRELOADER_HPP
+#define TGUI_RESOURCE_PRELOADER_HPP
+
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/ThreadPool.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Font.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Decodes the images and fonts that are used in a widget file on a thread pool before the widgets are created
+    ///
+    /// While the preloader exists, the TextureManager and the Deserializer use the decoded images and fonts instead of
+    /// loading the files themselves. Only the decoding happens on the worker threads, the textures are still created on the
+    /// thread that loads the widgets.
+    ///
+    /// The image loader (see Texture::setImageLoader) is called from the worker threads, so it has to be thread-safe.
+    /// A preloader must be created, used and destroyed on the thread that loads the widgets.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ResourcePreloader
+    {
+    public:
+
+        /// Resources that were requested by a call to preload and that may still be decoding
+        using PendingResources = std::vector<std::shared_future<void>>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param threadPool  Threads on which the resources are decoded, or nullptr to use the default thread pool
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit ResourcePreloader(priv::ThreadPool* threadPool = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /// Resources that were preloaded but never used are released.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ResourcePreloader();
+
+
+        ResourcePreloader(const ResourcePreloader&) = delete;
+        ResourcePreloader& operator=(const ResourcePreloader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts decoding all textures and fonts that are used by the properties of a node and its children
+        ///
+        /// @param node               Node that was read from a widget file
+        /// @param skipHiddenWidgets  Skip the child widgets of hidden containers, for when they are loaded lazily
+        ///
+        /// @return Resources that the node uses, including the ones that were already requested for other nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PendingResources preload(const DataIO::Node& node, bool skipHiddenWidgets = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts decoding an image
+        ///
+        /// @param filename  Filename of the image, as it will be passed to the TextureManager (i.e. including resource path)
+        ///
+        /// @return Future that becomes ready when the image has been decoded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<void> preloadImage(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading a font
+        ///
+        /// @param filename  Filename of the font, including the resource path
+        ///
+        /// @return Future that becomes ready when the font has been loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_future<void> preloadFont(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether all the given resources have finished decoding
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isReady(const PendingResources& resources);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Takes a copy of an image that was preloaded, waiting for it if it is still being decoded
+        ///
+        /// @param filename  Filename of the image
+        /// @param image     Set to a copy of the image, or to nullptr when the image failed to load
+        ///
+        /// @return False when no existing preloader was asked to preload the image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool findImage(const std::string& filename, std::unique_ptr<sf::Image>& image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a font that was preloaded, waiting for it if it is still being loaded
+        ///
+        /// @param filename  Filename of the font
+        /// @param font      Set to the font
+        ///
+        /// @return False when no existing preloader was asked to preload the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool findFont(const std::string& filename, std::shared_ptr<sf::Font>& font);
+
+
+    private:
+
+        void preloadNode(const DataIO::Node& node, PendingResources& resources, bool skipHiddenWidgets);
+
+        priv::ThreadPool& getThreadPool();
+
+        template <typename T>
+        struct Resource
+        {
+            std::shared_future<void> loaded;
+            std::shared_ptr<std::shared_ptr<T>> value; // Only accessed by the worker thread until the future is ready
+        };
+
+        priv::ThreadPool* m_threadPool;
+        std::map<std::string, Resource<sf::Image>> m_images;
+        std::map<std::string, Resource<sf::Font>> m_fonts;
+
+        static std::vector<ResourcePreloader*> m_preloaders;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RESOURCE_PRELOADER_HPP
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -85,6 +86,20 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the properties from the theme as values that can be stored in a renderer
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation wraps the strings returned by the load function, which are only deserialized when the
+        /// renderer needs them. Loaders that already know the type of the values can return them deserialized instead.
+        ///
+        /// @return Map of lowercase property names and their values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::map<std::string, ObjectConverter> loadProperties(const std::string& primary, const std::string& secondary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -136,6 +151,33 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the properties of a section from the theme file as values that can be stored in a renderer
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Nested sections and references to other sections are returned as renderer data. Every section is only parsed
+        /// once per theme file, sections that refer to the same section share its data.
+        ///
+        /// @return Map of lowercase property names and their values
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::map<std::string, ObjectConverter> loadProperties(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the lowercase names of all sections in the theme file
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::string> getSectionNames(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -161,6 +203,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> m_rendererCache;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
     };
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_POSTED_FUNCTION_QUEUE_HPP
+#define TGUI_POSTED_FUNCTION_QUEUE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <atomic>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Queue to which any thread can add functions that are later executed on the thread that owns the gui.
+        // Adding functions is lock-free, processing them may only be done by a single thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API PostedFunctionQueue
+        {
+        public:
+
+            PostedFunctionQueue();
+            ~PostedFunctionQueue();
+
+            PostedFunctionQueue(const PostedFunctionQueue&) = delete;
+            PostedFunctionQueue& operator=(const PostedFunctionQueue&) = delete;
+
+            // Adds a function to the queue, this may be called from any thread.
+            // When a key is given, the function replaces any function with the same key that hasn't been executed yet.
+            void push(std::function<void()> function, const void* key = nullptr);
+
+            // Executes the queued functions in the order in which they were added. Must only be called from a single thread.
+            // When a time budget is given, functions that don't fit in it remain in the queue until the next call.
+            void process(sf::Time timeBudget);
+
+            // Returns whether there are functions that still have to be executed. Must only be called from the processing thread.
+            bool empty() const;
+
+        private:
+
+            struct Node
+            {
+                std::atomic<Node*> next{nullptr};
+                std::function<void()> function;
+                const void* key = nullptr;
+            };
+
+            struct PendingFunction
+            {
+                std::function<void()> function;
+                const void* key;
+            };
+
+            // Moves all functions that were pushed by other threads into m_pending
+            void collectPushedFunctions();
+
+            // Removes the oldest node from the lock-free part of the queue
+            Node* popNode();
+
+            // Inserts a node in the lock-free part of the queue
+            void pushNode(Node* node);
+
+        private:
+
+            // Multiple-producer single-consumer intrusive linked list. Producers only touch m_head, the consumer owns m_tail.
+            std::atomic<Node*> m_head;
+            Node* m_tail;
+            Node m_stub;
+
+            // Functions that were taken from the linked list but not yet executed, only accessed from the processing thread
+            std::deque<PendingFunction> m_pending;
+            std::unordered_map<const void*, std::uint64_t> m_pendingKeys; // Maps key on the sequence number of the pending function
+            std::uint64_t m_frontSequenceNumber = 0;
+
+            bool m_processing = false;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_POSTED_FUNCTION_QUEUE_HPP
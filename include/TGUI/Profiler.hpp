@@ -0,0 +1,238 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/Time.hpp>
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace sf
+{
+    class Shape;
+    class Sprite;
+    class Text;
+    class Texture;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about a single frame, as collected by the profiler of the gui
+    ///
+    /// A frame starts after a call to Gui::draw and ends at the end of the next call to Gui::draw.
+    ///
+    /// @see Gui::setProfilingEnabled
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API FrameStatistics
+    {
+        /// Time spent in a function and the amount of times it was called
+        struct Timing
+        {
+            sf::Time time;        ///< Total time spent in the function
+            sf::Time selfTime;    ///< Time spent in the function, excluding the time spent in the same function of child widgets
+            std::size_t count = 0;
+        };
+
+        /// Timings of all widgets with the same type
+        struct WidgetTypeStatistics
+        {
+            Timing draw;
+            Timing update;
+            Timing rendererChanged;
+        };
+
+        sf::Time eventTime;  ///< Time spent in Gui::handleEvent
+        sf::Time updateTime; ///< Time spent in Gui::updateTime
+        sf::Time drawTime;   ///< Time spent in Gui::draw, excluding the time spent in the updateTime call made from it
+        std::size_t events = 0;
+
+        std::size_t drawCalls = 0;
+        std::size_t vertices = 0;     ///< For texts this is an estimate based on the amount of visible characters
+        std::size_t textureBinds = 0; ///< Amount of draw calls that used a different texture than the previous draw call
+        std::size_t clipChanges = 0;  ///< Amount of times a clipping area was applied
+
+        std::map<std::string, WidgetTypeStatistics> widgetTypes; ///< Statistics per widget type
+    };
+
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Collects the frame statistics and trace events of a gui.
+        //
+        // The instrumentation hooks don't know to which gui a widget belongs. They report to the active profiler instead,
+        // which is the profiler of the gui that most recently called handleEvent, updateTime or draw with profiling enabled.
+        // The hooks are only compiled in when TGUI_ENABLE_PROFILER is defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Profiler
+        {
+        public:
+
+            enum class ScopeKind
+            {
+                HandleEvent,
+                UpdateTime,
+                Draw,
+                WidgetDraw,
+                WidgetUpdate,
+                WidgetRendererChanged
+            };
+
+            Profiler() = default;
+            ~Profiler();
+
+            Profiler(const Profiler&) = delete;
+            Profiler& operator=(const Profiler&) = delete;
+
+            void setEnabled(bool enabled);
+            bool isEnabled() const;
+
+            // Makes this the profiler to which the hooks report, when it is enabled
+            void activate();
+
+            const FrameStatistics& getFrameStatistics() const;
+
+            void startTrace();
+            bool isTracing() const;
+
+            // Writes the recorded events in the Chrome trace event format and stops recording
+            void stopTrace(std::ostream& stream);
+
+            // Returns the profiler to which the hooks should report, or a nullptr when nothing has to be recorded
+            static Profiler* getActive();
+
+            static void countDrawCall(std::size_t vertexCount, const sf::Texture* texture);
+            static void countDrawCall(const sf::Shape& shape);
+            static void countDrawCall(const sf::Sprite& sprite);
+            static void countDrawCall(const sf::Text& text);
+            static void countClipChange();
+
+        private:
+
+            friend class ProfileScope;
+
+            using Clock = std::chrono::steady_clock;
+
+            struct OpenScope
+            {
+                ScopeKind kind;
+                Clock::time_point start;
+                Clock::duration childTime; // Time spent in nested scopes that are excluded from the self time
+            };
+
+            struct TraceEvent
+            {
+                ScopeKind kind;
+                std::string widgetType;
+                Clock::time_point start;
+                Clock::duration duration;
+            };
+
+            struct TraceCounters
+            {
+                Clock::time_point time;
+                std::size_t drawCalls;
+                std::size_t vertices;
+                std::size_t textureBinds;
+                std::size_t clipChanges;
+            };
+
+            void beginScope(ScopeKind kind);
+            void endScope(const std::string* widgetType);
+
+            // Moves the statistics that were collected since the end of the previous frame to the completed frame
+            void finishFrame();
+
+        private:
+
+            static Profiler* m_activeProfiler;
+
+            bool m_enabled = false;
+            bool m_tracing = false;
+
+            FrameStatistics m_currentFrame;
+            FrameStatistics m_completedFrame;
+            const sf::Texture* m_lastTexture = nullptr;
+
+            std::vector<OpenScope> m_openScopes;
+            std::vector<TraceEvent> m_traceEvents;
+            std::vector<TraceCounters> m_traceCounters;
+            Clock::time_point m_traceStart;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Measures the time between its construction and destruction and reports it to the active profiler
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ProfileScope
+        {
+        public:
+
+            // The widget type is only used for widget scopes and must stay alive until the scope is destroyed
+            ProfileScope(Profiler::ScopeKind kind, const std::string* widgetType = nullptr);
+            ~ProfileScope();
+
+            ProfileScope(const ProfileScope&) = delete;
+            ProfileScope& operator=(const ProfileScope&) = delete;
+
+        private:
+
+            Profiler* m_profiler;
+            const std::string* m_widgetType;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef TGUI_ENABLE_PROFILER
+    #define TGUI_PROFILE_GUI_SCOPE(kind) \
+        const tgui::priv::ProfileScope tguiProfileScope{tgui::priv::Profiler::ScopeKind::kind}
+
+    #define TGUI_PROFILE_WIDGET_SCOPE(kind, widget) \
+        const tgui::priv::ProfileScope tguiProfileScope{tgui::priv::Profiler::ScopeKind::Widget##kind, &(widget).getWidgetType()}
+
+    #define TGUI_PROFILE_DRAW_CALL(...) tgui::priv::Profiler::countDrawCall(__VA_ARGS__)
+    #define TGUI_PROFILE_CLIP_CHANGE() tgui::priv::Profiler::countClipChange()
+#else
+    #define TGUI_PROFILE_GUI_SCOPE(kind)
+    #define TGUI_PROFILE_WIDGET_SCOPE(kind, widget)
+    #define TGUI_PROFILE_DRAW_CALL(...)
+    #define TGUI_PROFILE_CLIP_CHANGE()
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -0,0 +1,391 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROPERTY_TABLE_HPP
+#define TGUI_PROPERTY_TABLE_HPP
+
+#include <TGUI/ObjectConverter.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Number that uniquely identifies the name of a renderer property
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using PropertyId = std::uint32_t;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// All properties that are used by the renderers of the widgets, sorted on their lowercase name, with the type of their value.
+// The ids of these properties are known at compile time, other property names get an id when they are first used.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define TGUI_RENDERER_PROPERTIES(PROPERTY) \
+    PROPERTY(ArrowBackgroundColor, Color) \
+    PROPERTY(ArrowBackgroundColorHover, Color) \
+    PROPERTY(ArrowColor, Color) \
+    PROPERTY(ArrowColorHover, Color) \
+    PROPERTY(BackgroundColor, Color) \
+    PROPERTY(BackgroundColorChecked, Color) \
+    PROPERTY(BackgroundColorCheckedDisabled, Color) \
+    PROPERTY(BackgroundColorCheckedHover, Color) \
+    PROPERTY(BackgroundColorDisabled, Color) \
+    PROPERTY(BackgroundColorDown, Color) \
+    PROPERTY(BackgroundColorFocused, Color) \
+    PROPERTY(BackgroundColorHover, Color) \
+    PROPERTY(BorderBelowTitleBar, Number) \
+    PROPERTY(BorderBetweenArrows, Number) \
+    PROPERTY(BorderColor, Color) \
+    PROPERTY(BorderColorChecked, Color) \
+    PROPERTY(BorderColorCheckedDisabled, Color) \
+    PROPERTY(BorderColorCheckedFocused, Color) \
+    PROPERTY(BorderColorCheckedHover, Color) \
+    PROPERTY(BorderColorDisabled, Color) \
+    PROPERTY(BorderColorDown, Color) \
+    PROPERTY(BorderColorFocused, Color) \
+    PROPERTY(BorderColorHover, Color) \
+    PROPERTY(Borders, Outline) \
+    PROPERTY(Button, RendererData) \
+    PROPERTY(CaretColor, Color) \
+    PROPERTY(CaretColorFocused, Color) \
+    PROPERTY(CaretColorHover, Color) \
+    PROPERTY(CaretWidth, Number) \
+    PROPERTY(CheckColor, Color) \
+    PROPERTY(CheckColorDisabled, Color) \
+    PROPERTY(CheckColorHover, Color) \
+    PROPERTY(CloseButton, RendererData) \
+    PROPERTY(DefaultTextColor, Color) \
+    PROPERTY(DefaultTextStyle, TextStyle) \
+    PROPERTY(DistanceToSide, Number) \
+    PROPERTY(FillColor, Color) \
+    PROPERTY(Font, Font) \
+    PROPERTY(ImageRotation, Number) \
+    PROPERTY(ListBox, RendererData) \
+    PROPERTY(MaximizeButton, RendererData) \
+    PROPERTY(MinimizeButton, RendererData) \
+    PROPERTY(MinimumResizableBorderWidth, Number) \
+    PROPERTY(Opacity, Number) \
+    PROPERTY(Padding, Outline) \
+    PROPERTY(PaddingBetweenButtons, Number) \
+    PROPERTY(Scrollbar, RendererData) \
+    PROPERTY(ScrollbarWidth, Number) \
+    PROPERTY(SelectedBackgroundColor, Color) \
+    PROPERTY(SelectedBackgroundColorHover, Color) \
+    PROPERTY(SelectedTextBackgroundColor, Color) \
+    PROPERTY(SelectedTextColor, Color) \
+    PROPERTY(SelectedTextColorHover, Color) \
+    PROPERTY(SelectedTextStyle, TextStyle) \
+    PROPERTY(SelectedTrackColor, Color) \
+    PROPERTY(SelectedTrackColorHover, Color) \
+    PROPERTY(ShowTextOnTitleButtons, Bool) \
+    PROPERTY(SpaceBetweenWidgets, Number) \
+    PROPERTY(TextColor, Color) \
+    PROPERTY(TextColorChecked, Color) \
+    PROPERTY(TextColorCheckedDisabled, Color) \
+    PROPERTY(TextColorCheckedHover, Color) \
+    PROPERTY(TextColorDisabled, Color) \
+    PROPERTY(TextColorDown, Color) \
+    PROPERTY(TextColorFilled, Color) \
+    PROPERTY(TextColorFocused, Color) \
+    PROPERTY(TextColorHover, Color) \
+    PROPERTY(TextDistanceRatio, Number) \
+    PROPERTY(TextStyle, TextStyle) \
+    PROPERTY(TextStyleChecked, TextStyle) \
+    PROPERTY(TextStyleDisabled, TextStyle) \
+    PROPERTY(TextStyleDown, TextStyle) \
+    PROPERTY(TextStyleFocused, TextStyle) \
+    PROPERTY(TextStyleHover, TextStyle) \
+    PROPERTY(Texture, Texture) \
+    PROPERTY(TextureArrow, Texture) \
+    PROPERTY(TextureArrowDown, Texture) \
+    PROPERTY(TextureArrowDownHover, Texture) \
+    PROPERTY(TextureArrowHover, Texture) \
+    PROPERTY(TextureArrowUp, Texture) \
+    PROPERTY(TextureArrowUpHover, Texture) \
+    PROPERTY(TextureBackground, Texture) \
+    PROPERTY(TextureChecked, Texture) \
+    PROPERTY(TextureCheckedDisabled, Texture) \
+    PROPERTY(TextureCheckedFocused, Texture) \
+    PROPERTY(TextureCheckedHover, Texture) \
+    PROPERTY(TextureDisabled, Texture) \
+    PROPERTY(TextureDisabledTab, Texture) \
+    PROPERTY(TextureDown, Texture) \
+    PROPERTY(TextureFill, Texture) \
+    PROPERTY(TextureFocused, Texture) \
+    PROPERTY(TextureForeground, Texture) \
+    PROPERTY(TextureHover, Texture) \
+    PROPERTY(TextureItemBackground, Texture) \
+    PROPERTY(TextureSelectedItemBackground, Texture) \
+    PROPERTY(TextureSelectedTab, Texture) \
+    PROPERTY(TextureSelectedTabHover, Texture) \
+    PROPERTY(TextureTab, Texture) \
+    PROPERTY(TextureTabHover, Texture) \
+    PROPERTY(TextureThumb, Texture) \
+    PROPERTY(TextureThumbHover, Texture) \
+    PROPERTY(TextureTitleBar, Texture) \
+    PROPERTY(TextureTrack, Texture) \
+    PROPERTY(TextureTrackHover, Texture) \
+    PROPERTY(TextureUnchecked, Texture) \
+    PROPERTY(TextureUncheckedDisabled, Texture) \
+    PROPERTY(TextureUncheckedFocused, Texture) \
+    PROPERTY(TextureUncheckedHover, Texture) \
+    PROPERTY(ThumbColor, Color) \
+    PROPERTY(ThumbColorHover, Color) \
+    PROPERTY(TitleBarColor, Color) \
+    PROPERTY(TitleBarHeight, Number) \
+    PROPERTY(TitleColor, Color) \
+    PROPERTY(TrackColor, Color) \
+    PROPERTY(TrackColorHover, Color) \
+    PROPERTY(TransparentTexture, Bool)
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Ids of the properties that are used by the renderers of the widgets
+    ///
+    /// Property::TextColor is for example the id of the "textcolor" property.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace Property
+    {
+        enum : PropertyId
+        {
+        #define TGUI_PROPERTY_ENUM_VALUE(NAME, TYPE) NAME,
+            TGUI_RENDERER_PROPERTIES(TGUI_PROPERTY_ENUM_VALUE)
+        #undef TGUI_PROPERTY_ENUM_VALUE
+
+            BuiltinPropertyCount ///< Amount of predefined property ids, other names get an id after these
+        };
+    }
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the id of a property name, the name is registered when it wasn't used before
+        ///
+        /// Names are case-sensitive, renderer properties are always stored with lowercase names.
+        /// This function may be called from multiple threads.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API PropertyId internPropertyName(const std::string& name);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the name that was registered for the given property id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API const std::string& getPropertyName(PropertyId id);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the type of the value that the renderers expect for a property
+        ///
+        /// @return Type of the property, or ObjectConverter::Type::None when the id isn't one of the predefined properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API ObjectConverter::Type getPropertyType(PropertyId id);
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Stores the properties of a renderer
+    ///
+    /// The properties can be accessed by name like in a std::map, the names are iterated in sorted order.
+    /// Renderers look up their properties by interned PropertyId instead, which only requires a binary search in a small
+    /// contiguous array instead of creating a lowercase string and comparing it with the names in the map.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyTable
+    {
+    public:
+
+        using Map = std::map<std::string, ObjectConverter>;
+        using iterator = Map::iterator;
+        using const_iterator = Map::const_iterator;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the table from property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable(const Map& properties);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable(const PropertyTable& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable(PropertyTable&& other) = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable& operator=(const PropertyTable& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable& operator=(PropertyTable&& other) = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyTable& operator=(const Map& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, which is inserted when it didn't exist yet
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Reference to the value, which remains valid until the property is erased
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const std::string& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, which is inserted when it didn't exist yet
+        ///
+        /// @param id  Id of the property name
+        ///
+        /// @return Reference to the value, which remains valid until the property is erased
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](PropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property
+        ///
+        /// @param id  Id of the property name
+        ///
+        /// @return Pointer to the value or a nullptr when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter* get(PropertyId id);
+        const ObjectConverter* get(PropertyId id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property by name
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Iterator to the property-value pair or end() when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(const std::string& property);
+        const_iterator find(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties with the given name (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t count(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Amount of removed properties (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(const std::string& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the property at the given position
+        ///
+        /// @return Iterator to the property behind the removed one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties in the table
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the table contains no properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Iterators over the property-value pairs, sorted by name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the property-value pairs as a map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Map& getMap() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the ids of all properties together with a pointer to their value, sorted on id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::pair<PropertyId, ObjectConverter*>>& getIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds a property that was just inserted in the map to the index
+        void addToIndex(PropertyId id, ObjectConverter* value);
+
+        // Removes a property from the index before it gets erased from the map
+        void removeFromIndex(const std::string& property);
+
+        // Recreates the index after the map was replaced
+        void rebuildIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The map owns the values, so that references to them stay valid when other properties are added
+        Map m_properties;
+
+        // Flat index that maps property ids to the values in the map, sorted on id
+        std::vector<std::pair<PropertyId, ObjectConverter*>> m_index;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_TABLE_HPP
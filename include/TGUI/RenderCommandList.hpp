@@ -0,0 +1,289 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDER_COMMAND_LIST_HPP
+#define TGUI_RENDER_COMMAND_LIST_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace sf
+{
+    class RenderTarget;
+    class Shape;
+    class Sprite;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Single operation in a RenderCommandList
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API RenderCommand
+    {
+        enum class Type
+        {
+            Vertices, ///< Draws vertices from RenderCommandList::getVertices
+            Text,     ///< Draws a text from RenderCommandList::getText
+            PushClip, ///< Restricts the commands until the matching PopClip to a rectangle
+            PopClip   ///< Restores the clipping area that was active before the matching PushClip
+        };
+
+        Type type;
+        sf::RenderStates states; ///< Transform, texture, shader and blend mode, the texture pointer identifies the texture
+
+        sf::PrimitiveType primitiveType = sf::PrimitiveType::Triangles; ///< Type of the vertices (Vertices only)
+        std::size_t first = 0; ///< Index of the first vertex or of the text (Vertices and Text only)
+        std::size_t count = 0; ///< Amount of vertices (Vertices only)
+
+        FloatRect clipRect; ///< Clipping area before being transformed by the states (PushClip only)
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief List of the draw calls that are needed to draw widgets
+    ///
+    /// Gui::draw first records the widgets into a command list and then draws the list on the render target.
+    /// A list can also be recorded without any render target with Gui::draw(RenderCommandList&), which makes it possible to
+    /// inspect what would be drawn on machines without a graphics card (e.g. to check the amount of draw calls in tests).
+    ///
+    /// Drawing the list on an sf::RenderTarget executes the commands in the same way as drawing the widgets directly would.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderCommandList : public sf::Drawable
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all commands
+        ///
+        /// The memory of the list is kept so that recording the next frame doesn't need to allocate again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds vertices to the list
+        ///
+        /// @param vertices  Pointer to the vertices
+        /// @param count     Amount of vertices
+        /// @param type      Type of primitives to draw
+        /// @param states    Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addVertices(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the geometry of a shape to the list
+        ///
+        /// @param shape   Rectangle, circle or convex shape
+        /// @param states  Render states to use for drawing
+        ///
+        /// The inside and the outline of the shape are added as separate commands, just like sfml draws them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addShape(const sf::Shape& shape, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a text to the list
+        ///
+        /// @param text    Text to draw, the font has to stay alive while the list is being used
+        /// @param states  Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const sf::Text& text, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restricts the next commands to a rectangle, until popClip is called
+        ///
+        /// @param states   Render states of which the transform is applied to the rectangle
+        /// @param topLeft  Position of the top left corner of the clipping area
+        /// @param size     Size of the clipping area
+        ///
+        /// The clipping area is intersected with the clipping area that was already active.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushClip(const sf::RenderStates& states, Vector2f topLeft, Vector2f size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the clipping area that was active before the last pushClip call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void popClip();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Appends all commands of another list to this list
+        ///
+        /// @param commands  List to copy the commands from
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void append(const RenderCommandList& commands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded commands
+        ///
+        /// @return Commands in the order in which they have to be executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<RenderCommand>& getCommands() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertices that are used by the Vertices commands
+        ///
+        /// @return Vertices of all commands, before being transformed by the states of the command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vertex>& getVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of texts that are used by the Text commands
+        ///
+        /// @return Amount of Text commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTextCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a text that is used by a Text command
+        ///
+        /// @param index  Index of the text, which is stored in the first member of the command
+        ///
+        /// @return Text before being transformed by the states of the command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Text& getText(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many draw calls are needed to draw the list
+        ///
+        /// @return Amount of Vertices and Text commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the total area that is covered by all draw calls
+        ///
+        /// @return Sum of the visible area of every triangle and text, after clipping
+        ///
+        /// Pixels that are drawn multiple times are counted multiple times, so dividing this value by the size of the view gives
+        /// the average overdraw. Texts are counted by their bounding rectangle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getDrawnArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Executes the commands on an sfml render target. The states are combined with the states of each command.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds a command that draws vertices that were already added to the list
+        void addCommand(std::size_t first, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<RenderCommand> m_commands;
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<sf::Text> m_texts; // Only the first m_textCount texts are used, the rest is kept to reuse their memory
+        std::size_t m_textCount = 0;
+    };
+
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // While this object exists, everything that widgets draw on this thread is added to the command list instead of being
+        // drawn on the render target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API RenderCommandRecorder
+        {
+        public:
+
+            explicit RenderCommandRecorder(RenderCommandList& commands);
+            ~RenderCommandRecorder();
+
+            RenderCommandRecorder(const RenderCommandRecorder&) = delete;
+            RenderCommandRecorder& operator=(const RenderCommandRecorder&) = delete;
+
+            // Returns the list that is being recorded on this thread, or a nullptr when drawing directly on the target
+            static RenderCommandList* getCommandList();
+
+            // Returns a render target that can be passed to widgets while recording, nothing may be drawn on it
+            static sf::RenderTarget& getRecordingTarget();
+
+        private:
+
+            RenderCommandList* m_previousCommands;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // While this object exists, widgets may be recorded on several threads at once. Code that isn't thread-safe by itself
+        // (e.g. looking up glyphs in a font) only has to be protected by a lock while this is the case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ParallelRecordingScope
+        {
+        public:
+
+            ParallelRecordingScope();
+            ~ParallelRecordingScope();
+
+            ParallelRecordingScope(const ParallelRecordingScope&) = delete;
+            ParallelRecordingScope& operator=(const ParallelRecordingScope&) = delete;
+
+            // Returns whether widgets are being recorded on several threads at the moment
+            static bool isActive();
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions used by widgets to draw, which add the draw call to the command list that is being recorded on this thread
+        // or otherwise draw directly on the target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API void drawOrRecord(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states);
+        TGUI_API void drawOrRecord(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states);
+        TGUI_API void drawOrRecord(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states);
+        TGUI_API void drawOrRecord(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_COMMAND_LIST_HPP
@@ -28,21 +28,22 @@
 
 
 #include <TGUI/Loading/Theme.hpp>
+#include <TGUI/PropertyTable.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
     void CLASS::set##NAME(const Outline& outline) \
     { \
-        setProperty(toLower(#NAME), {outline}); \
+        setProperty(Property::NAME, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,15 +51,15 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(Color color) \
     { \
-        setProperty(toLower(#NAME), {color}); \
+        setProperty(Property::NAME, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,15 +67,15 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(TextStyle style) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{style}); \
+        setProperty(Property::NAME, ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +83,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -93,7 +94,7 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{number}); \
+        setProperty(Property::NAME, ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,9 +102,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -112,7 +113,7 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{flag}); \
+        setProperty(Property::NAME, ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,18 +121,20 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTexture(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
+            /* Stored in the root data, so that an override keeps inheriting the property when the base data changes it */ \
+            ObjectConverter& storedValue = m_data->getRoot().propertyValuePairs[Property::NAME]; \
+            storedValue = {Texture{}}; \
+            return storedValue.getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const Texture& texture) \
     { \
-        setProperty(toLower(#NAME), {texture}); \
+        setProperty(Property::NAME, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,19 +142,20 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        ObjectConverter* value = m_data->findProperty(Property::NAME); \
+        if (value) \
+            return value->getRenderer(); \
         else \
         { \
+            /* Stored in the root data, so that an override keeps inheriting the property when the base data changes it */ \
             auto renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            m_data->getRoot().propertyValuePairs[Property::NAME] = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<RendererData> renderer) \
     { \
-        setProperty(toLower(#NAME), {renderer}); \
+        setProperty(Property::NAME, {renderer}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
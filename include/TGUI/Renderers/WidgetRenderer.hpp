@@ -29,6 +29,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyTable.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,9 +39,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    struct RendererData
+    struct TGUI_API RendererData
     {
         RendererData() = default;
+        RendererData(const RendererData&) = default;
+        RendererData& operator=(const RendererData&) = default;
+        ~RendererData();
 
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
@@ -68,8 +72,47 @@ namespace tgui
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        /// @brief Creates renderer data that only stores the properties that are changed and uses the values from
+        ///        the base data for all other properties
+        ///
+        /// Changes to the base data are passed on to the observers of the new data, unless the property is overridden.
+        static std::shared_ptr<RendererData> createOverride(const std::shared_ptr<RendererData>& base);
+
+        /// @brief Returns the value of a property, or the value in the base data when the property isn't overridden
+        ///
+        /// @return Pointer to the value, or nullptr when neither this data nor its base data contains the property
+        ObjectConverter* findProperty(PropertyId property);
+
+        /// @brief Returns the value of a lowercase property, or the value in the base data when the property isn't overridden
+        ObjectConverter* findProperty(const std::string& property);
+
+        /// @brief Returns the data at the end of the chain of base data, which is this data itself when it has no base
+        RendererData& getRoot();
+
+        /// @brief Returns all properties, including the ones that are only found in the base data
+        std::map<std::string, ObjectConverter> getAllProperties() const;
+
+        /// @brief Returns the sorted ids of all properties, including the ones that are only found in the base data
+        std::vector<PropertyId> getAllPropertyIds() const;
+
+        /// @brief Starts a batch of changes, observers will only be notified once endUpdate is called
+        ///
+        /// Calls can be nested, the observers are notified when the outermost batch ends.
+        void beginUpdate();
+
+        /// @brief Ends a batch of changes that was started with beginUpdate
+        ///
+        /// Every observer is called once with all the properties that changed during the batch.
+        void endUpdate();
+
+        /// @brief Tells the observers that a property changed, or remembers it when inside a batch of changes
+        void propertyChanged(PropertyId property);
+
+        PropertyTable propertyValuePairs;
+        std::map<const void*, std::function<void(const std::vector<PropertyId>& properties)>> observers;
+        std::vector<PropertyId> changedProperties; ///< Properties that changed since the batch of changes started
+        std::shared_ptr<RendererData> base; ///< Data with the values of the properties that aren't stored in propertyValuePairs
+        unsigned int updateDepth = 0;
         bool shared = true;
     };
 
@@ -178,6 +221,17 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param id     Id of the lowercase property name, as returned by priv::internPropertyName
+        /// @param value  The new value that you like to assign to the property
+        ///
+        /// This function is used by the setters of the renderers to avoid converting the name of the property to lowercase.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(PropertyId id, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -196,14 +250,35 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        std::map<std::string, ObjectConverter> getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Subscribes a callback function to changes in the renderer
         ///
         /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
-        /// @param function Callback function to call when the renderer changes
+        /// @param function Callback function to call with the id of the changed property when the renderer changes
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribe(const void* id, const std::function<void(PropertyId property)>& function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Subscribes a callback function to changes in the renderer
+        ///
+        /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
+        /// @param function Callback function to call with the ids of the changed properties when the renderer changes
+        ///
+        /// The ids are sorted and each property is only passed once, even when it was changed several times during an update.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribe(const void* id, const std::function<void(const std::vector<PropertyId>& properties)>& function);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Subscribes a callback function to changes in the renderer
+        ///
+        /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
+        /// @param function Callback function to call with the lowercase name of the changed property when the renderer changes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
@@ -218,6 +293,30 @@ namespace tgui
         void unsubscribe(const void* id);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a batch of property changes
+        ///
+        /// While updating, changing a property does not notify the widgets using the renderer. Instead they are notified
+        /// only once, with all changed properties, when endUpdate is called. Calls to beginUpdate and endUpdate can be nested.
+        ///
+        /// @code
+        /// renderer->beginUpdate();
+        /// renderer->setTextColor(sf::Color::Red);
+        /// renderer->setBorders(2);
+        /// renderer->endUpdate(); // Widgets are informed about both properties at once
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch of property changes that was started with beginUpdate
+        ///
+        /// @throw Exception when a widget using this renderer doesn't know one of the properties that were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Directly change all the data of this renderer
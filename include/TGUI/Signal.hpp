@@ -36,7 +36,6 @@
 #include <typeindex>
 #include <memory>
 #include <vector>
-#include <deque>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +48,11 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        /// Pointers to the values passed to the emit function, the first element always points to the widget that emitted the signal
+        using Parameters = const void* const*;
+
+        /// Extracts the widget that emitted the signal from the parameters
+        TGUI_API std::shared_ptr<Widget> getWidget(Parameters parameters);
     }
 
 
@@ -62,22 +65,23 @@ namespace tgui
 
         using Delegate = std::function<void()>;
         using DelegateEx = std::function<void(std::shared_ptr<Widget>, const std::string&)>;
+        using DelegateImpl = std::function<void(internal_signal::Parameters)>;
 
 
-        virtual ~Signal() = default;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~Signal();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
+        Signal(std::string&& name) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
         }
 
 
@@ -88,9 +92,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move constructor
+        /// @brief Move constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(Signal&& other) = default;
+        Signal(Signal&& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,9 +104,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move assignment operator
+        /// @brief Move assignment operator
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& operator=(Signal&& other) = default;
+        Signal& operator=(Signal&& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +129,17 @@ namespace tgui
         unsigned int connect(const DelegateEx& handler);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a signal handler that directly receives pointers to the values that are emitted
+        ///
+        /// @param handler  Callback function that is given the emitted parameters
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectImpl(DelegateImpl handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect a signal handler from this signal
         ///
@@ -150,17 +165,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
+            return emitImpl(widget);
         }
 
 
@@ -188,16 +193,52 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Extracts the widget stored in the first parameter
+        /// @brief Calls all connected signal handlers with the given values
+        ///
+        /// The values are passed to the handlers via an array on the stack, so emitting a signal never allocates memory.
+        ///
+        /// @return True when at least one signal handler was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename... Args>
+        bool emitImpl(const Widget* widget, const Args&... args)
+        {
+            if (m_handlers.empty())
+                return false;
+
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&args)...};
+            callHandlers(parameters);
+            return true;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Calls the handlers that were connected at the moment the signal was emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void callHandlers(internal_signal::Parameters parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Moves the handlers of another signal into this one, also when one of the signals is currently emitting
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static std::shared_ptr<Widget> getWidget();
+        void takeHandlers(Signal& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id;
+            std::shared_ptr<DelegateImpl> func; // Shared so that a handler stays alive when the signal is destroyed while calling it
+        };
+
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::vector<Handler> m_handlers;
+
+        bool* m_destroyedWhileEmitting = nullptr; // Only set while the handlers are being called
+        bool m_handlersRemovedWhileEmitting = false;
     };
 
 #ifdef TGUI_REMOVE_DEPRECATED_CODE
@@ -212,7 +253,7 @@ namespace tgui
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -222,11 +263,7 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            return emitImpl(widget, param); \
         } \
         \
     private: \
@@ -253,7 +290,7 @@ namespace tgui
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -281,11 +318,7 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            return emitImpl(widget, param); \
         } \
         \
     private: \
@@ -323,7 +356,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalRange(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -386,7 +419,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalChildWindow(std::string&& name) :
-            Signal{std::move(name), 1}
+            Signal{std::move(name)}
         {
         }
 
@@ -451,7 +484,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -502,12 +535,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            return Signal::emit(widget);
+            return emitImpl(widget, item, id);
         }
 
 
@@ -541,7 +569,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalAnimation(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -551,12 +579,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&type);
-            internal_signal::parameters[2] = static_cast<const void*>(&visible);
-            return Signal::emit(widget);
+            return emitImpl(widget, type, visible);
         }
 
 
@@ -593,7 +616,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalMenuItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -644,12 +667,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            return emitImpl(widget, item, fullItem);
         }
 
 
@@ -122,19 +122,19 @@ namespace tgui
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #if defined TGUI_USE_CPP17
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=,signalName=signal.getName()](Parameters parameters) {
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                 args...,
-                                widget,
+                                getWidget(parameters),
                                 signalName,
-                                internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                                internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset,signalName=signal.getName()](Parameters parameters) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               widget,
+                               getWidget(parameters),
                                signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -156,15 +156,16 @@ namespace tgui
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #if defined TGUI_USE_CPP17
-                return [=]{
+                return [=]([[maybe_unused]] Parameters parameters) {
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset]{ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset](Parameters parameters) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                    (void)parameters; // Unused when there are no unbound parameters
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -286,12 +287,12 @@ namespace tgui
                    && !std::is_function_v<Func>)
         {
             // Reference to function, all parameters bound
-            id = signal.connect([=, f=std::function<void(const BoundArgs&...)>(handler)]{ std::invoke(f, args...); });
+            id = signal.connectImpl([=, f=std::function<void(const BoundArgs&...)>(handler)](internal_signal::Parameters){ std::invoke(f, args...); });
         }
         else if constexpr (std::is_convertible_v<Func, std::function<void(const BoundArgs&...)>>)
         {
             // Function with all parameters bound
-            id = signal.connect([=]{ std::invoke(handler, args...); });
+            id = signal.connectImpl([=](internal_signal::Parameters){ std::invoke(handler, args...); });
         }
         else if constexpr (std::is_convertible_v<Func, std::function<void(const BoundArgs&..., const std::shared_ptr<Widget>&, const std::string&)>>
                         && std::is_invocable_v<decltype(&handler), BoundArgs..., const std::shared_ptr<Widget>&, const std::string&>
@@ -309,7 +310,7 @@ namespace tgui
         {
             // Function with unbound arguments
             using binder = internal_signal::func_traits<void, std::decay_t<Func>, BoundArgs...>;
-            id = signal.connect(binder::bind(signal, std::forward<Func>(handler), args...));
+            id = signal.connectImpl(binder::bind(signal, std::forward<Func>(handler), args...));
         }
 
         m_connectedSignals[id] = toLower(signalName);
@@ -320,7 +321,7 @@ namespace tgui
     template <typename Func, typename... Args, typename std::enable_if<std::is_convertible<Func, std::function<void(const Args&...)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const Args&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
+        const unsigned int id = getSignal(toLower(signalName)).connectImpl([f=std::function<void(const Args&...)>(handler),args...](internal_signal::Parameters){ f(args...); });
         m_connectedSignals[id] = toLower(signalName);
         return id;
     }
@@ -344,7 +345,7 @@ namespace tgui
     {
         Signal& signal = getSignal(toLower(signalName));
         using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
-        const unsigned int id = signal.connect(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        const unsigned int id = signal.connectImpl(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
         m_connectedSignals[id] = toLower(signalName);
         return id;
     }
@@ -0,0 +1,208 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SOFTWARE_RENDER_TARGET_HPP
+#define TGUI_SOFTWARE_RENDER_TARGET_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Color.hpp>
+#include <TGUI/RenderCommandList.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Gui;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that draws into memory on the cpu, without using the graphics card
+    ///
+    /// Drawing the gui normally requires an sf::RenderTarget, which needs OpenGL. On machines without a gpu that either fails
+    /// or falls back to a very slow software implementation of OpenGL. This target rasterizes the commands of a
+    /// RenderCommandList itself: colored and textured triangles (which includes the 9-slice scaled textures of widgets), texts
+    /// and clipping areas. The result can be saved as a png file, e.g. to create screenshots of the gui on a server.
+    ///
+    /// @code
+    /// tgui::Gui gui;
+    /// gui.setView(sf::View{sf::FloatRect{0, 0, 800, 600}});
+    /// // Add widgets to the gui ...
+    ///
+    /// tgui::SoftwareRenderTarget target{800, 600};
+    /// target.clear(tgui::Color::White);
+    /// target.draw(gui);
+    /// target.saveToFile("screenshot.png");
+    /// @endcode
+    ///
+    /// The pixels of textures that were loaded by tgui are taken from the images that tgui keeps in memory. The texture of a
+    /// font is copied the first time it is used and again only when a text needs glyphs that weren't on it yet. Pixels of
+    /// other textures are copied from the texture once per draw call. Copying them still relies on OpenGL, but none of the
+    /// drawing happens there.
+    ///
+    /// Shaders are ignored and everything is alpha blended (sf::BlendAlpha), which is the only blend mode that widgets use.
+    /// Clipping areas are axis-aligned, a clipping area of a rotated widget covers the bounding rectangle of the area.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SoftwareRenderTarget
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param width   Width of the target in pixels
+        /// @param height  Height of the target in pixels
+        ///
+        /// All pixels are transparent black and the view shows the whole target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SoftwareRenderTarget(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the target
+        ///
+        /// @return Width and height of the target in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the view that is used when drawing a command list
+        ///
+        /// @param view  View that maps the coordinates of the commands to pixels, just like the view of an sf::RenderTarget
+        ///
+        /// Drawing a gui uses the view of the gui instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(const sf::View& view);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the view that is used when drawing a command list
+        ///
+        /// @return View that maps the coordinates of the commands to pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::View& getView() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the entire target with a single color
+        ///
+        /// @param color  Color that all pixels will have
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(const Color& color = Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands of a list on the target
+        ///
+        /// @param commands  Commands to rasterize with the view of the target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(const RenderCommandList& commands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws all widgets of a gui on the target
+        ///
+        /// @param gui  Gui that is recorded with Gui::draw(RenderCommandList&) and rasterized with the view of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(Gui& gui);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of a single pixel
+        ///
+        /// @param x  Horizontal position of the pixel, which has to be smaller than the width of the target
+        /// @param y  Vertical position of the pixel, which has to be smaller than the height of the target
+        ///
+        /// @return Color of the pixel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Color getPixel(unsigned int x, unsigned int y) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the target
+        ///
+        /// @return Pointer to width * height pixels, stored row by row as 4 bytes (red, green, blue and alpha) per pixel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixelsPtr() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies the pixels of the target to an image
+        ///
+        /// @return Image with the same size and pixels as the target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Image copyToImage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the pixels of the target to an image file
+        ///
+        /// @param filename  Filename of the image, the extension determines the format (e.g. png)
+        ///
+        /// @throw Exception when the image could not be saved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToFile(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Rasterizes the commands with the given view
+        void drawWithView(const RenderCommandList& commands, const sf::View& view);
+
+        // Copies the font textures that the texts need, unless the copy from a previous draw call still contains all glyphs
+        void updateFontPages(const RenderCommandList& commands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::Vector2u m_size;
+        std::vector<std::uint8_t> m_pixels;
+        sf::View m_view;
+        RenderCommandList m_guiCommands; // Kept to reuse the memory when drawing a gui multiple times
+
+        // Copy of the texture that a font uses for one character size
+        struct FontPage
+        {
+            sf::Vector2u textureSize; // The texture is recreated with a larger size when the font runs out of space
+            std::unordered_set<std::uint64_t> glyphs; // Texture positions of the glyphs that were on it when it was copied
+            sf::Image image;
+        };
+        std::unordered_map<const sf::Texture*, FontPage> m_fontPages; // Only contains the textures used in the last draw call
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SOFTWARE_RENDER_TARGET_HPP
@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SPATIAL_INDEX_HPP
+#define TGUI_SPATIAL_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uniform grid that stores the bounding rectangles of the child widgets of a container.
+        // Every widget is stored together with its index in the container, so that the query can return the candidates
+        // in the order in which they have to be tested (topmost widget first).
+        // Widgets that cover too many cells are kept in a separate list that is checked on every query.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API SpatialIndex
+        {
+        public:
+
+            explicit SpatialIndex(float cellSize);
+
+            // Returns the width and height of the cells in the grid
+            float getCellSize() const;
+
+            // Removes all widgets from the index
+            void clear();
+
+            // Adds a widget to the index. The order is the index of the widget in its container.
+            void insert(const Widget* widget, std::size_t order, FloatRect bounds);
+
+            // Changes the bounding rectangle of a widget that was added earlier. Unknown widgets are ignored.
+            void update(const Widget* widget, FloatRect bounds);
+
+            // Returns the orders of the widgets of which the bounding rectangle contains the point, highest order first.
+            // The returned list remains valid until the next call to one of the non-const functions.
+            const std::vector<std::size_t>& query(Vector2f point);
+
+            // Returns the amount of widgets in the index
+            std::size_t size() const;
+
+        private:
+
+            struct CellRange
+            {
+                std::int32_t left;
+                std::int32_t top;
+                std::int32_t right;
+                std::int32_t bottom;
+            };
+
+            struct Item
+            {
+                std::size_t order;
+                FloatRect bounds;
+                CellRange cells;
+                bool large;
+            };
+
+            CellRange getCellRange(FloatRect bounds) const;
+            bool isLarge(const CellRange& cells) const;
+            void addToCells(const Widget* widget, const Item& item);
+            void removeFromCells(const Widget* widget, const Item& item);
+            static std::uint64_t getCellKey(std::int32_t x, std::int32_t y);
+
+        private:
+
+            float m_cellSize;
+            std::unordered_map<std::uint64_t, std::vector<const Widget*>> m_cells;
+            std::unordered_map<const Widget*, Item> m_items;
+            std::vector<const Widget*> m_largeItems;
+            std::vector<std::size_t> m_queryResult;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SPATIAL_INDEX_HPP
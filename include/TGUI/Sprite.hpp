@@ -33,6 +33,8 @@
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +62,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// Copies of a sprite share the same texture and vertices until one of them is changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Sprite();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the texture
         ///
@@ -211,6 +221,22 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Everything that is needed to draw the sprite. Copies of a sprite share this data until one of them is changed.
+        struct Data
+        {
+            Vector2f    size;
+            Texture     texture;
+            std::vector<sf::Vertex> vertices;
+
+            FloatRect   visibleRect;
+
+            Color       vertexColor = Color::White;
+            float       opacity = 1;
+
+            ScalingType scalingType = ScalingType::Normal;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the location of the vertices
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,18 +244,15 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    private:
-
-        Vector2f    m_size;
-        Texture     m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        // Returns the data to change, after making a copy of it when it is still shared with other sprites
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Data& modifyData();
 
-        FloatRect   m_visibleRect;
 
-        Color       m_vertexColor = Color::White;
-        float       m_opacity = 1;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
 
-        ScalingType m_scalingType = ScalingType::Normal;
+        std::shared_ptr<Data> m_data;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
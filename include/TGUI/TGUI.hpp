@@ -33,7 +33,10 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/WidgetPrototype.hpp>
+#include <TGUI/SoftwareRenderTarget.hpp>
 
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
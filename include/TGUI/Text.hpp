@@ -32,6 +32,7 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +44,14 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// Copies of a text share the same text and glyph geometry until one of them is changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Text();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the distance that text should be placed from the side of a widget as padding.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,10 +273,16 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the sfml text to change, after making a copy of it when it is still shared with other texts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Text& modifyText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        std::shared_ptr<sf::Text> m_text; // Shared between copies until one of them is changed
         Vector2f     m_size;
         Font         m_font;
         Color        m_color;
@@ -32,6 +32,7 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,10 +80,22 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the loaded texture data to which an sfml texture belongs
+        ///
+        /// @param texture  Texture to search for
+        ///
+        /// @return Texture data of which the texture member is the given texture, or nullptr when it wasn't loaded from a file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<TextureData> findTextureData(const sf::Texture& texture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static std::unordered_map<const sf::Texture*, std::shared_ptr<TextureData>> m_textureIndex; // Same data as m_imageMap, found by the address of its texture
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_THREAD_POOL_HPP
+#define TGUI_THREAD_POOL_HPP
+
+#include <TGUI/Config.hpp>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fixed set of worker threads that execute the tasks that are submitted to it in the order in which they were added.
+        // Tasks may be submitted from any thread. The destructor waits until all submitted tasks have finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API ThreadPool
+        {
+        public:
+
+            // When no thread count is given, one thread is created per core
+            explicit ThreadPool(unsigned int threadCount = 0);
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            // Returns a pool that is shared by the whole library. It is created the first time this function is called.
+            static ThreadPool& getDefault();
+
+            // Returns the amount of worker threads
+            unsigned int getThreadCount() const;
+
+            // Adds a task to the queue. The returned future becomes ready when the task has been executed and provides
+            // the value that was returned by it, or rethrows the exception that was thrown by it.
+            template <typename Func>
+            auto submit(Func&& func) -> std::future<decltype(func())>
+            {
+                using ResultType = decltype(func());
+                auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(func));
+                auto future = task->get_future();
+                enqueue([task]{ (*task)(); });
+                return future;
+            }
+
+        private:
+
+            void enqueue(std::function<void()> task);
+
+            void workerLoop();
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::deque<std::function<void()>> m_tasks;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            bool m_stopping = false;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_THREAD_POOL_HPP
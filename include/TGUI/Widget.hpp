@@ -33,6 +33,7 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Layout.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/Animation.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -46,6 +47,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <unordered_set>
+#include <array>
 
 #ifdef TGUI_USE_CPP17
     #include <any>
@@ -59,12 +61,6 @@ namespace tgui
 {
     class Container;
 
-    enum class ShowAnimationType;
-    namespace priv
-    {
-        class Animation;
-    }
-
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The parent class for every widget
@@ -128,7 +124,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         WidgetRenderer* getRenderer();
         const WidgetRenderer* getRenderer() const;
@@ -508,6 +504,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called every frame with the time passed since the last frame.
+        /// It is only called while the widget is time-dependent, see isTimeDependent().
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
@@ -691,7 +688,23 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
+        /// @param property  Id of the property that was changed
+        ///
+        /// Properties that the widget does not handle itself are passed to the deprecated rendererChanged(const std::string&).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererChanged(PropertyId property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when a property of the renderer is changed that the widget does not handle itself
+        ///
         /// @param property  Lowercase name of the property that was changed
+        ///
+        /// @throw Exception because the widget does not have the property
+        ///
+        /// @deprecated Custom widgets should override rendererChanged(PropertyId) instead and compare the id with the one
+        ///             returned by priv::internPropertyName. Overriding this function still works for properties that are
+        ///             not handled by the widget that is being derived from.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rendererChanged(const std::string& property);
 
@@ -708,6 +721,43 @@ namespace tgui
         virtual void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget has to be updated every frame
+        ///
+        /// The update function is only called on widgets that are time-dependent, e.g. because they have a blinking caret,
+        /// a running animation or are waiting for a possible double click. Widgets that override the update function should
+        /// either override this function and call updateTimeDependency() whenever the returned value changes, or register
+        /// themselves with setUpdatedEveryFrame(true).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isTimeDependent() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widget is always time-dependent, so that update is called every frame
+        ///
+        /// Custom widgets that override the update function and relied on it being called every frame (which was the case
+        /// in older TGUI versions) should call this function with true in their constructor.
+        ///
+        /// @param updatedEveryFrame  Should the update function be called every frame?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUpdatedEveryFrame(bool updatedEveryFrame);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the parent when the value returned by isTimeDependent() has changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTimeDependency();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the parent that the area returned by getFullSize() and getWidgetOffset() may have changed
+        ///
+        /// This already happens when the widget is moved, resized or when its renderer changes. Widgets of which that area
+        /// also depends on something else (e.g. the text next to a radio button) have to call this function when it changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void boundsChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief This function is called when the mouse enters the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -744,8 +794,16 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
+        // for each of the changed properties
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const std::string& property);
+        void rendererChangedCallback(const std::vector<PropertyId>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the scheduler on which show and hide animations are run and finishes the previous animation of the given kind.
+        // The scheduler of the gui is used when the widget is part of one, otherwise the widget steps the animations itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AnimationScheduler& prepareShowAnimation(std::size_t kind);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -796,6 +854,12 @@ namespace tgui
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
+        // Is the widget registered in its parent as a widget that needs to be updated every frame?
+        bool m_timeDependent = false;
+
+        // Was the widget registered to be updated every frame, even when it has nothing to animate?
+        bool m_updatedEveryFrame = false;
+
         // This is set to true for widgets that have something to be dragged around (e.g. sliders and scrollbars)
         bool m_draggableWidget = false;
 
@@ -808,8 +872,10 @@ namespace tgui
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
+        // Show animations, there can be one move, resize and fade animation at the same time
+        std::array<AnimationScheduler::Id, 3> m_showAnimations = {};
+        std::weak_ptr<AnimationScheduler> m_showAnimationScheduler;
+        std::shared_ptr<AnimationScheduler> m_localAnimationScheduler;
 
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
@@ -826,12 +892,13 @@ namespace tgui
         tgui::Any m_userData;
     #endif
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        std::function<void(const std::vector<PropertyId>& properties)> m_rendererChangedCallback = [this](const std::vector<PropertyId>& properties){ rendererChangedCallback(properties); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, m_timeDependent, save and load
+        friend class priv::LayoutSolver; // LayoutSolver accesses m_boundPositionLayouts and m_boundSizeLayouts
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WIDGET_PROTOTYPE_HPP
+#define TGUI_WIDGET_PROTOTYPE_HPP
+
+
+#include <TGUI/Widget.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Configured widget, including its child widgets, from which many identical widgets can be created
+    ///
+    /// The prototype keeps its own copy of the widget, so changing the widget that was passed to create afterwards doesn't
+    /// change the instances. Instances are created with the copy constructors of the widgets, so the theme lookups and
+    /// setup done when creating a new widget are skipped. They share the renderers of the prototype, and their texts and
+    /// sprites share the string, glyph geometry, texture and vertices with those of the prototype until an instance changes
+    /// them. The position, size, signals and child widgets of each instance are still its own.
+    ///
+    /// @code
+    /// auto row = tgui::Panel::create({400, 30});
+    /// row->add(tgui::Label::create("Name"), "Name");
+    /// row->add(tgui::Button::create("Remove"), "Remove");
+    ///
+    /// auto prototype = tgui::WidgetPrototype::create(row);
+    /// for (auto& instance : prototype->instantiate(1000))
+    ///     list->add(instance);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WidgetPrototype
+    {
+    public:
+
+        typedef std::shared_ptr<WidgetPrototype> Ptr; ///< Shared widget prototype pointer
+        typedef std::shared_ptr<const WidgetPrototype> ConstPtr; ///< Shared constant widget prototype pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a prototype from a widget
+        ///
+        /// @param widget  Widget that has been configured like the instances should be, it is not changed by the prototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WidgetPrototype(const Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a prototype from a widget
+        ///
+        /// @param widget  Widget that has been configured like the instances should be, it is not changed by the prototype
+        ///
+        /// @return The new prototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static WidgetPrototype::Ptr create(const Widget::ConstPtr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new widget that looks like the prototype
+        ///
+        /// @return The new widget, which has no parent yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr instantiate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new widget that looks like the prototype
+        ///
+        /// @return The new widget, which has no parent yet
+        ///
+        /// @warning This function will return a wrong pointer when the prototype wasn't created from a widget of that type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class WidgetType>
+        typename WidgetType::Ptr instantiate() const
+        {
+            return std::static_pointer_cast<WidgetType>(instantiate());
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates many widgets that look like the prototype
+        ///
+        /// @param count  Amount of widgets to create
+        ///
+        /// @return The new widgets, which have no parent yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Widget::Ptr> instantiate(std::size_t count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget of which the instances are copies
+        ///
+        /// @return Copy of the widget that was passed to create
+        ///
+        /// Changing this widget will also change the instances that are created afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Widget::Ptr m_widget;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_PROTOTYPE_HPP
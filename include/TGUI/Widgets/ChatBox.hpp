@@ -95,7 +95,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChatBoxRenderer* getRenderer();
         const ChatBoxRenderer* getRenderer() const;
@@ -376,10 +376,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +414,7 @@ namespace tgui
     protected:
 
         unsigned int m_textSize = 0;
+        float m_extraHorizontalPaddingCached = 0; // Text::getExtraHorizontalPadding for the font and text size, so that draw doesn't access the font
         Color m_textColor = Color::Black;
 
         std::size_t m_maxLines = 0;
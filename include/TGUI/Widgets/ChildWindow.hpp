@@ -102,7 +102,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ChildWindowRenderer* getRenderer();
         const ChildWindowRenderer* getRenderer() const;
@@ -420,10 +420,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
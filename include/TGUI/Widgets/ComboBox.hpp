@@ -110,7 +110,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ComboBoxRenderer* getRenderer();
         const ComboBoxRenderer* getRenderer() const;
@@ -537,10 +537,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -611,6 +612,7 @@ namespace tgui
         ListBox::Ptr m_listBox = ListBox::create();
 
         Text m_text;
+        float m_extraHorizontalPaddingCached = 0; // Text::getExtraHorizontalPadding for the font, text size and style, so that draw doesn't access the font
 
         ExpandDirection m_expandDirection = ExpandDirection::Down;
 
@@ -83,7 +83,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ListBoxRenderer* getRenderer();
         const ListBoxRenderer* getRenderer() const;
@@ -520,10 +520,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +575,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget has to be updated every frame, which is only the case while it is waiting for a possible double click
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeDependent() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +616,7 @@ namespace tgui
         unsigned int m_itemHeight = 0;
         unsigned int m_requestedTextSize = 0;
         unsigned int m_textSize = 0;
+        float m_extraHorizontalPaddingCached = 0; // Text::getExtraHorizontalPadding for the font, text size and style, so that draw doesn't access the font
 
         // This will store the maximum number of items in the list box (zero by default, meaning that there is no limit)
         std::size_t m_maxItems = 0;
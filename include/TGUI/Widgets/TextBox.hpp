@@ -87,7 +87,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the renderer, which gives access to functions that determine how the widget is displayed
         /// @return Temporary pointer to the renderer
-        /// @warning After calling this function, the widget has its own copy of the renderer and it will no longer be shared.
+        /// @warning After calling this function, the widget has its own renderer and changes to it no longer affect other widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TextBoxRenderer* getRenderer();
         const TextBoxRenderer* getRenderer() const;
@@ -393,6 +393,12 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget has to be updated every frame, which is only the case while it is focused, to let the caret blink
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeDependent() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,10 +426,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -459,6 +466,7 @@ namespace tgui
         sf::String   m_text;
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
+        float m_extraVerticalSpaceCached = 0; // Text::calculateExtraVerticalSpace for the font and text size, so that draw doesn't access the font
 
         std::vector<sf::String> m_lines;
 
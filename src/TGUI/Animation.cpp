@@ -24,136 +24,386 @@
 
 
 #include <TGUI/Animation.hpp>
-#include <TGUI/Widget.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    namespace priv
+    namespace
     {
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Ids are unique over all schedulers, so that an id of a removed animation can never refer to another animation
+        std::atomic<AnimationScheduler::Id> lastAnimationId{0};
 
-        Animation::Type Animation::getType() const
+        float applyEasing(Easing easing, float t)
         {
-            return m_type;
-        }
+            switch (easing)
+            {
+            case Easing::Linear:
+                return t;
+            case Easing::EaseIn:
+                return t * t;
+            case Easing::EaseOut:
+                return t * (2 - t);
+            case Easing::EaseInOut:
+                return (t < 0.5f) ? (2 * t * t) : (-1 + (4 - 2 * t) * t);
+            case Easing::CubicIn:
+                return t * t * t;
+            case Easing::CubicOut:
+            {
+                const float u = t - 1;
+                return u * u * u + 1;
+            }
+            case Easing::CubicInOut:
+            {
+                if (t < 0.5f)
+                    return 4 * t * t * t;
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                const float u = 2 * t - 2;
+                return 0.5f * u * u * u + 1;
+            }
+            case Easing::Smoothstep:
+                return t * t * (3 - 2 * t);
+            }
 
-        void Animation::finish()
-        {
-            if (m_finishedCallback != nullptr)
-                m_finishedCallback();
+            return t;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float interpolate(float start, float end, float factor)
+        {
+            return start + (end - start) * factor;
+        }
 
-        Animation::Animation(Type type, Widget::Ptr widget, sf::Time duration, std::function<void()> finishedCallback) :
-            m_type            {type},
-            m_widget          {widget},
-            m_totalDuration   {duration},
-            m_finishedCallback{finishedCallback}
+        Vector2f interpolate(Vector2f start, Vector2f end, float factor)
         {
+            return {start.x + (end.x - start.x) * factor, start.y + (end.y - start.y) * factor};
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint8_t interpolateChannel(std::uint8_t start, std::uint8_t end, float factor)
+        {
+            // Easing functions are allowed to overshoot, so the result has to be clamped
+            const float value = std::round(start + (end - start) * factor);
+            return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, value)));
+        }
 
-        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation {Type::Move, widget, duration, finishedCallback},
-            m_startPos{start},
-            m_endPos  {end}
+        Color interpolate(const Color& start, const Color& end, float factor)
         {
+            return {interpolateChannel(start.getRed(), end.getRed(), factor),
+                    interpolateChannel(start.getGreen(), end.getGreen(), factor),
+                    interpolateChannel(start.getBlue(), end.getBlue(), factor),
+                    interpolateChannel(start.getAlpha(), end.getAlpha(), factor)};
         }
+    }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool MoveAnimation::update(sf::Time elapsedTime)
-        {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
-            {
-                finish();
-                return true;
-            }
+    AnimationScheduler::Id AnimationScheduler::animate(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                                                       Easing easing, std::function<void()> finishedCallback)
+    {
+        return add(m_floatTrack, Kind::Float, start, end, duration, std::move(setter), easing, nullptr, std::move(finishedCallback));
+    }
 
-            m_widget->setPosition(m_startPos + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endPos - m_startPos)));
-            return false;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    AnimationScheduler::Id AnimationScheduler::animate(float start, float end, sf::Time duration, std::function<void(float)> setter,
+                                                       EasingFunction easing, std::function<void()> finishedCallback)
+    {
+        return add(m_floatTrack, Kind::Float, start, end, duration, std::move(setter), Easing::Linear, std::move(easing), std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler::Id AnimationScheduler::animate(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                                                       Easing easing, std::function<void()> finishedCallback)
+    {
+        return add(m_vectorTrack, Kind::Vector, start, end, duration, std::move(setter), easing, nullptr, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void MoveAnimation::finish()
+    AnimationScheduler::Id AnimationScheduler::animate(Vector2f start, Vector2f end, sf::Time duration, std::function<void(Vector2f)> setter,
+                                                       EasingFunction easing, std::function<void()> finishedCallback)
+    {
+        return add(m_vectorTrack, Kind::Vector, start, end, duration, std::move(setter), Easing::Linear, std::move(easing), std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler::Id AnimationScheduler::animate(Color start, Color end, sf::Time duration, std::function<void(Color)> setter,
+                                                       Easing easing, std::function<void()> finishedCallback)
+    {
+        return add(m_colorTrack, Kind::Color, start, end, duration, std::move(setter), easing, nullptr, std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler::Id AnimationScheduler::animate(Color start, Color end, sf::Time duration, std::function<void(Color)> setter,
+                                                       EasingFunction easing, std::function<void()> finishedCallback)
+    {
+        return add(m_colorTrack, Kind::Color, start, end, duration, std::move(setter), Easing::Linear, std::move(easing), std::move(finishedCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::update(sf::Time elapsedTime)
+    {
+        // Updating from within a setter would invalidate the iteration that is in progress
+        if (m_updating)
+            return;
+
+        const float elapsedSeconds = elapsedTime.asSeconds();
+
+        m_updating = true;
+        updateTrack(m_floatTrack, Kind::Float, elapsedSeconds);
+        updateTrack(m_vectorTrack, Kind::Vector, elapsedSeconds);
+        updateTrack(m_colorTrack, Kind::Color, elapsedSeconds);
+        m_updating = false;
+
+        processPendingOperations();
+
+        if (m_finishedCallbacks.empty())
+            return;
+
+        // The callbacks may start new animations or even update the scheduler again, so they are moved out first
+        std::vector<std::function<void()>> callbacks;
+        callbacks.swap(m_finishedCallbacks);
+        for (auto& callback : callbacks)
+            callback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimationScheduler::finish(Id id)
+    {
+        const auto it = m_locations.find(id);
+        if (it == m_locations.end())
+            return false;
+
+        if (m_updating)
         {
-            m_widget->setPosition(m_endPos);
-            Animation::finish();
+            m_pendingOperations.emplace_back(id, true);
+            return true;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation  {Type::Resize, widget, duration, finishedCallback},
-            m_startSize{start},
-            m_endSize  {end}
+        const Location location = it->second;
+        switch (location.kind)
         {
+        case Kind::Float:
+            finishInTrack(m_floatTrack, location.kind, location.index);
+            break;
+        case Kind::Vector:
+            finishInTrack(m_vectorTrack, location.kind, location.index);
+            break;
+        case Kind::Color:
+            finishInTrack(m_colorTrack, location.kind, location.index);
+            break;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        return true;
+    }
 
-        bool ResizeAnimation::update(sf::Time elapsedTime)
-        {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
-            {
-                finish();
-                return true;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            m_widget->setSize(m_startSize + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endSize - m_startSize)));
+    bool AnimationScheduler::stop(Id id)
+    {
+        const auto it = m_locations.find(id);
+        if (it == m_locations.end())
             return false;
-        }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if (m_updating)
+        {
+            m_pendingOperations.emplace_back(id, false);
+            return true;
+        }
 
-        void ResizeAnimation::finish()
+        const Location location = it->second;
+        switch (location.kind)
         {
-            m_widget->setSize(m_endSize);
-            Animation::finish();
+        case Kind::Float:
+            removeFromTrack(m_floatTrack, location.kind, location.index);
+            break;
+        case Kind::Vector:
+            removeFromTrack(m_vectorTrack, location.kind, location.index);
+            break;
+        case Kind::Color:
+            removeFromTrack(m_colorTrack, location.kind, location.index);
+            break;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation     {Type::Fade, widget, duration, finishedCallback},
-            m_startOpacity{std::max(0.f, std::min(1.f, start))},
-            m_endOpacity  {std::max(0.f, std::min(1.f, end))}
+    void AnimationScheduler::stopAll()
+    {
+        if (m_updating)
         {
+            for (const auto& pair : m_locations)
+                m_pendingOperations.emplace_back(pair.first, false);
+            return;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_floatTrack = {};
+        m_vectorTrack = {};
+        m_colorTrack = {};
+        m_locations.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool AnimationScheduler::isRunning(Id id) const
+    {
+        return m_locations.find(id) != m_locations.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t AnimationScheduler::getAnimationCount() const
+    {
+        return m_locations.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler::EasingFunction AnimationScheduler::getEasingFunction(Easing easing)
+    {
+        return [easing](float t){ return applyEasing(easing, t); };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    AnimationScheduler::Id AnimationScheduler::add(Track<T>& track, Kind kind, T start, T end, sf::Time duration, std::function<void(T)> setter,
+                                                   Easing easing, EasingFunction customEasing, std::function<void()> finishedCallback)
+    {
+        const Id id = ++lastAnimationId;
+        m_locations[id] = {kind, track.ids.size()};
+
+        track.ids.push_back(id);
+        track.startValues.push_back(start);
+        track.endValues.push_back(end);
+        track.elapsedTimes.push_back(0);
+        track.durations.push_back(std::max(0.f, duration.asSeconds()));
+        track.easings.push_back(easing);
+        track.customEasings.push_back(std::move(customEasing));
+        track.setters.push_back(std::move(setter));
+        track.finishedCallbacks.push_back(std::move(finishedCallback));
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void AnimationScheduler::updateTrack(Track<T>& track, Kind kind, float elapsedSeconds)
+    {
+        // Animations that are added by the setters are only stepped during the next update
+        const std::size_t count = track.ids.size();
+        if (count == 0)
+            return;
+
+        for (std::size_t i = 0; i < count; ++i)
+            track.elapsedTimes[i] += elapsedSeconds;
 
-        bool FadeAnimation::update(sf::Time elapsedTime)
+        m_finishedIndices.clear();
+        for (std::size_t i = 0; i < count; ++i)
         {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            const float duration = track.durations[i];
+            if (track.elapsedTimes[i] >= duration)
             {
-                finish();
-                return true;
+                m_finishedIndices.push_back(i);
+                if (track.setters[i])
+                    track.setters[i](track.endValues[i]);
+                continue;
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity)));
-            return false;
+            const float progress = track.elapsedTimes[i] / duration;
+            const float factor = track.customEasings[i] ? track.customEasings[i](progress) : applyEasing(track.easings[i], progress);
+            if (track.setters[i])
+                track.setters[i](interpolate(track.startValues[i], track.endValues[i], factor));
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remove the finished animations from back to front, so that the swapped elements are never ones that still need removing
+        for (auto it = m_finishedIndices.rbegin(); it != m_finishedIndices.rend(); ++it)
+        {
+            if (track.finishedCallbacks[*it])
+                m_finishedCallbacks.push_back(std::move(track.finishedCallbacks[*it]));
+
+            removeFromTrack(track, kind, *it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void AnimationScheduler::finishInTrack(Track<T>& track, Kind kind, std::size_t index)
+    {
+        // The setter and callback are moved out before removing the animation, as they may add new animations to the track
+        auto setter = std::move(track.setters[index]);
+        auto callback = std::move(track.finishedCallbacks[index]);
+        const T endValue = track.endValues[index];
+        removeFromTrack(track, kind, index);
+
+        if (setter)
+            setter(endValue);
+        if (callback)
+            callback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    void AnimationScheduler::removeFromTrack(Track<T>& track, Kind kind, std::size_t index)
+    {
+        m_locations.erase(track.ids[index]);
 
-        void FadeAnimation::finish()
+        // Move the last animation into the freed slot to keep the arrays contiguous
+        const std::size_t last = track.ids.size() - 1;
+        if (index != last)
         {
-            m_widget->setInheritedOpacity(m_endOpacity);
-            Animation::finish();
+            track.ids[index] = track.ids[last];
+            track.startValues[index] = track.startValues[last];
+            track.endValues[index] = track.endValues[last];
+            track.elapsedTimes[index] = track.elapsedTimes[last];
+            track.durations[index] = track.durations[last];
+            track.easings[index] = track.easings[last];
+            track.customEasings[index] = std::move(track.customEasings[last]);
+            track.setters[index] = std::move(track.setters[last]);
+            track.finishedCallbacks[index] = std::move(track.finishedCallbacks[last]);
+
+            m_locations[track.ids[index]] = {kind, index};
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        track.ids.pop_back();
+        track.startValues.pop_back();
+        track.endValues.pop_back();
+        track.elapsedTimes.pop_back();
+        track.durations.pop_back();
+        track.easings.pop_back();
+        track.customEasings.pop_back();
+        track.setters.pop_back();
+        track.finishedCallbacks.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void AnimationScheduler::processPendingOperations()
+    {
+        if (m_pendingOperations.empty())
+            return;
+
+        // Finishing an animation may call functions that add new pending operations, so the list is moved out first
+        std::vector<std::pair<Id, bool>> operations;
+        operations.swap(m_pendingOperations);
+        for (const auto& operation : operations)
+        {
+            if (operation.second)
+                finish(operation.first);
+            else
+                stop(operation.first);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
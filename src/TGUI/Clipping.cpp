@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,9 +37,18 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
-        m_target {target},
-        m_oldView{target.getView()}
+        m_target  {target},
+        m_oldView {target.getView()},
+        m_commands{priv::RenderCommandRecorder::getCommandList()}
     {
+        if (m_commands)
+        {
+            m_commands->pushClip(states, topLeft, size);
+            return;
+        }
+
+        TGUI_PROFILE_CLIP_CHANGE();
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
@@ -97,7 +108,10 @@ namespace tgui
 
     Clipping::~Clipping()
     {
-        m_target.setView(m_oldView);
+        if (m_commands)
+            m_commands->popClip();
+        else
+            m_target.setView(m_oldView);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,9 +27,16 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Loading/ResourcePreloader.hpp>
+#include <TGUI/Loading/BinaryForm.hpp>
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/Profiler.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <deque>
 #include <fstream>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,7 +69,7 @@ namespace tgui
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& pair : renderer->getAllProperties())
             {
                 // Skip "font = null"
                 if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
@@ -88,6 +95,100 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Is lazy loading of hidden containers requested for the widgets that are currently being loaded?
+        bool loadingHiddenWidgetsLazily = false;
+
+        // Changes whether hidden containers are loaded lazily until the object is destroyed
+        class LazyLoadingScope
+        {
+        public:
+            explicit LazyLoadingScope(bool lazy) :
+                m_previous{loadingHiddenWidgetsLazily}
+            {
+                loadingHiddenWidgetsLazily = lazy;
+            }
+
+            ~LazyLoadingScope()
+            {
+                loadingHiddenWidgetsLazily = m_previous;
+            }
+
+        private:
+            bool m_previous;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Builds the nodes of a widget file while it is being parsed. Every top-level section is passed to the callback as soon
+        // as it has been read completely, so that only one top-level section has to be kept in memory at a time. The callback
+        // also receives the node containing the properties that were found outside the sections until then.
+        class SectionReader : public DataIO::Visitor
+        {
+        public:
+            using Callback = std::function<void(const std::unique_ptr<DataIO::Node>& rootNode, std::unique_ptr<DataIO::Node> section)>;
+
+            explicit SectionReader(Callback sectionRead) :
+                m_sectionRead{std::move(sectionRead)}
+            {
+            }
+
+            void beginNode(const std::string& name) override
+            {
+                auto node = std::make_unique<DataIO::Node>();
+                node->name = name;
+
+                if (m_openNodes.empty())
+                {
+                    node->parent = m_rootNode.get();
+                    m_section = std::move(node);
+                    m_openNodes.push_back(m_section.get());
+                }
+                else
+                {
+                    node->parent = m_openNodes.back();
+                    m_openNodes.push_back(node.get());
+                    node->parent->children.push_back(std::move(node));
+                }
+            }
+
+            void property(const std::string& key, std::unique_ptr<DataIO::ValueNode> value) override
+            {
+                if (m_openNodes.empty())
+                    m_rootNode->propertyValuePairs[key] = std::move(value);
+                else
+                    m_openNodes.back()->propertyValuePairs[key] = std::move(value);
+            }
+
+            void endNode() override
+            {
+                m_openNodes.pop_back();
+                if (m_openNodes.empty())
+                {
+                    m_sectionRead(m_rootNode, std::move(m_section));
+                }
+            }
+
+            const std::unique_ptr<DataIO::Node>& getRootNode() const
+            {
+                return m_rootNode;
+            }
+
+        private:
+            Callback m_sectionRead;
+            std::unique_ptr<DataIO::Node> m_rootNode = std::make_unique<DataIO::Node>();
+            std::unique_ptr<DataIO::Node> m_section;
+            std::vector<DataIO::Node*> m_openNodes;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FloatRect getSpatialIndexBounds(const Widget& widget)
+        {
+            return {widget.getPosition() + widget.getWidgetOffset(), widget.getFullSize()};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -102,7 +203,12 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            setSpatialIndexEnabled(true, other.m_spatialIndex->getCellSize());
+
         // Copy all the widgets
+        other.loadPendingWidgets();
+        reserveWidgets(other.m_widgets.size());
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
     }
@@ -113,14 +219,24 @@ namespace tgui
         Widget                {std::move(other)},
         m_widgets             {std::move(other.m_widgets)},
         m_widgetNames         {std::move(other.m_widgetNames)},
+        m_widgetNameIndex     {std::move(other.m_widgetNameIndex)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_widgetWithMouseDown {std::move(other.m_widgetWithMouseDown)},
+        m_spatialIndex        {std::move(other.m_spatialIndex)},
+        m_spatialIndexOutdated{true},
+        m_timeDependentWidgets{std::move(other.m_timeDependentWidgets)},
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_pendingWidgetNodes  {std::move(other.m_pendingWidgetNodes)},
+        m_pendingRenderers    {std::move(other.m_pendingRenderers)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_widgetNames = {};
+        other.m_widgetNameIndex = {};
+        other.m_timeDependentWidgets = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,7 +265,14 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            if (right.m_spatialIndex)
+                setSpatialIndexEnabled(true, right.m_spatialIndex->getCellSize());
+            else
+                setSpatialIndexEnabled(false);
+
             // Copy all the widgets
+            right.loadPendingWidgets();
+            reserveWidgets(right.m_widgets.size());
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
                 // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
@@ -170,14 +293,24 @@ namespace tgui
             Widget::operator=(std::move(right));
             m_widgets              = std::move(right.m_widgets);
             m_widgetNames          = std::move(right.m_widgetNames);
+            m_widgetNameIndex      = std::move(right.m_widgetNameIndex);
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
+            m_widgetWithMouseDown  = std::move(right.m_widgetWithMouseDown);
+            m_spatialIndex         = std::move(right.m_spatialIndex);
+            m_spatialIndexOutdated = true;
+            m_timeDependentWidgets = std::move(right.m_timeDependentWidgets);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_pendingWidgetNodes   = std::move(right.m_pendingWidgetNodes);
+            m_pendingRenderers     = std::move(right.m_pendingRenderers);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_widgetNames = {};
+            right.m_widgetNameIndex = {};
+            right.m_timeDependentWidgets = {};
         }
 
         return *this;
@@ -198,8 +331,10 @@ namespace tgui
             if (getInnerSize() != m_prevInnerSize)
             {
                 m_prevInnerSize = getInnerSize();
+                priv::LayoutSolver::suspend();
                 for (auto& layout : m_boundSizeLayouts)
                     layout->recalculateValue();
+                priv::LayoutSolver::resume();
             }
         }
     }
@@ -214,28 +349,59 @@ namespace tgui
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
+        // The widget is only stored in the name index when no earlier widget has the same name
+        m_widgetNameIndex.emplace(toLower(widgetName), NamedWidget{widgetPtr, widgetName});
+
+        if (m_spatialIndex && !m_spatialIndexOutdated)
+            m_spatialIndex->insert(widgetPtr.get(), m_widgets.size() - 1, getSpatialIndexBounds(*widgetPtr));
+
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        if (widgetPtr->m_timeDependent)
+        {
+            m_timeDependentWidgets.push_back(widgetPtr);
+            updateTimeDependency();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        Widget::Ptr widget = getChildWidgetByName(widgetName);
+        if (widget)
+            return widget;
+
+        // Check if the name is a path to the widget (e.g. "Panel1.Tabs.Button1")
+        std::size_t dotPos = widgetName.find(".");
+        if (dotPos != sf::String::InvalidPos)
         {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
+            const Container* container = this;
+            std::size_t startPos = 0;
+            while (container)
+            {
+                widget = container->getChildWidgetByName(widgetName.substring(startPos, dotPos - startPos));
+                if (!widget || (dotPos == sf::String::InvalidPos))
+                    break;
+
+                container = widget->isContainer() ? static_cast<Container*>(widget.get()) : nullptr;
+                startPos = dotPos + 1;
+                dotPos = widgetName.find(".", startPos);
+            }
+
+            if (widget && container && (dotPos == sf::String::InvalidPos))
+                return widget;
         }
 
         for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
         {
             if (m_widgets[i]->isContainer())
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
+                widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
                 if (widget != nullptr)
                     return widget;
             }
@@ -266,10 +432,27 @@ namespace tgui
                     widget->setFocused(false);
                 }
 
+                if (widget == m_widgetWithMouseDown)
+                    m_widgetWithMouseDown = nullptr;
+
+                const std::string lowercaseName = toLower(m_widgetNames[i]);
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                m_spatialIndexOutdated = true;
+
+                // If the widget was stored in the name index then another widget with the same name may have to replace it
+                const auto it = m_widgetNameIndex.find(lowercaseName);
+                if ((it != m_widgetNameIndex.end()) && (it->second.widget == widget))
+                    updateWidgetNameIndex(lowercaseName);
+
+                if (widget->m_timeDependent)
+                {
+                    m_timeDependentWidgets.erase(std::find(m_timeDependentWidgets.begin(), m_timeDependentWidgets.end(), widget));
+                    updateTimeDependency();
+                }
                 return true;
             }
         }
@@ -286,9 +469,34 @@ namespace tgui
 
         m_widgets.clear();
         m_widgetNames.clear();
+        m_widgetNameIndex.clear();
+        m_pendingWidgetNodes.clear();
+        m_pendingRenderers.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+        m_widgetWithMouseDown = nullptr;
+
+        if (!m_timeDependentWidgets.empty())
+        {
+            m_timeDependentWidgets.clear();
+            updateTimeDependency();
+        }
+
+        if (m_spatialIndex)
+        {
+            m_spatialIndex->clear();
+            m_spatialIndexOutdated = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::reserveWidgets(std::size_t count)
+    {
+        m_widgets.reserve(count);
+        m_widgetNames.reserve(count);
+        m_widgetNameIndex.reserve(count);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,7 +507,14 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                const std::string oldLowercaseName = toLower(m_widgetNames[i]);
                 m_widgetNames[i] = name;
+
+                updateWidgetNameIndex(oldLowercaseName);
+                const std::string newLowercaseName = toLower(name);
+                if (newLowercaseName != oldLowercaseName)
+                    updateWidgetNameIndex(newLowercaseName);
+
                 return true;
             }
         }
@@ -334,6 +549,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setVisible(bool visible)
+    {
+        if (visible)
+            loadPendingWidgets();
+
+        Widget::setVisible(visible);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Container::getInnerSize() const
     {
         return getSize();
@@ -341,85 +566,174 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromFile(const std::string& filename)
+    void Container::loadWidgetsFromFile(const std::string& filename, bool loadHiddenWidgetsLazily)
     {
-        std::ifstream in{filename};
+        std::ifstream in{filename, std::ios::binary};
         if (!in.is_open())
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream);
+        if (BinaryForm::isBinaryForm(in))
+        {
+            loadWidgetsFromBinaryStream(in, loadHiddenWidgetsLazily);
+            return;
+        }
+
+        // Text files are opened again in text mode
+        in.close();
+        in.open(filename);
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+        loadWidgetsFromStream(in, loadHiddenWidgetsLazily);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        saveWidgetsToStream(stream);
-
         std::ofstream out{filename};
         if (!out.is_open())
             throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
 
-        out << stream.rdbuf();
+        saveWidgetsToStream(out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::istream& stream, bool loadHiddenWidgetsLazily)
+    {
+        loadWidgets([&stream](DataIO::Visitor& visitor){ DataIO::parse(stream, visitor); }, loadHiddenWidgetsLazily);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream& stream)
+    void Container::loadWidgetsFromStream(std::stringstream&& stream, bool loadHiddenWidgetsLazily)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromStream(stream, loadHiddenWidgetsLazily);
+    }
 
-        removeAllWidgets(); // The existing widgets will be replaced by the ones that will be loaded
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (rootNode->propertyValuePairs.size() != 0)
-            Widget::load(rootNode, {});
+    void Container::saveWidgetsToStream(std::ostream& stream) const
+    {
+        DataIO::Writer writer{stream};
+        saveWidgets([&writer](const DataIO::Node& node){ writer.writeNode(node); });
+    }
 
-        std::map<std::string, std::shared_ptr<RendererData>> availableRenderers;
-        for (const auto& node : rootNode->children)
-        {
-            auto nameSeparator = node->name.find('.');
-            auto widgetType = node->name.substr(0, nameSeparator);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            std::string objectName;
-            if (nameSeparator != std::string::npos)
-                objectName = Deserializer::deserialize(ObjectConverter::Type::String, node->name.substr(nameSeparator + 1)).getString();
+    void Container::loadWidgetsFromBinaryStream(std::istream& stream, bool loadHiddenWidgetsLazily)
+    {
+        loadWidgets([&stream](DataIO::Visitor& visitor){ BinaryForm::parse(stream, visitor); }, loadHiddenWidgetsLazily);
+    }
 
-            if (toLower(widgetType) == "renderer")
-            {
-                if (!objectName.empty())
-                    availableRenderers[toLower(objectName)] = RendererData::createFromDataIONode(node.get());
-            }
-            else // Section describes a widget
-            {
-                const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
-                if (constructor)
-                {
-                    Widget::Ptr widget = constructor();
-                    widget->load(node, availableRenderers);
-                    add(widget, objectName);
-                }
-                else
-                    throw Exception{"No construct function exists for widget type '" + widgetType + "'."};
-            }
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToBinaryStream(std::ostream& stream) const
+    {
+        BinaryForm::Writer writer{stream};
+        saveWidgets([&writer](const DataIO::Node& node){ writer.writeNode(node); });
+        writer.finish();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Container::saveSnapshot() const
+    {
+        std::ostringstream stream{std::ios::binary};
+        saveWidgetsToBinaryStream(stream);
+        return stream.str();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    void Container::restoreSnapshot(const std::string& snapshot)
     {
-        loadWidgetsFromStream(stream);
+        std::istringstream stream{snapshot, std::ios::binary};
+        loadWidgetsFromBinaryStream(stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    void Container::loadWidgets(const std::function<void(DataIO::Visitor&)>& parse, bool loadHiddenWidgetsLazily)
     {
-        auto node = std::make_unique<DataIO::Node>();
+        LazyLoadingScope lazyLoading{loadHiddenWidgetsLazily};
+
+        // The widgets are only put in the container once the whole input was loaded successfully,
+        // so that the existing widgets remain untouched when an exception is thrown.
+        auto containerNode = std::make_unique<DataIO::Node>();
+        std::vector<std::pair<Widget::Ptr, std::string>> loadedWidgets;
+
+        std::map<std::string, std::shared_ptr<RendererData>> availableRenderers;
+        const auto loadSection = [&](const std::unique_ptr<DataIO::Node>& rootNode, const std::unique_ptr<DataIO::Node>& node){
+                // The properties of the container itself are normally found in front of the sections
+                for (auto& pair : rootNode->propertyValuePairs)
+                    containerNode->propertyValuePairs[pair.first] = std::move(pair.second);
+                rootNode->propertyValuePairs.clear();
+
+                auto nameSeparator = node->name.find('.');
+                auto widgetType = node->name.substr(0, nameSeparator);
+
+                std::string objectName;
+                if (nameSeparator != std::string::npos)
+                    objectName = Deserializer::deserialize(ObjectConverter::Type::String, node->name.substr(nameSeparator + 1)).getString();
+
+                if (toLower(widgetType) == "renderer")
+                {
+                    if (!objectName.empty())
+                        availableRenderers[toLower(objectName)] = RendererData::createFromDataIONode(node.get());
+                }
+                else // Section describes a widget
+                {
+                    const auto& constructor = WidgetFactory::getConstructFunction(toLower(widgetType));
+                    if (constructor)
+                    {
+                        Widget::Ptr widget = constructor();
+                        widget->load(node, availableRenderers);
+                        loadedWidgets.emplace_back(std::move(widget), std::move(objectName));
+                    }
+                    else
+                        throw Exception{"No construct function exists for widget type '" + widgetType + "'."};
+                }
+            };
+
+        // The textures and fonts of every section are decoded on other threads as soon as the section has been read.
+        // The sections are loaded in order once all their resources are available.
+        ResourcePreloader preloader;
+        std::deque<std::pair<std::unique_ptr<DataIO::Node>, ResourcePreloader::PendingResources>> pendingSections;
+        SectionReader reader{[&](const std::unique_ptr<DataIO::Node>& rootNode, std::unique_ptr<DataIO::Node> section){
+                auto resources = preloader.preload(*section, loadHiddenWidgetsLazily);
+                pendingSections.emplace_back(std::move(section), std::move(resources));
+
+                while (!pendingSections.empty() && ResourcePreloader::isReady(pendingSections.front().second))
+                {
+                    loadSection(rootNode, pendingSections.front().first);
+                    pendingSections.pop_front();
+                }
+            }};
+
+        parse(reader);
+
+        for (const auto& pendingSection : pendingSections)
+            loadSection(reader.getRootNode(), pendingSection.first);
+
+        for (auto& pair : reader.getRootNode()->propertyValuePairs)
+            containerNode->propertyValuePairs[pair.first] = std::move(pair.second);
+
+        // The existing widgets are replaced by the ones that were loaded
+        removeAllWidgets();
 
+        if (!containerNode->propertyValuePairs.empty())
+            Widget::load(containerNode, {});
+
+        for (auto& loadedWidget : loadedWidgets)
+            add(loadedWidget.first, loadedWidget.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgets(const std::function<void(const DataIO::Node&)>& writeNode) const
+    {
         std::map<RendererData*, std::vector<const Widget*>> renderers;
         getAllRenderers(renderers, this);
 
@@ -437,59 +751,32 @@ namespace tgui
             // When the widget is shared, only provide the id instead of the node itself
             ++id;
             const std::string idStr = to_string(id);
-            node->children.push_back(saveRenderer(renderer.first, "Renderer." + idStr));
+            writeNode(*saveRenderer(renderer.first, "Renderer." + idStr));
             for (const auto& child : renderer.second)
                 renderersMap[child] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
         }
 
+        // Every widget is written as soon as it has been saved, the nodes don't have to be kept for the whole file
         for (const auto& child : getWidgets())
-            node->children.emplace_back(child->save(renderersMap));
-
-        DataIO::emit(node, stream);
+            writeNode(*child->save(renderersMap));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToFront(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
-
-            // Copy the widget
-            m_widgets.push_back(m_widgets[i]);
-            m_widgetNames.push_back(m_widgetNames[i]);
-
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + i);
-            m_widgetNames.erase(m_widgetNames.begin() + i);
-            break;
-        }
+        const auto it = std::find(m_widgets.begin(), m_widgets.end(), widget);
+        if (it != m_widgets.end())
+            moveWidgetToIndex(static_cast<std::size_t>(it - m_widgets.begin()), m_widgets.size() - 1);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::moveWidgetToBack(const Widget::Ptr& widget)
     {
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
-        {
-            if (m_widgets[i] != widget)
-                continue;
-
-            // Copy the widget
-            const Widget::Ptr obj = m_widgets[i];
-            const std::string name = m_widgetNames[i];
-            m_widgets.insert(m_widgets.begin(), obj);
-            m_widgetNames.insert(m_widgetNames.begin(), name);
-
-            // Remove the old widget
-            m_widgets.erase(m_widgets.begin() + i + 1);
-            m_widgetNames.erase(m_widgetNames.begin() + i + 1);
-            break;
-        }
+        const auto it = std::find(m_widgets.begin(), m_widgets.end(), widget);
+        if (it != m_widgets.end())
+            moveWidgetToIndex(static_cast<std::size_t>(it - m_widgets.begin()), 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -588,6 +875,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled, float cellSize)
+    {
+        if (enabled)
+        {
+            m_spatialIndex = std::make_unique<priv::SpatialIndex>(cellSize);
+            m_spatialIndexOutdated = true;
+        }
+        else
+            m_spatialIndex = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        if (m_spatialIndex && !m_spatialIndexOutdated)
+            m_spatialIndex->update(child, getSpatialIndexBounds(*child));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childTimeDependencyChanged(Widget* child)
+    {
+        if (child->m_timeDependent)
+            m_timeDependentWidgets.push_back(child->shared_from_this());
+        else
+        {
+            const auto it = std::find_if(m_timeDependentWidgets.begin(), m_timeDependentWidgets.end(),
+                                         [child](const Widget::Ptr& widget){ return widget.get() == child; });
+            if (it != m_timeDependentWidgets.end())
+                m_timeDependentWidgets.erase(it);
+        }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Container::getChildWidgetByLowercaseName(const std::string& lowercaseName) const
+    {
+        const auto it = m_widgetNameIndex.find(lowercaseName);
+        if (it != m_widgetNameIndex.end())
+            return it->second.widget.get();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -706,8 +1049,18 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
-        for (auto& widget : m_widgets)
-            widget->mouseNoLongerDown();
+        if (m_spatialIndex)
+        {
+            if (m_widgetWithMouseDown)
+                m_widgetWithMouseDown->mouseNoLongerDown();
+        }
+        else
+        {
+            for (auto& widget : m_widgets)
+                widget->mouseNoLongerDown();
+        }
+
+        m_widgetWithMouseDown = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -737,21 +1090,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const std::string& property)
+    void Container::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
-        {
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
-                m_widgets[i]->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "font")
+        switch (property)
         {
-            for (const auto& widget : m_widgets)
+            case Property::Opacity:
             {
-                if (m_fontCached != getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_widgets[i]->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
             }
         }
     }
@@ -774,7 +1132,23 @@ namespace tgui
     {
         Widget::load(node, renderers);
 
-        for (const auto& childNode : node->children)
+        // The child nodes are taken over when the creation of the widgets is delayed, the caller no longer needs them
+        if (loadingHiddenWidgetsLazily && !isVisible() && !node->children.empty())
+        {
+            m_pendingWidgetNodes = std::move(node->children);
+            m_pendingRenderers = renderers;
+            node->children.clear();
+            return;
+        }
+
+        loadChildWidgets(node->children, renderers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadChildWidgets(const std::vector<std::unique_ptr<DataIO::Node>>& childNodes, const LoadingRenderersMap& renderers)
+    {
+        for (const auto& childNode : childNodes)
         {
             const auto nameSeparator = childNode->name.find('.');
             const auto widgetType = childNode->name.substr(0, nameSeparator);
@@ -797,16 +1171,44 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::loadPendingWidgets() const
+    {
+        if (m_pendingWidgetNodes.empty())
+            return;
+
+        // The members are moved out first, as loading the widgets may call this function again (e.g. when a child calls get)
+        auto& container = const_cast<Container&>(*this);
+        const auto nodes = std::move(container.m_pendingWidgetNodes);
+        const auto renderers = std::move(container.m_pendingRenderers);
+        container.m_pendingWidgetNodes.clear();
+        container.m_pendingRenderers.clear();
+
+        // Hidden containers inside this one remain lazy, like they would have been when loaded together with this container
+        LazyLoadingScope lazyLoading{true};
+        container.loadChildWidgets(nodes, renderers);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Only the widgets that registered themselves as time-dependent are updated.
+        // The list is copied because widgets may stop being time-dependent or may even be removed while being updated.
+        if (!m_timeDependentWidgets.empty())
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            m_widgetsBeingUpdated = m_timeDependentWidgets;
+            for (const auto& widget : m_widgetsBeingUpdated)
+            {
+                if (widget->isVisible() && (widget->getParent() == this))
+                {
+                    TGUI_PROFILE_WIDGET_SCOPE(Update, *widget);
+                    widget->update(elapsedTime);
+                }
+            }
+
+            m_widgetsBeingUpdated.clear();
         }
 
         m_animationTimeElapsed = {};
@@ -814,6 +1216,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || !m_timeDependentWidgets.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -825,17 +1234,30 @@ namespace tgui
             else
                 mousePos = {static_cast<float>(event.touch.x), static_cast<float>(event.touch.y)};
 
-            // Loop through all widgets
-            for (auto& widget : m_widgets)
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            if (m_spatialIndex)
+            {
+                // The widget on which the mouse went down is tracked, so there is no need to look at all widgets
+                if (m_widgetWithMouseDown && m_widgetWithMouseDown->m_mouseDown
+                 && (m_widgetWithMouseDown->m_draggableWidget || m_widgetWithMouseDown->isContainer()))
+                {
+                    m_widgetWithMouseDown->mouseMoved(mousePos);
+                    return true;
+                }
+            }
+            else
             {
-                // Check if the mouse went down on the widget
-                if (widget->m_mouseDown)
+                // Loop through all widgets
+                for (auto& widget : m_widgets)
                 {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if (widget->m_draggableWidget || widget->isContainer())
+                    // Check if the mouse went down on the widget
+                    if (widget->m_mouseDown)
                     {
-                        widget->mouseMoved(mousePos);
-                        return true;
+                        if (widget->m_draggableWidget || widget->isContainer())
+                        {
+                            widget->mouseMoved(mousePos);
+                            return true;
+                        }
                     }
                 }
             }
@@ -877,6 +1299,7 @@ namespace tgui
                 if (((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Left))
                  || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
                 {
+                    m_widgetWithMouseDown = widget;
                     widget->leftMousePressed(mousePos);
                     return true;
                 }
@@ -918,8 +1341,18 @@ namespace tgui
             // it will happen afterwards when mouseNoLongerDown is called on it
             if (!m_handingMouseReleased)
             {
-                for (auto& widget : m_widgets)
-                    widget->mouseNoLongerDown();
+                if (m_spatialIndex)
+                {
+                    if (m_widgetWithMouseDown)
+                        m_widgetWithMouseDown->mouseNoLongerDown();
+                }
+                else
+                {
+                    for (auto& widget : m_widgets)
+                        widget->mouseNoLongerDown();
+                }
+
+                m_widgetWithMouseDown = nullptr;
             }
 
             if (widgetBelowMouse != nullptr)
@@ -988,19 +1421,40 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            if (m_spatialIndexOutdated)
+                rebuildSpatialIndex();
+
+            // Only the widgets of which the bounding rectangle contains the mouse have to be checked, topmost widget first
+            for (const std::size_t index : m_spatialIndex->query(mousePos))
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                const auto& child = m_widgets[index];
+                if (child->isVisible() && child->mouseOnWidget(mousePos))
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if (child->isEnabled())
+                        widget = child;
 
                     break;
                 }
             }
         }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if ((*it)->isVisible())
+                {
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
+
+                        break;
+                    }
+                }
+            }
+        }
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
@@ -1012,13 +1466,93 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::getChildWidgetByName(const sf::String& name) const
+    {
+        loadPendingWidgets();
+
+        const auto it = m_widgetNameIndex.find(toLower(name));
+        if (it == m_widgetNameIndex.end())
+            return nullptr;
+
+        if (it->second.name == name)
+            return it->second.widget;
+
+        // The first widget with this name differs in case, the widget we are looking for may come after it
+        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        {
+            if (m_widgetNames[i] == name)
+                return m_widgets[i];
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::moveWidgetToIndex(std::size_t oldIndex, std::size_t newIndex)
+    {
+        assert(oldIndex < m_widgets.size());
+        assert(newIndex < m_widgets.size());
+        if (oldIndex == newIndex)
+            return;
+
+        if (oldIndex < newIndex)
+        {
+            std::rotate(m_widgets.begin() + oldIndex, m_widgets.begin() + oldIndex + 1, m_widgets.begin() + newIndex + 1);
+            std::rotate(m_widgetNames.begin() + oldIndex, m_widgetNames.begin() + oldIndex + 1, m_widgetNames.begin() + newIndex + 1);
+        }
+        else
+        {
+            std::rotate(m_widgets.begin() + newIndex, m_widgets.begin() + oldIndex, m_widgets.begin() + oldIndex + 1);
+            std::rotate(m_widgetNames.begin() + newIndex, m_widgetNames.begin() + oldIndex, m_widgetNames.begin() + oldIndex + 1);
+        }
+
+        // The indices stored in the spatial index are no longer correct
+        m_spatialIndexOutdated = true;
+
+        // An earlier widget with the same name may now be located behind the moved widget, or the other way around
+        updateWidgetNameIndex(toLower(m_widgetNames[newIndex]));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetNameIndex(const std::string& lowercaseName)
+    {
+        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        {
+            if (toLower(m_widgetNames[i]) == lowercaseName)
+            {
+                m_widgetNameIndex[lowercaseName] = {m_widgets[i], m_widgetNames[i]};
+                return;
+            }
+        }
+
+        m_widgetNameIndex.erase(lowercaseName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::rebuildSpatialIndex()
+    {
+        m_spatialIndex->clear();
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            m_spatialIndex->insert(m_widgets[i].get(), i, getSpatialIndexBounds(*m_widgets[i]));
+
+        m_spatialIndexOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
             if (widget->isVisible())
+            {
+                TGUI_PROFILE_WIDGET_SCOPE(Draw, *widget);
                 widget->draw(*target, states);
+            }
         }
     }
 
@@ -1092,6 +1626,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::shared_ptr<AnimationScheduler>& GuiContainer::getAnimationScheduler() const
+    {
+        return m_animationScheduler;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::setFocused(bool focused)
     {
         Container::setFocused(focused);
@@ -26,9 +26,13 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/LayoutSolver.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <cassert>
 
 #ifdef SFML_SYSTEM_WINDOWS
@@ -88,6 +92,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Gui::~Gui()
+    {
+        // The widgets may outlive the gui, so their postponed layouts are recalculated before the gui forgets about them
+        setLayoutUpdatesDeferred(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
     void Gui::setTarget(sf::RenderWindow& window)
     {
@@ -131,8 +143,10 @@ namespace tgui
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
+            priv::LayoutSolver::suspend();
             for (auto& layout : m_container->m_boundSizeLayouts)
                 layout->recalculateValue();
+            priv::LayoutSolver::resume();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
@@ -153,6 +167,11 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        m_profiler.activate();
+        TGUI_PROFILE_GUI_SCOPE(HandleEvent);
+
+        processPostedFunctions();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -276,18 +295,32 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
-        // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        m_profiler.activate();
+        TGUI_PROFILE_GUI_SCOPE(Draw);
+
+        prepareDraw();
+
+        // Record what the widgets draw
+        const std::size_t subtreeCount = recordSubtreesInParallel(*m_target);
+        if (subtreeCount == 0)
+        {
+            m_renderCommands.clear();
+            const priv::RenderCommandRecorder recorder{m_renderCommands};
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        }
 
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
 
         // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        if (subtreeCount == 0)
+            m_target->draw(m_renderCommands);
+        else
+        {
+            for (std::size_t i = 0; i < subtreeCount; ++i)
+                m_target->draw(m_subtreeCommands[i]);
+        }
 
         // Restore the old view
         m_target->setView(oldView);
@@ -295,6 +328,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::draw(RenderCommandList& commands)
+    {
+        m_profiler.activate();
+        TGUI_PROFILE_GUI_SCOPE(Draw);
+
+        prepareDraw();
+
+        commands.clear();
+        sf::RenderTarget& target = priv::RenderCommandRecorder::getRecordingTarget();
+        const std::size_t subtreeCount = recordSubtreesInParallel(target);
+        if (subtreeCount == 0)
+        {
+            const priv::RenderCommandRecorder recorder{commands};
+            m_container->drawWidgetContainer(&target, sf::RenderStates::Default);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < subtreeCount; ++i)
+                commands.append(m_subtreeCommands[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -414,9 +471,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromFile(const std::string& filename)
+    void Gui::loadWidgetsFromFile(const std::string& filename, bool loadHiddenWidgetsLazily)
     {
-        m_container->loadWidgetsFromFile(filename);
+        m_container->loadWidgetsFromFile(filename, loadHiddenWidgetsLazily);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,30 +485,183 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromStream(std::stringstream& stream)
+    void Gui::loadWidgetsFromStream(std::istream& stream, bool loadHiddenWidgetsLazily)
     {
-        m_container->loadWidgetsFromStream(stream);
+        m_container->loadWidgetsFromStream(stream, loadHiddenWidgetsLazily);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromStream(std::stringstream&& stream)
+    void Gui::loadWidgetsFromStream(std::stringstream&& stream, bool loadHiddenWidgetsLazily)
     {
-        loadWidgetsFromStream(stream);
+        loadWidgetsFromStream(stream, loadHiddenWidgetsLazily);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToStream(std::stringstream& stream) const
+    void Gui::saveWidgetsToStream(std::ostream& stream) const
     {
         m_container->saveWidgetsToStream(stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::loadWidgetsFromBinaryStream(std::istream& stream, bool loadHiddenWidgetsLazily)
+    {
+        m_container->loadWidgetsFromBinaryStream(stream, loadHiddenWidgetsLazily);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::saveWidgetsToBinaryStream(std::ostream& stream) const
+    {
+        m_container->saveWidgetsToBinaryStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> function)
+    {
+        m_postedFunctions.push(std::move(function));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> function, const void* key)
+    {
+        m_postedFunctions.push(std::move(function), key);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setPostedFunctionsTimeBudget(sf::Time timeBudget)
+    {
+        m_postedFunctionsTimeBudget = timeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getPostedFunctionsTimeBudget() const
+    {
+        return m_postedFunctionsTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::processPostedFunctions()
+    {
+        m_postedFunctions.process(m_postedFunctionsTimeBudget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setLayoutUpdatesDeferred(bool deferred)
+    {
+        if (m_layoutUpdatesDeferred == deferred)
+            return;
+
+        m_layoutUpdatesDeferred = deferred;
+        priv::LayoutSolver::setDeferred(*m_container, deferred);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::getLayoutUpdatesDeferred() const
+    {
+        return m_layoutUpdatesDeferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateLayouts()
+    {
+        priv::LayoutSolver::solveDeferred(*m_container);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler& Gui::getAnimationScheduler()
+    {
+        return *m_container->getAnimationScheduler();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setProfilingEnabled(bool enabled)
+    {
+        m_profiler.setEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isProfilingEnabled() const
+    {
+        return m_profiler.isEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const FrameStatistics& Gui::getFrameStatistics() const
+    {
+        return m_profiler.getFrameStatistics();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::startChromeTrace()
+    {
+        m_profiler.startTrace();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::stopChromeTrace(const std::string& filename)
+    {
+        std::ofstream file{filename};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the trace to it."};
+
+        m_profiler.stopTrace(file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::stopChromeTrace(std::ostream& stream)
+    {
+        m_profiler.stopTrace(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setParallelDrawingEnabled(bool enabled, unsigned int threadCount)
+    {
+        m_parallelDrawing = enabled;
+
+        if (!enabled || (threadCount == 0))
+            m_drawThreadPool = nullptr;
+        else if (!m_drawThreadPool || (m_drawThreadPool->getThreadCount() != threadCount))
+            m_drawThreadPool = std::make_unique<priv::ThreadPool>(threadCount);
+
+        if (!enabled)
+            m_subtreeCommands.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isParallelDrawingEnabled() const
+    {
+        return m_parallelDrawing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        m_profiler.activate();
+        TGUI_PROFILE_GUI_SCOPE(UpdateTime);
+
         m_container->m_animationTimeElapsed = elapsedTime;
+        m_container->getAnimationScheduler()->update(elapsedTime);
         m_container->update(elapsedTime);
 
         if (m_tooltipPossible)
@@ -476,6 +686,100 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::prepareDraw()
+    {
+        processPostedFunctions();
+        updateLayouts();
+
+        // Update the time
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::recordSubtreesInParallel(sf::RenderTarget& target)
+    {
+        // The profiler can only be used from one thread
+        if (!m_parallelDrawing || priv::Profiler::getActive())
+            return 0;
+
+        std::vector<const Widget*> subtrees;
+        for (const auto& widget : m_container->getWidgets())
+        {
+            if (widget->isVisible())
+                subtrees.push_back(widget.get());
+        }
+
+        // There is nothing to gain from other threads when there is only one subtree
+        if (subtrees.size() < 2)
+            return 0;
+
+        if (m_subtreeCommands.size() < subtrees.size())
+            m_subtreeCommands.resize(subtrees.size());
+
+        // The state is shared with the helper tasks, because a task may only start after this function has already returned
+        // when the pool is busy with other work. Such a task finds no subtree left and doesn't touch anything else.
+        struct SharedState
+        {
+            std::atomic<std::size_t> nextSubtree{0};
+            std::size_t finishedSubtrees = 0;
+            std::exception_ptr exception;
+            std::mutex mutex;
+            std::condition_variable finishedCondition;
+        };
+        const auto state = std::make_shared<SharedState>();
+
+        const std::size_t subtreeCount = subtrees.size();
+        auto recordSubtrees = [state,subtreeCount,&subtrees,&target,this]{
+            for (std::size_t i = state->nextSubtree++; i < subtreeCount; i = state->nextSubtree++)
+            {
+                std::exception_ptr exception;
+                try
+                {
+                    RenderCommandList& commands = m_subtreeCommands[i];
+                    commands.clear();
+
+                    const priv::RenderCommandRecorder recorder{commands};
+                    subtrees[i]->draw(target, sf::RenderStates::Default);
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (exception && !state->exception)
+                    state->exception = exception;
+
+                if (++state->finishedSubtrees == subtreeCount)
+                    state->finishedCondition.notify_one();
+            }
+        };
+
+        // Fonts are only protected by a lock while this object exists
+        const priv::ParallelRecordingScope parallelRecording;
+
+        priv::ThreadPool& threadPool = m_drawThreadPool ? *m_drawThreadPool : priv::ThreadPool::getDefault();
+        const std::size_t helperCount = std::min<std::size_t>(threadPool.getThreadCount(), subtreeCount - 1);
+        for (std::size_t i = 0; i < helperCount; ++i)
+            threadPool.submit(recordSubtrees);
+
+        // This thread records subtrees as well instead of only waiting for the helpers
+        recordSubtrees();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finishedCondition.wait(lock, [&]{ return state->finishedSubtrees == subtreeCount; });
+        if (state->exception)
+            std::rethrow_exception(state->exception);
+
+        return subtreeCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
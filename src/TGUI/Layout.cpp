@@ -24,16 +24,46 @@
 
 
 #include <TGUI/Layout.hpp>
+#include <TGUI/LayoutSolver.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        bool endsWith(const std::string& str, const char* suffix)
+        {
+            const std::size_t suffixLength = std::strlen(suffix);
+            return (str.size() >= suffixLength) && (str.compare(str.size() - suffixLength, suffixLength, suffix) == 0);
+        }
+
+        float calculate(Layout::Operation operation, float left, float right)
+        {
+            switch (operation)
+            {
+                case Layout::Operation::Plus:
+                    return left + right;
+                case Layout::Operation::Minus:
+                    return left - right;
+                case Layout::Operation::Multiplies:
+                    return left * right;
+                case Layout::Operation::Divides:
+                    return (right != 0) ? left / right : 0;
+                default:
+                    assert(false);
+                    return 0;
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(std::string expression)
@@ -68,34 +98,34 @@ namespace tgui
             {
                 // The expression might reference to a widget instead of being a constant
                 expression = toLower(expression);
-                if ((expression.substr(expression.size()-1) == "x")
-                 || (expression.substr(expression.size()-1) == "y")
-                 || (expression.substr(expression.size()-1) == "w") // width
-                 || (expression.substr(expression.size()-1) == "h") // height
-                 || (expression.size() >= 2 && expression.substr(expression.size()-2) == "iw") // width inside the container
-                 || (expression.size() >= 2 && expression.substr(expression.size()-2) == "ih") // height inside the container
-                 || (expression.size() >= 4 && expression.substr(expression.size()-4) == "left")
-                 || (expression.size() >= 3 && expression.substr(expression.size()-3) == "top")
-                 || (expression.size() >= 5 && expression.substr(expression.size()-5) == "width")
-                 || (expression.size() >= 6 && expression.substr(expression.size()-6) == "height")
-                 || (expression.size() >= 4 && expression.substr(expression.size()-4) == "size")
-                 || (expression.size() >= 3 && expression.substr(expression.size()-3) == "pos")
-                 || (expression.size() >= 8 && expression.substr(expression.size()-8) == "position")
-                 || (expression.size() >= 9 && expression.substr(expression.size()-9) == "innersize")
-                 || (expression.size() >= 10 && expression.substr(expression.size()-10) == "innerwidth")
-                 || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
+                if (endsWith(expression, "x")
+                 || endsWith(expression, "y")
+                 || endsWith(expression, "w") // width
+                 || endsWith(expression, "h") // height
+                 || endsWith(expression, "iw") // width inside the container
+                 || endsWith(expression, "ih") // height inside the container
+                 || endsWith(expression, "left")
+                 || endsWith(expression, "top")
+                 || endsWith(expression, "width")
+                 || endsWith(expression, "height")
+                 || endsWith(expression, "size")
+                 || endsWith(expression, "pos")
+                 || endsWith(expression, "position")
+                 || endsWith(expression, "innersize")
+                 || endsWith(expression, "innerwidth")
+                 || endsWith(expression, "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
                     m_boundString = expression;
                     m_operation = Operation::BindingString;
                 }
-                else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
+                else if (endsWith(expression, "right"))
                 {
                     *this = Layout{Operation::Plus,
                                    std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
                                    std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
                 }
-                else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
+                else if (endsWith(expression, "bottom"))
                 {
                     *this = Layout{Operation::Plus,
                                    std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
@@ -193,8 +223,8 @@ namespace tgui
                 std::advance(nextOperandIt, 1);
 
                 (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                                      std::make_unique<Layout>(std::move(*operandIt)),
+                                      std::make_unique<Layout>(std::move(*nextOperandIt))};
 
                 operands.erase(nextOperandIt);
             }
@@ -216,15 +246,15 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
+                                      std::make_unique<Layout>(std::move(*operandIt)),
+                                      std::make_unique<Layout>(std::move(*nextOperandIt))};
 
                 operands.erase(nextOperandIt);
             }
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,29 +268,8 @@ namespace tgui
                || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
         assert(m_boundWidget != nullptr);
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
         resetPointers();
-        recalculateValue();
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,7 +282,7 @@ namespace tgui
         assert(m_leftOperand != nullptr);
         assert(m_rightOperand != nullptr);
         resetPointers();
-        recalculateValue();
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +338,7 @@ namespace tgui
                 m_boundWidget = nullptr;
 
             resetPointers();
+            invalidateProgram();
         }
 
         return *this;
@@ -351,6 +361,7 @@ namespace tgui
             m_boundString     = std::move(other.m_boundString);
 
             resetPointers();
+            invalidateProgram();
         }
 
         return *this;
@@ -361,6 +372,9 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
+
+        if (m_dirty || m_connectedWidget)
+            priv::LayoutSolver::forget(*this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,13 +461,14 @@ namespace tgui
     {
         const float oldValue = m_value;
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
+        m_connectedWidget = widget;
+        m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
 
-        parseBindingStringRecursive(widget, xAxis);
-
-        // Restore the callback function
-        m_connectedWidgetCallback = valueChangedCallbackHandler;
+        if (parseBindingStringRecursive(widget, xAxis))
+        {
+            invalidateProgram();
+            evaluate();
+        }
 
         if (m_value != oldValue)
         {
@@ -476,6 +491,7 @@ namespace tgui
             m_operation = Operation::Value;
         }
 
+        invalidateProgram();
         recalculateValue();
     }
 
@@ -483,26 +499,36 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
-        const float oldValue = m_value;
+        priv::LayoutSolver::markDirty(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Layout::getCircularDependency()
+    {
+        return priv::LayoutSolver::getCircularDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Layout::clearCircularDependency()
+    {
+        priv::LayoutSolver::clearCircularDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::calculateValue()
+    {
         switch (m_operation)
         {
             case Operation::Value:
                 break;
             case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
             case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
             case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
             case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
+                m_value = calculate(m_operation, m_leftOperand->getValue(), m_rightOperand->getValue());
                 break;
             case Operation::BindingLeft:
                 m_value = m_boundWidget->getPosition().x;
@@ -535,40 +561,167 @@ namespace tgui
                 // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
                 break;
         };
+    }
 
-        if (m_value != oldValue)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::evaluate()
+    {
+        if (!m_programCompiled)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            m_program.clear();
+            m_programStackSize = compile(m_program);
+            m_programCompiled = true;
+        }
+
+        // Most expressions are small enough to be calculated without allocating memory
+        float fixedStack[16];
+        std::vector<float> dynamicStack;
+        float* stack = fixedStack;
+        if (m_programStackSize > 16)
+        {
+            dynamicStack.resize(m_programStackSize);
+            stack = dynamicStack.data();
+        }
+
+        std::size_t top = 0;
+        for (const auto& instruction : m_program)
+        {
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                    stack[top++] = instruction.value;
+                    break;
+                case Operation::Plus:
+                    --top;
+                    stack[top-1] += stack[top];
+                    break;
+                case Operation::Minus:
+                    --top;
+                    stack[top-1] -= stack[top];
+                    break;
+                case Operation::Multiplies:
+                    --top;
+                    stack[top-1] *= stack[top];
+                    break;
+                case Operation::Divides:
+                    --top;
+                    stack[top-1] = (stack[top] != 0) ? stack[top-1] / stack[top] : 0;
+                    break;
+                case Operation::BindingLeft:
+                    stack[top++] = instruction.widget->getPosition().x;
+                    break;
+                case Operation::BindingTop:
+                    stack[top++] = instruction.widget->getPosition().y;
+                    break;
+                case Operation::BindingWidth:
+                    stack[top++] = instruction.widget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    stack[top++] = instruction.widget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth:
+                    stack[top++] = static_cast<const Container*>(instruction.widget)->getInnerSize().x;
+                    break;
+                case Operation::BindingInnerHeight:
+                    stack[top++] = static_cast<const Container*>(instruction.widget)->getInnerSize().y;
+                    break;
+                case Operation::BindingString: // Never part of a compiled program
+                    assert(false);
+                    break;
+            };
+        }
+
+        assert(top == 1);
+        m_value = stack[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Layout::compile(std::vector<Instruction>& program) const
+    {
+        if (m_leftOperand)
+        {
+            assert(m_rightOperand != nullptr);
+
+            const std::size_t leftStart = program.size();
+            const std::size_t leftStackSize = m_leftOperand->compile(program);
+            const std::size_t rightStart = program.size();
+            const std::size_t rightStackSize = m_rightOperand->compile(program);
+
+            // If both operands are constants then the result is also a constant
+            if ((rightStart == leftStart + 1) && (program.size() == rightStart + 1)
+             && (program[leftStart].operation == Operation::Value) && (program[rightStart].operation == Operation::Value))
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                program[leftStart].value = calculate(m_operation, program[leftStart].value, program[rightStart].value);
+                program.pop_back();
+                return 1;
             }
+
+            program.push_back({m_operation, 0, nullptr});
+
+            // The result of the left operand stays on the stack while the right operand is calculated
+            return std::max(leftStackSize, rightStackSize + 1);
         }
+
+        switch (m_operation)
+        {
+            case Operation::BindingLeft:
+            case Operation::BindingTop:
+            case Operation::BindingWidth:
+            case Operation::BindingHeight:
+                program.push_back({m_operation, 0, m_boundWidget});
+                break;
+            case Operation::BindingInnerWidth:
+            case Operation::BindingInnerHeight:
+                // The inner size only exists for containers, other widgets keep the value that the layout already had
+                if (dynamic_cast<const Container*>(m_boundWidget))
+                    program.push_back({m_operation, 0, m_boundWidget});
+                else
+                    program.push_back({Operation::Value, m_value, nullptr});
+                break;
+            default: // Constants and strings that couldn't be bound yet keep their current value
+                program.push_back({Operation::Value, m_value, nullptr});
+                break;
+        };
+
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::invalidateProgram()
+    {
+        Layout* root = this;
+        while (root->m_parent)
+            root = root->m_parent;
+
+        root->m_programCompiled = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    bool Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
     {
+        bool widgetBound = false;
         if (m_leftOperand)
         {
             assert(m_rightOperand != nullptr);
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            widgetBound |= m_leftOperand->parseBindingStringRecursive(widget, xAxis);
+            widgetBound |= m_rightOperand->parseBindingStringRecursive(widget, xAxis);
         }
 
         // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
         if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+            widgetBound |= parseBindingString(m_boundString, widget, xAxis);
+
+        return widgetBound;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    bool Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
     {
         if (expression == "x" || expression == "left")
         {
@@ -638,35 +791,27 @@ namespace tgui
                     Container* container = dynamic_cast<Container*>(widget);
                     if (container != nullptr)
                     {
-                        const auto& widgets = container->getWidgets();
-                        const auto& widgetNames = container->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
+                        Widget* child = container->getChildWidgetByLowercaseName(widgetName);
+                        if (child)
+                            return parseBindingString(expression.substr(dotPos+1), child, xAxis);
                     }
 
                     // If the widget has a parent, look for a sibling
                     if (widget->getParent())
                     {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        const auto& widgetNames = widget->getParent()->getWidgetNames();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
+                        Widget* sibling = widget->getParent()->getChildWidgetByLowercaseName(widgetName);
+                        if (sibling)
+                            return parseBindingString(expression.substr(dotPos+1), sibling, xAxis);
                     }
                 }
             }
 
             // The referred widget was not found or there was something wrong with the string
-            return;
+            return false;
         }
 
         resetPointers();
-        recalculateValue();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,419 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/Container.hpp>
+#include <SFML/System/Err.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            struct SolverState
+            {
+                std::vector<Layout*> dirtyLayouts; // Dirty layouts that are not part of the pass that is being executed
+                std::vector<Layout*> deferredLayouts; // Dirty layouts of widgets in a gui that postpones its layout updates
+                std::vector<Layout*> order; // Layouts in the order in which they are evaluated in the current pass
+                std::unordered_set<const Widget*> deferredRoots; // Root containers of the guis that postpone their layout updates
+                std::string circularDependency; // Description of the cycle that was found most recently
+                unsigned int suspendCount = 0;
+                bool solving = false;
+            };
+
+            SolverState& getState()
+            {
+                static SolverState state;
+                return state;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Returns a name like "Button1.size" to describe the layout in warnings
+            std::string describeLayout(const Layout& layout, const Widget& widget)
+            {
+                std::string name;
+                if (widget.getParent())
+                {
+                    const auto& widgets = widget.getParent()->getWidgets();
+                    const auto& widgetNames = widget.getParent()->getWidgetNames();
+                    for (std::size_t i = 0; i < widgets.size(); ++i)
+                    {
+                        if (widgets[i].get() == &widget)
+                            name = widgetNames[i];
+                    }
+                }
+
+                if (name.empty())
+                    name = "<unnamed " + widget.getWidgetType() + ">";
+
+                if (&layout == &widget.getPositionLayout().x)
+                    return name + ".position";
+                else
+                    return name + ".size";
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::sortLayouts(const std::vector<Layout*>& layouts, std::vector<Layout*>& order, std::unordered_set<Layout*>& cyclicLayouts)
+        {
+            enum class Mark
+            {
+                Visiting,
+                Done
+            };
+
+            struct Frame
+            {
+                Layout* layout;
+                std::vector<Layout*> dependents;
+                std::size_t nextDependent;
+            };
+
+            std::unordered_map<Layout*, Mark> marks;
+            std::vector<Frame> stack;
+            order.clear();
+
+            // Depth-first search over the dependents, a layout is added to the order after all layouts that depend on it
+            for (auto* layout : layouts)
+            {
+                if (marks.find(layout) != marks.end())
+                    continue;
+
+                marks[layout] = Mark::Visiting;
+                stack.push_back({layout, getDependents(*layout), 0});
+                while (!stack.empty())
+                {
+                    Frame& frame = stack.back();
+                    if (frame.nextDependent < frame.dependents.size())
+                    {
+                        Layout* dependent = frame.dependents[frame.nextDependent++];
+                        const auto markIt = marks.find(dependent);
+                        if (markIt == marks.end())
+                        {
+                            marks[dependent] = Mark::Visiting;
+                            stack.push_back({dependent, getDependents(*dependent), 0});
+                        }
+                        else if (markIt->second == Mark::Visiting)
+                        {
+                            // The dependent is still on the stack, so the layouts from there until here form a cycle.
+                            // The dependency is ignored so that all layouts can still be evaluated in some order.
+                            // Each layout on the stack depends on the one below it and the bottom one depends on the top one.
+                            std::string description = describeLayout(*frame.layout, *frame.layout->m_connectedWidget);
+                            auto frameIt = std::find_if(stack.begin(), stack.end(), [=](const Frame& f){ return f.layout == dependent; });
+                            for (; frameIt != stack.end(); ++frameIt)
+                            {
+                                cyclicLayouts.insert(frameIt->layout);
+                                description = describeLayout(*frameIt->layout, *frameIt->layout->m_connectedWidget) + " depends on " + description;
+                            }
+
+                            TGUI_PRINT_WARNING("circular dependency between layouts: " << description << ".");
+                            getState().circularDependency = std::move(description);
+                        }
+                    }
+                    else
+                    {
+                        marks[frame.layout] = Mark::Done;
+                        order.push_back(frame.layout);
+                        stack.pop_back();
+                    }
+                }
+            }
+
+            std::reverse(order.begin(), order.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<Layout*> LayoutSolver::getDependents(const Layout& layout)
+        {
+            std::vector<Layout*> dependents;
+            const Widget* widget = layout.m_connectedWidget;
+            if (!widget)
+                return dependents;
+
+            const bool isPosition = (&layout == &widget->getPositionLayout().x);
+            const auto& boundLayouts = isPosition ? widget->m_boundPositionLayouts : widget->m_boundSizeLayouts;
+            dependents.reserve(boundLayouts.size());
+            for (Layout* boundLayout : boundLayouts)
+            {
+                Layout* dependent = &getNode(*boundLayout);
+
+                // A width that depends on the height of the same widget is handled by the widget itself
+                if (dependent != &layout)
+                    dependents.push_back(dependent);
+            }
+
+            return dependents;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Layout& LayoutSolver::getNode(Layout& layout)
+        {
+            Layout* root = &layout;
+            while (root->m_parent)
+                root = root->m_parent;
+
+            const Widget* widget = root->m_connectedWidget;
+            if (!widget)
+                return *root;
+
+            // The widget always updates both coordinates at once, so the x and y layouts are treated as a single node
+            const Layout2d& position = widget->getPositionLayout();
+            if ((root == &position.x) || (root == &position.y))
+                return const_cast<Layout&>(position.x);
+            else
+                return const_cast<Layout&>(widget->getSizeLayout().x);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const Widget* LayoutSolver::getRoot(const Layout& node)
+        {
+            const Widget* widget = node.m_connectedWidget;
+            if (!widget)
+                return nullptr;
+
+            while (widget->getParent())
+                widget = widget->getParent();
+
+            return widget;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool LayoutSolver::evaluateNode(Layout& layout)
+        {
+            const float oldValue = layout.m_value;
+            layout.evaluate();
+            bool valueChanged = (layout.m_value != oldValue);
+
+            const Widget* widget = layout.m_connectedWidget;
+            if (widget)
+            {
+                Layout& layoutY = const_cast<Layout&>((&layout == &widget->getPositionLayout().x) ? widget->getPositionLayout().y : widget->getSizeLayout().y);
+                const float oldValueY = layoutY.m_value;
+                layoutY.evaluate();
+                if (layoutY.m_value != oldValueY)
+                    valueChanged = true;
+            }
+
+            return valueChanged;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::markDirty(Layout& layout)
+        {
+            Layout& node = getNode(layout);
+
+            auto& state = getState();
+            if (!node.m_dirty)
+            {
+                node.m_dirty = true;
+
+                // Layouts that change while solving always belong to the current pass, as its layouts depend on them
+                if (!state.solving && !state.deferredRoots.empty() && (state.deferredRoots.find(getRoot(node)) != state.deferredRoots.end()))
+                    state.deferredLayouts.push_back(&node);
+                else
+                    state.dirtyLayouts.push_back(&node);
+            }
+
+            if ((state.suspendCount == 0) && !state.solving)
+                solve();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::forget(Layout& layout)
+        {
+            auto& state = getState();
+            if (layout.m_dirty)
+            {
+                layout.m_dirty = false;
+                state.dirtyLayouts.erase(std::remove(state.dirtyLayouts.begin(), state.dirtyLayouts.end(), &layout), state.dirtyLayouts.end());
+                state.deferredLayouts.erase(std::remove(state.deferredLayouts.begin(), state.deferredLayouts.end(), &layout), state.deferredLayouts.end());
+            }
+
+            if (state.solving)
+                std::replace(state.order.begin(), state.order.end(), &layout, static_cast<Layout*>(nullptr));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::suspend()
+        {
+            getState().suspendCount++;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::resume()
+        {
+            auto& state = getState();
+            assert(state.suspendCount > 0);
+            state.suspendCount--;
+
+            if ((state.suspendCount == 0) && !state.solving && !state.dirtyLayouts.empty())
+                solve();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::setDeferred(const Widget& root, bool deferred)
+        {
+            auto& state = getState();
+            if (deferred)
+                state.deferredRoots.insert(&root);
+            else
+            {
+                state.deferredRoots.erase(&root);
+                solveDeferred(root);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::solveDeferred(const Widget& root)
+        {
+            auto& state = getState();
+
+            // Layouts of widgets that were moved to a gui that doesn't postpone its updates are also released here
+            const auto it = std::stable_partition(state.deferredLayouts.begin(), state.deferredLayouts.end(), [&](const Layout* layout){
+                    const Widget* layoutRoot = getRoot(*layout);
+                    return (layoutRoot != &root) && (state.deferredRoots.find(layoutRoot) != state.deferredRoots.end());
+                });
+
+            state.dirtyLayouts.insert(state.dirtyLayouts.end(), it, state.deferredLayouts.end());
+            state.deferredLayouts.erase(it, state.deferredLayouts.end());
+            solve();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::solve()
+        {
+            auto& state = getState();
+            if (state.solving || state.dirtyLayouts.empty())
+                return;
+
+            state.solving = true;
+
+            // Layouts that are part of a cycle are only evaluated in the first pass, otherwise they could keep changing forever
+            std::unordered_set<Layout*> cyclicLayouts;
+            std::vector<Layout*> layouts;
+            bool firstPass = true;
+            while (!state.dirtyLayouts.empty())
+            {
+                layouts.clear();
+                layouts.swap(state.dirtyLayouts);
+                if (!firstPass)
+                {
+                    for (auto it = layouts.begin(); it != layouts.end();)
+                    {
+                        if (cyclicLayouts.find(*it) != cyclicLayouts.end())
+                        {
+                            (*it)->m_dirty = false;
+                            it = layouts.erase(it);
+                        }
+                        else
+                            ++it;
+                    }
+                }
+
+                sortLayouts(layouts, state.order, cyclicLayouts);
+
+                // The callbacks may destroy layouts, in which case their pointer in the order is replaced by a nullptr
+                for (std::size_t i = 0; i < state.order.size(); ++i)
+                {
+                    Layout* layout = state.order[i];
+                    if (!layout || !layout->m_dirty)
+                        continue;
+
+                    layout->m_dirty = false;
+
+                    if (evaluateNode(*layout) && layout->m_connectedWidgetCallback)
+                    {
+                        // The callback reconnects the layout, so the function that is being executed has to be a copy
+                        const auto callback = layout->m_connectedWidgetCallback;
+                        try
+                        {
+                            callback();
+                        }
+                        catch (...)
+                        {
+                            // Keep the layouts that weren't evaluated yet so that they are recalculated during the next pass
+                            for (std::size_t j = i + 1; j < state.order.size(); ++j)
+                            {
+                                if (state.order[j] && state.order[j]->m_dirty)
+                                    state.dirtyLayouts.push_back(state.order[j]);
+                            }
+
+                            state.order.clear();
+                            state.solving = false;
+                            throw;
+                        }
+                    }
+                }
+
+                state.order.clear();
+                firstPass = false;
+            }
+
+            state.solving = false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool LayoutSolver::hasDirtyLayouts()
+        {
+            return !getState().dirtyLayouts.empty();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::string& LayoutSolver::getCircularDependency()
+        {
+            return getState().circularDependency;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void LayoutSolver::clearCircularDependency()
+        {
+            getState().circularDependency.clear();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,469 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/BinaryForm.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/to_string.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Layout of a binary form:
+        //   header:  magic (8 bytes), version (32-bit little endian)
+        //   records: record type (1 byte) followed by its contents, until the End record
+        // Sizes are stored as variable-length integers with 7 bits per byte, the highest bit indicates that more bytes follow.
+        // A string is stored as a size: 0 is followed by the length and UTF-8 characters of a string that is added to the
+        // string table, any other value refers to the string at that index (starting from 1) in the string table.
+        const char binaryFormMagic[8] = {'T', 'G', 'U', 'I', 'F', 'R', 'M', '\x1A'};
+        const std::uint32_t binaryFormVersion = 1;
+
+        enum class Record : unsigned char
+        {
+            End,            // End of the form
+            BeginNode,      // Name of the section
+            EndNode,        // No contents
+            Property,       // Key and value
+            ListProperty    // Key, value, item count and items
+        };
+
+        // Upper limit of the amount of bytes that are allocated at once while reading a string
+        const std::size_t maxStringChunkSize = 64 * 1024;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        class Reader
+        {
+        public:
+            explicit Reader(std::istream& stream) :
+                m_buffer{*stream.rdbuf()}
+            {
+            }
+
+            Record readRecord()
+            {
+                return static_cast<Record>(readByte());
+            }
+
+            std::size_t readSize()
+            {
+                std::size_t size = 0;
+                for (unsigned int shift = 0; shift < 64; shift += 7)
+                {
+                    const unsigned char byte = readByte();
+                    size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+                    if (!(byte & 0x80))
+                        return size;
+                }
+
+                throw Exception{"Failed to read binary form, invalid size found."};
+            }
+
+            const std::string& readString()
+            {
+                const std::size_t index = readSize();
+                if (index > 0)
+                {
+                    if (index > m_strings.size())
+                        throw Exception{"Failed to read binary form, reference to unknown string found."};
+
+                    return m_strings[index - 1];
+                }
+
+                // The string is read in chunks, so that a corrupt length can't cause a huge allocation
+                std::size_t length = readSize();
+                std::string str;
+                while (length > 0)
+                {
+                    const std::size_t chunkSize = std::min(length, maxStringChunkSize);
+                    const std::size_t oldSize = str.size();
+                    str.resize(oldSize + chunkSize);
+                    if (static_cast<std::size_t>(m_buffer.sgetn(&str[oldSize], static_cast<std::streamsize>(chunkSize))) != chunkSize)
+                        throw Exception{"Failed to read binary form, unexpected end of input."};
+
+                    length -= chunkSize;
+                }
+
+                m_strings.push_back(std::move(str));
+                return m_strings.back();
+            }
+
+            sf::String readValue()
+            {
+                const std::string& str = readString();
+                return sf::String::fromUtf8(str.begin(), str.end());
+            }
+
+            std::uint32_t readUint32()
+            {
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(readByte()) << (8 * i);
+
+                return value;
+            }
+
+            unsigned char readByte()
+            {
+                const auto byte = m_buffer.sbumpc();
+                if (byte == std::streambuf::traits_type::eof())
+                    throw Exception{"Failed to read binary form, unexpected end of input."};
+
+                return static_cast<unsigned char>(byte);
+            }
+
+        private:
+            std::streambuf& m_buffer;
+            std::vector<std::string> m_strings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Visitor that builds the tree of nodes that is returned by BinaryForm::parse
+        class TreeBuilder : public DataIO::Visitor
+        {
+        public:
+            TreeBuilder() :
+                m_root{std::make_unique<DataIO::Node>()},
+                m_openNodes{m_root.get()}
+            {
+            }
+
+            void beginNode(const std::string& name) override
+            {
+                auto node = std::make_unique<DataIO::Node>();
+                node->parent = m_openNodes.back();
+                node->name = name;
+
+                m_openNodes.push_back(node.get());
+                node->parent->children.push_back(std::move(node));
+            }
+
+            void property(const std::string& key, std::unique_ptr<DataIO::ValueNode> value) override
+            {
+                m_openNodes.back()->propertyValuePairs[key] = std::move(value);
+            }
+
+            void endNode() override
+            {
+                m_openNodes.pop_back();
+            }
+
+            std::unique_ptr<DataIO::Node> takeRoot()
+            {
+                return std::move(m_root);
+            }
+
+        private:
+            std::unique_ptr<DataIO::Node> m_root;
+            std::vector<DataIO::Node*> m_openNodes;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BinaryForm::Writer::Writer(std::ostream& stream) :
+        m_stream{stream}
+    {
+        m_stream.write(binaryFormMagic, sizeof(binaryFormMagic));
+
+        const char version[4] = {static_cast<char>(binaryFormVersion & 0xFF),
+                                 static_cast<char>((binaryFormVersion >> 8) & 0xFF),
+                                 static_cast<char>((binaryFormVersion >> 16) & 0xFF),
+                                 static_cast<char>((binaryFormVersion >> 24) & 0xFF)};
+        m_stream.write(version, 4);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::beginNode(const std::string& name)
+    {
+        m_stream.put(static_cast<char>(Record::BeginNode));
+        writeString(name);
+        ++m_depth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::property(const std::string& key, std::unique_ptr<DataIO::ValueNode> value)
+    {
+        property(key, *value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::property(const std::string& key, const DataIO::ValueNode& value)
+    {
+        // Widgets save their lists as plain values, they are split here so that they are read as lists again
+        DataIO::ValueNode listValue;
+        if (!value.listNode && !value.value.isEmpty() && (value.value[0] == '['))
+        {
+            listValue.value = value.value;
+            DataIO::parseList(listValue);
+        }
+
+        const DataIO::ValueNode& valueNode = listValue.listNode ? listValue : value;
+        if (valueNode.listNode)
+        {
+            m_stream.put(static_cast<char>(Record::ListProperty));
+            writeKey(key);
+            writeString(valueNode.value);
+            writeSize(valueNode.valueList.size());
+            for (const auto& item : valueNode.valueList)
+                writeString(item);
+        }
+        else
+        {
+            m_stream.put(static_cast<char>(Record::Property));
+            writeKey(key);
+            writeString(valueNode.value);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::endNode()
+    {
+        assert(m_depth > 0);
+        m_stream.put(static_cast<char>(Record::EndNode));
+        --m_depth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::writeNode(const DataIO::Node& node)
+    {
+        beginNode(node.name);
+
+        for (const auto& pair : node.propertyValuePairs)
+            property(pair.first, *pair.second);
+
+        for (const auto& child : node.children)
+            writeNode(*child);
+
+        endNode();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::finish()
+    {
+        assert(m_depth == 0);
+        m_stream.put(static_cast<char>(Record::End));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::writeSize(std::size_t size)
+    {
+        char bytes[(sizeof(std::size_t) * 8 + 6) / 7];
+        std::size_t count = 0;
+        while (size >= 0x80)
+        {
+            bytes[count++] = static_cast<char>((size & 0x7F) | 0x80);
+            size >>= 7;
+        }
+
+        bytes[count++] = static_cast<char>(size);
+        m_stream.write(bytes, static_cast<std::streamsize>(count));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::writeString(const std::string& str)
+    {
+        const auto it = m_strings.find(str);
+        if (it != m_strings.end())
+        {
+            writeSize(it->second);
+            return;
+        }
+
+        writeSize(0);
+        writeSize(str.size());
+        m_stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+
+        const std::size_t index = m_strings.size() + 1;
+        m_strings.emplace(str, index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::writeString(const sf::String& str)
+    {
+        // Most values only contain ASCII characters, which don't need to be encoded
+        m_buffer.clear();
+        for (const sf::Uint32 chr : str)
+        {
+            if (chr >= 0x80)
+            {
+                const auto utf8 = str.toUtf8();
+                m_buffer.assign(utf8.begin(), utf8.end());
+                break;
+            }
+
+            m_buffer.push_back(static_cast<char>(chr));
+        }
+
+        writeString(m_buffer);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::Writer::writeKey(const std::string& key)
+    {
+        // Widgets use the same keys over and over, so the index of their lowercase version is remembered
+        const auto it = m_keys.find(key);
+        if (it != m_keys.end())
+        {
+            writeSize(it->second);
+            return;
+        }
+
+        // Keys are stored in lowercase, like they are returned when parsing the text format
+        const std::string lowercaseKey = toLower(key);
+        writeString(lowercaseKey);
+        m_keys.emplace(key, m_strings[lowercaseKey]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BinaryForm::isBinaryForm(std::istream& stream)
+    {
+        const auto position = stream.tellg();
+
+        char magic[sizeof(binaryFormMagic)];
+        stream.read(magic, sizeof(magic));
+        const bool isBinary = (stream.gcount() == sizeof(magic)) && (std::memcmp(magic, binaryFormMagic, sizeof(magic)) == 0);
+
+        stream.clear();
+        stream.seekg(position);
+        return isBinary;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::parse(std::istream& stream, DataIO::Visitor& visitor)
+    {
+        Reader reader{stream};
+
+        char magic[sizeof(binaryFormMagic)];
+        for (auto& byte : magic)
+            byte = static_cast<char>(reader.readByte());
+
+        if (std::memcmp(magic, binaryFormMagic, sizeof(magic)) != 0)
+            throw Exception{"Failed to read binary form, the input is not a binary form."};
+
+        const std::uint32_t version = reader.readUint32();
+        if (version != binaryFormVersion)
+            throw Exception{"Failed to read binary form, unsupported version " + to_string(version) + "."};
+
+        std::size_t depth = 0;
+        while (true)
+        {
+            switch (reader.readRecord())
+            {
+                case Record::End:
+                {
+                    if (depth > 0)
+                        throw Exception{"Failed to read binary form, a section was not closed."};
+
+                    return;
+                }
+                case Record::BeginNode:
+                {
+                    visitor.beginNode(reader.readString());
+                    ++depth;
+                    break;
+                }
+                case Record::EndNode:
+                {
+                    if (depth == 0)
+                        throw Exception{"Failed to read binary form, end of section found outside a section."};
+
+                    visitor.endNode();
+                    --depth;
+                    break;
+                }
+                case Record::Property:
+                {
+                    const std::string key = reader.readString();
+                    visitor.property(key, std::make_unique<DataIO::ValueNode>(reader.readValue()));
+                    break;
+                }
+                case Record::ListProperty:
+                {
+                    const std::string key = reader.readString();
+                    auto valueNode = std::make_unique<DataIO::ValueNode>(reader.readValue());
+                    valueNode->listNode = true;
+
+                    const std::size_t itemCount = reader.readSize();
+                    for (std::size_t i = 0; i < itemCount; ++i)
+                        valueNode->valueList.push_back(reader.readValue());
+
+                    visitor.property(key, std::move(valueNode));
+                    break;
+                }
+                default:
+                    throw Exception{"Failed to read binary form, unknown record found."};
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> BinaryForm::parse(std::istream& stream)
+    {
+        TreeBuilder builder;
+        parse(stream, builder);
+        return builder.takeRoot();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryForm::emit(const DataIO::Node& rootNode, std::ostream& stream)
+    {
+        Writer writer{stream};
+        for (const auto& pair : rootNode.propertyValuePairs)
+            writer.property(pair.first, *pair.second);
+
+        for (const auto& child : rootNode.children)
+            writer.writeNode(*child);
+
+        writer.finish();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,767 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/PropertyTable.hpp>
+#include <TGUI/Global.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Layout of a binary theme, all numbers are stored as 32-bit little endian values:
+        //   header:     magic (8 bytes), version, section count, named section count, property count, rect count, string count
+        //   sections:   name string, first property, property count
+        //   properties: name string, value type, 4 values
+        //   rects:      left, top, width, height
+        //   strings:    end offset of each string relative to the string data, followed by the UTF-8 string data
+        // The named sections are stored first and are sorted on their name, nested sections don't have a name.
+        const char binaryThemeMagic[8] = {'T', 'G', 'U', 'I', 'T', 'H', 'M', '\x1A'};
+        const std::uint32_t binaryThemeVersion = 1;
+
+        const std::size_t headerSize = 8 + 6 * 4;
+        const std::size_t sectionSize = 3 * 4;
+        const std::size_t propertySize = 6 * 4;
+        const std::size_t rectSize = 4 * 4;
+
+        enum class ValueType : std::uint32_t
+        {
+            String,
+            Number,
+            Bool,
+            Color,
+            Outline,
+            TextStyle,
+            Texture,
+            RendererData
+        };
+
+        // Flags that are stored with strings and textures
+        const std::uint32_t SmoothTexture = 1;        // The texture should be smoothed
+        const std::uint32_t RelativeToTheme = 2;      // The directory of the theme file has to be inserted in front of the filename
+        const std::uint32_t RelativeToResources = 4;  // The resource path has to be inserted in front of the filename
+
+        struct PropertyRecord
+        {
+            std::uint32_t name = 0;
+            ValueType type = ValueType::String;
+            std::uint32_t values[4] = {0, 0, 0, 0};
+        };
+
+        struct SectionRecord
+        {
+            std::uint32_t name = 0;
+            std::vector<PropertyRecord> properties;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::ostream& output, std::uint32_t value)
+        {
+            const char bytes[4] = {static_cast<char>(value & 0xFF),
+                                   static_cast<char>((value >> 8) & 0xFF),
+                                   static_cast<char>((value >> 16) & 0xFF),
+                                   static_cast<char>((value >> 24) & 0xFF)};
+            output.write(bytes, 4);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t readUint32(const char* data)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<std::uint32_t>(bytes[0])
+                 | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                 | (static_cast<std::uint32_t>(bytes[2]) << 16)
+                 | (static_cast<std::uint32_t>(bytes[3]) << 24);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t floatToUint32(float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float uint32ToFloat(std::uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isAbsolutePath(const std::string& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            return !filename.empty() && ((filename[0] == '/') || (filename[0] == '\\') || ((filename.size() > 1) && (filename[1] == ':')));
+        #else
+            return !filename.empty() && (filename[0] == '/');
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the directory of the theme from a filename, which was inserted by the DefaultThemeLoader
+        bool removeThemeDirectory(std::string& filename, const std::string& themeDirectory)
+        {
+            if (themeDirectory.empty() || (filename.compare(0, themeDirectory.size(), themeDirectory) != 0))
+                return false;
+
+            filename.erase(0, themeDirectory.size());
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        class ThemeWriter
+        {
+        public:
+
+            ThemeWriter(std::size_t namedSectionCount, const std::string& themeDirectory) :
+                m_sections(namedSectionCount),
+                m_namedSectionCount(namedSectionCount),
+                m_themeDirectory(themeDirectory)
+            {
+                addString("");
+            }
+
+            void setSection(std::size_t index, const std::string& name, const std::map<sf::String, sf::String>& properties)
+            {
+                // Converting the properties may add nested sections, so the vector is only accessed afterwards
+                auto records = convertProperties(properties);
+                m_sections[index].name = addString(name);
+                m_sections[index].properties = std::move(records);
+            }
+
+            void write(std::ostream& output) const
+            {
+                output.write(binaryThemeMagic, sizeof(binaryThemeMagic));
+                writeUint32(output, binaryThemeVersion);
+                writeUint32(output, static_cast<std::uint32_t>(m_sections.size()));
+                writeUint32(output, static_cast<std::uint32_t>(m_namedSectionCount));
+
+                std::uint32_t propertyCount = 0;
+                for (const auto& section : m_sections)
+                    propertyCount += static_cast<std::uint32_t>(section.properties.size());
+
+                writeUint32(output, propertyCount);
+                writeUint32(output, static_cast<std::uint32_t>(m_rects.size()));
+                writeUint32(output, static_cast<std::uint32_t>(m_strings.size()));
+
+                std::uint32_t firstProperty = 0;
+                for (const auto& section : m_sections)
+                {
+                    writeUint32(output, section.name);
+                    writeUint32(output, firstProperty);
+                    writeUint32(output, static_cast<std::uint32_t>(section.properties.size()));
+                    firstProperty += static_cast<std::uint32_t>(section.properties.size());
+                }
+
+                for (const auto& section : m_sections)
+                {
+                    for (const auto& property : section.properties)
+                    {
+                        writeUint32(output, property.name);
+                        writeUint32(output, static_cast<std::uint32_t>(property.type));
+                        for (const auto value : property.values)
+                            writeUint32(output, value);
+                    }
+                }
+
+                for (const auto& rect : m_rects)
+                {
+                    writeUint32(output, static_cast<std::uint32_t>(rect.left));
+                    writeUint32(output, static_cast<std::uint32_t>(rect.top));
+                    writeUint32(output, static_cast<std::uint32_t>(rect.width));
+                    writeUint32(output, static_cast<std::uint32_t>(rect.height));
+                }
+
+                std::uint32_t stringEnd = 0;
+                for (const auto& str : m_strings)
+                {
+                    stringEnd += static_cast<std::uint32_t>(str.size());
+                    writeUint32(output, stringEnd);
+                }
+
+                for (const auto& str : m_strings)
+                    output.write(str.data(), str.size());
+            }
+
+        private:
+
+            std::uint32_t addString(const std::string& str)
+            {
+                const auto it = m_stringIndices.find(str);
+                if (it != m_stringIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(m_strings.size());
+                m_strings.push_back(str);
+                m_stringIndices[str] = index;
+                return index;
+            }
+
+            std::uint32_t addRect(const sf::IntRect& rect)
+            {
+                m_rects.push_back(rect);
+                return static_cast<std::uint32_t>(m_rects.size() - 1);
+            }
+
+            std::vector<PropertyRecord> convertProperties(const std::map<sf::String, sf::String>& properties)
+            {
+                std::vector<PropertyRecord> records;
+                for (const auto& pair : properties)
+                    records.push_back(convertProperty(toLower(pair.first.toAnsiString()), pair.second));
+
+                return records;
+            }
+
+            // Nested sections are stored as unnamed sections. Identical sections, e.g. a scrollbar that was referenced
+            // from several sections, are only stored once.
+            std::uint32_t addNestedSection(const std::string& value)
+            {
+                const auto it = m_nestedSections.find(value);
+                if (it != m_nestedSections.end())
+                    return it->second;
+
+                std::stringstream ss{value};
+                auto node = DataIO::parse(ss);
+
+                // The root node should contain exactly one child which is the node we need
+                if (node->propertyValuePairs.empty() && (node->children.size() == 1))
+                    node = std::move(node->children[0]);
+
+                std::map<sf::String, sf::String> properties;
+                for (const auto& pair : node->propertyValuePairs)
+                    properties[pair.first] = pair.second->value;
+
+                for (const auto& child : node->children)
+                {
+                    std::stringstream childStream;
+                    DataIO::emit(child, childStream);
+                    properties[toLower(child->name)] = "{\n" + childStream.str() + "}";
+                }
+
+                SectionRecord section;
+                section.properties = convertProperties(properties);
+
+                const auto index = static_cast<std::uint32_t>(m_sections.size());
+                m_sections.push_back(std::move(section));
+                m_nestedSections[value] = index;
+                return index;
+            }
+
+            PropertyRecord convertProperty(const std::string& name, const sf::String& value)
+            {
+                const std::string str = value.toAnsiString();
+
+                PropertyRecord record;
+                record.name = addString(name);
+
+                ObjectConverter::Type type = priv::getPropertyType(priv::internPropertyName(name));
+                if (type == ObjectConverter::Type::None)
+                    type = (!str.empty() && (str[0] == '{')) ? ObjectConverter::Type::RendererData : ObjectConverter::Type::String;
+
+                // Values that can't be converted are kept as string, the error will show up when the renderer uses it
+                try
+                {
+                    switch (type)
+                    {
+                        case ObjectConverter::Type::Bool:
+                        {
+                            record.type = ValueType::Bool;
+                            record.values[0] = Deserializer::deserialize(type, str).getBool() ? 1 : 0;
+                            return record;
+                        }
+                        case ObjectConverter::Type::Color:
+                        {
+                            const Color color = Deserializer::deserialize(type, str).getColor();
+                            record.type = ValueType::Color;
+                            record.values[0] = (static_cast<std::uint32_t>(color.getRed()) << 24) | (static_cast<std::uint32_t>(color.getGreen()) << 16)
+                                             | (static_cast<std::uint32_t>(color.getBlue()) << 8) | static_cast<std::uint32_t>(color.getAlpha());
+                            record.values[1] = color.isSet() ? 1 : 0;
+                            return record;
+                        }
+                        case ObjectConverter::Type::Number:
+                        {
+                            record.type = ValueType::Number;
+                            record.values[0] = floatToUint32(Deserializer::deserialize(type, str).getNumber());
+                            return record;
+                        }
+                        case ObjectConverter::Type::Outline:
+                        {
+                            // Relative outlines are stored as string
+                            if (str.find('%') != std::string::npos)
+                                break;
+
+                            const Outline outline = Deserializer::deserialize(type, str).getOutline();
+                            record.type = ValueType::Outline;
+                            record.values[0] = floatToUint32(outline.getLeft());
+                            record.values[1] = floatToUint32(outline.getTop());
+                            record.values[2] = floatToUint32(outline.getRight());
+                            record.values[3] = floatToUint32(outline.getBottom());
+                            return record;
+                        }
+                        case ObjectConverter::Type::TextStyle:
+                        {
+                            record.type = ValueType::TextStyle;
+                            record.values[0] = static_cast<unsigned int>(Deserializer::deserialize(type, str).getTextStyle());
+                            return record;
+                        }
+                        case ObjectConverter::Type::Texture:
+                        {
+                            std::string filename;
+                            sf::IntRect partRect;
+                            sf::IntRect middleRect;
+                            bool smooth;
+                            Deserializer::parseTexture(str, filename, partRect, middleRect, smooth);
+
+                            std::uint32_t flags = smooth ? SmoothTexture : 0u;
+                            if (!filename.empty() && (str[0] != '"') && !isAbsolutePath(filename))
+                                flags |= RelativeToResources;
+                            if (removeThemeDirectory(filename, m_themeDirectory))
+                                flags |= RelativeToTheme;
+
+                            record.type = ValueType::Texture;
+                            record.values[0] = addString(filename);
+                            record.values[1] = addRect(partRect);
+                            record.values[2] = addRect(middleRect);
+                            record.values[3] = flags;
+                            return record;
+                        }
+                        case ObjectConverter::Type::RendererData:
+                        {
+                            record.type = ValueType::RendererData;
+                            record.values[0] = addNestedSection(str);
+                            return record;
+                        }
+                        case ObjectConverter::Type::Font:
+                        {
+                            // Fonts are stored as string, the directory of the theme is removed from the filename
+                            std::string filename = str;
+                            const bool quoted = !filename.empty() && (filename[0] == '"');
+                            if (quoted)
+                                filename.erase(0, 1);
+
+                            if (removeThemeDirectory(filename, m_themeDirectory))
+                            {
+                                record.type = ValueType::String;
+                                record.values[0] = addString(quoted ? ('"' + filename) : filename);
+                                record.values[1] = RelativeToTheme;
+                                return record;
+                            }
+                            break;
+                        }
+                        case ObjectConverter::Type::None:
+                        case ObjectConverter::Type::String:
+                            break;
+                    }
+                }
+                catch (const Exception&)
+                {
+                }
+
+                const auto utf8 = value.toUtf8();
+                record.type = ValueType::String;
+                record.values[0] = addString(std::string(utf8.begin(), utf8.end()));
+                record.values[1] = 0;
+                return record;
+            }
+
+        private:
+
+            std::vector<SectionRecord> m_sections;
+            std::size_t m_namedSectionCount; // Nested sections are added behind the named ones
+            std::vector<sf::IntRect> m_rects;
+            std::vector<std::string> m_strings;
+            std::map<std::string, std::uint32_t> m_stringIndices;
+            std::map<std::string, std::uint32_t> m_nestedSections;
+            std::string m_themeDirectory;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct BinaryThemeLoader::ThemeFile
+    {
+        std::vector<char> data;
+        std::string directory;
+
+        std::uint32_t sectionCount = 0;
+        std::uint32_t namedSectionCount = 0;
+        std::uint32_t propertyCount = 0;
+        std::uint32_t rectCount = 0;
+        std::uint32_t stringCount = 0;
+
+        const char* sections = nullptr;
+        const char* properties = nullptr;
+        const char* rects = nullptr;
+        const char* stringOffsets = nullptr;
+        const char* strings = nullptr;
+        std::size_t stringsSize = 0;
+
+        std::map<std::string, std::map<sf::String, sf::String>> serializedSections; // Cache for the load function
+
+        std::string getString(std::uint32_t index) const
+        {
+            if (index >= stringCount)
+                throw Exception{"Invalid string index found in binary theme."};
+
+            const std::uint32_t begin = (index > 0) ? readUint32(stringOffsets + 4 * (index - 1)) : 0;
+            const std::uint32_t end = readUint32(stringOffsets + 4 * index);
+            if ((begin > end) || (end > stringsSize))
+                throw Exception{"Invalid string found in binary theme."};
+
+            return std::string(strings + begin, strings + end);
+        }
+
+        sf::IntRect getRect(std::uint32_t index) const
+        {
+            if (index >= rectCount)
+                throw Exception{"Invalid rectangle index found in binary theme."};
+
+            const char* rect = rects + rectSize * index;
+            return {static_cast<int>(readUint32(rect)), static_cast<int>(readUint32(rect + 4)),
+                    static_cast<int>(readUint32(rect + 8)), static_cast<int>(readUint32(rect + 12))};
+        }
+
+        // Binary search in the named sections, which are sorted on their name
+        bool findSection(const std::string& name, std::uint32_t& index) const
+        {
+            std::uint32_t first = 0;
+            std::uint32_t last = namedSectionCount;
+            while (first < last)
+            {
+                const std::uint32_t middle = first + (last - first) / 2;
+                const int comparison = getString(readUint32(sections + sectionSize * middle)).compare(name);
+                if (comparison == 0)
+                {
+                    index = middle;
+                    return true;
+                }
+                else if (comparison < 0)
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+
+            return false;
+        }
+
+        std::map<std::string, ObjectConverter> loadSection(std::uint32_t index, unsigned int depth) const
+        {
+            if ((index >= sectionCount) || (depth > sectionCount))
+                throw Exception{"Invalid section found in binary theme."};
+
+            const char* section = sections + sectionSize * index;
+            const std::uint32_t firstProperty = readUint32(section + 4);
+            const std::uint32_t count = readUint32(section + 8);
+            if ((firstProperty > propertyCount) || (count > propertyCount - firstProperty))
+                throw Exception{"Invalid section found in binary theme."};
+
+            std::map<std::string, ObjectConverter> result;
+            for (std::uint32_t i = firstProperty; i < firstProperty + count; ++i)
+            {
+                const char* property = properties + propertySize * i;
+                const std::uint32_t values[4] = {readUint32(property + 8), readUint32(property + 12), readUint32(property + 16), readUint32(property + 20)};
+
+                ObjectConverter& value = result[getString(readUint32(property))];
+                switch (static_cast<ValueType>(readUint32(property + 4)))
+                {
+                    case ValueType::String:
+                    {
+                        std::string str = getString(values[0]);
+                        if (values[1] & RelativeToTheme)
+                        {
+                            if (!str.empty() && (str[0] == '"'))
+                                str.insert(1, directory);
+                            else
+                                str.insert(0, directory);
+                        }
+
+                        value = sf::String::fromUtf8(str.begin(), str.end());
+                        break;
+                    }
+                    case ValueType::Number:
+                    {
+                        value = uint32ToFloat(values[0]);
+                        break;
+                    }
+                    case ValueType::Bool:
+                    {
+                        value = (values[0] != 0);
+                        break;
+                    }
+                    case ValueType::Color:
+                    {
+                        if (values[1])
+                        {
+                            value = Color{static_cast<std::uint8_t>(values[0] >> 24), static_cast<std::uint8_t>((values[0] >> 16) & 0xFF),
+                                          static_cast<std::uint8_t>((values[0] >> 8) & 0xFF), static_cast<std::uint8_t>(values[0] & 0xFF)};
+                        }
+                        else
+                            value = Color{};
+                        break;
+                    }
+                    case ValueType::Outline:
+                    {
+                        value = Outline{uint32ToFloat(values[0]), uint32ToFloat(values[1]), uint32ToFloat(values[2]), uint32ToFloat(values[3])};
+                        break;
+                    }
+                    case ValueType::TextStyle:
+                    {
+                        value = TextStyle{values[0]};
+                        break;
+                    }
+                    case ValueType::Texture:
+                    {
+                        std::string filename = getString(values[0]);
+                        if (filename.empty())
+                        {
+                            value = Texture{};
+                            break;
+                        }
+
+                        if (values[3] & RelativeToTheme)
+                            filename = directory + filename;
+                        if (values[3] & RelativeToResources)
+                            filename = getResourcePath() + filename;
+
+                        value = Texture{filename, getRect(values[1]), getRect(values[2]), (values[3] & SmoothTexture) != 0};
+                        break;
+                    }
+                    case ValueType::RendererData:
+                    {
+                        auto rendererData = RendererData::create(loadSection(values[0], depth + 1));
+                        value = rendererData;
+                        break;
+                    }
+                    default:
+                        throw Exception{"Invalid property type found in binary theme."};
+                }
+            }
+
+            return result;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, std::shared_ptr<BinaryThemeLoader::ThemeFile>> BinaryThemeLoader::m_themeFiles;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::preload(const std::string& filename)
+    {
+        if (filename.empty())
+        {
+            DefaultThemeLoader::preload(filename);
+            return;
+        }
+
+        if (m_themeFiles.find(filename) != m_themeFiles.end())
+            return;
+
+        const std::string fullFilename = isAbsolutePath(filename) ? filename : getResourcePath() + filename;
+        std::ifstream file{fullFilename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open theme file '" + fullFilename + "'."};
+
+        char magic[sizeof(binaryThemeMagic)] = {};
+        file.read(magic, sizeof(magic));
+        if (!file || (std::memcmp(magic, binaryThemeMagic, sizeof(magic)) != 0))
+        {
+            // This is not a binary theme, let the default loader parse the text file
+            file.close();
+            DefaultThemeLoader::preload(filename);
+            m_themeFiles[filename] = nullptr;
+            return;
+        }
+
+        auto themeFile = std::make_shared<ThemeFile>();
+        file.seekg(0, std::ios::end);
+        themeFile->data.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(themeFile->data.data(), themeFile->data.size());
+        if (!file)
+            throw Exception{"Failed to read theme file '" + fullFilename + "'."};
+
+        const auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            themeFile->directory = filename.substr(0, slashPos+1);
+
+        const char* data = themeFile->data.data();
+        const std::size_t size = themeFile->data.size();
+        if ((size < headerSize) || (readUint32(data + 8) != binaryThemeVersion))
+            throw Exception{"Unsupported binary theme file '" + filename + "'."};
+
+        themeFile->sectionCount = readUint32(data + 12);
+        themeFile->namedSectionCount = readUint32(data + 16);
+        themeFile->propertyCount = readUint32(data + 20);
+        themeFile->rectCount = readUint32(data + 24);
+        themeFile->stringCount = readUint32(data + 28);
+
+        // Verify that all tables fit inside the file before accessing them
+        const std::uint64_t stringsOffset = headerSize
+                                          + std::uint64_t{sectionSize} * themeFile->sectionCount
+                                          + std::uint64_t{propertySize} * themeFile->propertyCount
+                                          + std::uint64_t{rectSize} * themeFile->rectCount
+                                          + std::uint64_t{4} * themeFile->stringCount;
+        if ((stringsOffset > size) || (themeFile->namedSectionCount > themeFile->sectionCount))
+            throw Exception{"Corrupt binary theme file '" + filename + "'."};
+
+        themeFile->sections = data + headerSize;
+        themeFile->properties = themeFile->sections + sectionSize * themeFile->sectionCount;
+        themeFile->rects = themeFile->properties + propertySize * themeFile->propertyCount;
+        themeFile->stringOffsets = themeFile->rects + rectSize * themeFile->rectCount;
+        themeFile->strings = data + stringsOffset;
+        themeFile->stringsSize = size - static_cast<std::size_t>(stringsOffset);
+
+        m_themeFiles[filename] = themeFile;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& BinaryThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        const auto themeFile = getThemeFile(filename);
+        if (!themeFile)
+            return DefaultThemeLoader::load(filename, section);
+
+        const std::string lowercaseSection = toLower(section);
+        auto it = themeFile->serializedSections.find(lowercaseSection);
+        if (it != themeFile->serializedSections.end())
+            return it->second;
+
+        auto& serializedProperties = themeFile->serializedSections[lowercaseSection];
+        for (auto& pair : loadProperties(filename, section))
+            serializedProperties[pair.first] = pair.second.getString();
+
+        return serializedProperties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BinaryThemeLoader::canLoad(const std::string& filename, const std::string& section)
+    {
+        const auto themeFile = getThemeFile(filename);
+        if (!themeFile)
+            return DefaultThemeLoader::canLoad(filename, section);
+
+        std::uint32_t index;
+        return themeFile->findSection(toLower(section), index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> BinaryThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        const auto themeFile = getThemeFile(filename);
+        if (!themeFile)
+            return DefaultThemeLoader::loadProperties(filename, section);
+
+        std::uint32_t index;
+        if (!themeFile->findSection(toLower(section), index))
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        return themeFile->loadSection(index, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::compile(const std::string& themeFilename, std::ostream& output)
+    {
+        std::string themeDirectory;
+        const auto slashPos = themeFilename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            themeDirectory = themeFilename.substr(0, slashPos+1);
+
+        DefaultThemeLoader textLoader;
+        const auto sectionNames = textLoader.getSectionNames(themeFilename);
+
+        ThemeWriter writer{sectionNames.size(), themeDirectory};
+        for (std::size_t i = 0; i < sectionNames.size(); ++i)
+            writer.setSection(i, sectionNames[i], textLoader.load(themeFilename, sectionNames[i]));
+
+        writer.write(output);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::compile(const std::string& themeFilename, const std::string& outputFilename)
+    {
+        std::ofstream file{outputFilename, std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + outputFilename + "' for writing the binary theme."};
+
+        compile(themeFilename, file);
+
+        file.close();
+        if (!file)
+            throw Exception{"Failed to write binary theme to '" + outputFilename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BinaryThemeLoader::flushCache(const std::string& filename)
+    {
+        if (filename != "")
+            m_themeFiles.erase(filename);
+        else
+            m_themeFiles.clear();
+
+        DefaultThemeLoader::flushCache(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BinaryThemeLoader::ThemeFile> BinaryThemeLoader::getThemeFile(const std::string& filename)
+    {
+        if (filename.empty())
+            return nullptr;
+
+        preload(filename);
+        return m_themeFiles[filename];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
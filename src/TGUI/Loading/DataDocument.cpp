@@ -0,0 +1,700 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/DataDocument.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/to_string.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const std::size_t arenaBlockSize = 64 * 1024;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isSpace(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        DataDocument::StringView trimView(DataDocument::StringView str)
+        {
+            while ((str.size > 0) && isSpace(str.data[0]))
+            {
+                ++str.data;
+                --str.size;
+            }
+
+            while ((str.size > 0) && isSpace(str.data[str.size - 1]))
+                --str.size;
+
+            return str;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void copyNode(const DataDocument::Node& source, DataIO::Node& target)
+        {
+            for (const auto* property = source.firstProperty; property; property = property->next)
+            {
+                auto valueNode = std::make_unique<DataIO::ValueNode>(property->getValue());
+                valueNode->listNode = property->isList();
+                for (const auto& item : property->getListItems())
+                    valueNode->valueList.emplace_back(item.toString());
+
+                target.propertyValuePairs[property->key.toString()] = std::move(valueNode);
+            }
+
+            for (const auto* child = source.firstChild; child; child = child->nextSibling)
+            {
+                auto node = std::make_unique<DataIO::Node>();
+                node->parent = &target;
+                node->name = child->name.toString();
+                copyNode(*child, *node);
+                target.children.push_back(std::move(node));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Recursive descent parser that accepts the same input as DataIO::parse and produces the same errors
+    class DataDocument::Parser
+    {
+    public:
+
+        Parser(DataDocument& document, const char* data, std::size_t size) :
+            m_document{document},
+            m_begin   {data},
+            m_pos     {data},
+            m_end     {data + size}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void parse()
+        {
+            while (m_pos != m_end)
+                parseRootSection();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Word or value that is being read. As long as all characters are adjacent in the input, only the range is tracked.
+        // The characters are only copied once something in the middle (e.g. a comment) has to be left out.
+        struct Slice
+        {
+            void append(const char* pos)
+            {
+                if (copied)
+                    copy.push_back(*pos);
+                else if (size == 0)
+                {
+                    start = pos;
+                    size = 1;
+                }
+                else if (start + size == pos)
+                    ++size;
+                else
+                {
+                    startCopy();
+                    copy.push_back(*pos);
+                }
+            }
+
+            void appendSpace()
+            {
+                if (!copied)
+                    startCopy();
+
+                copy.push_back(' ');
+            }
+
+            void startCopy()
+            {
+                if (size > 0)
+                    copy.assign(start, size);
+
+                copied = true;
+            }
+
+            const char* start = nullptr;
+            std::size_t size = 0;
+            std::string copy;
+            bool copied = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        int peek() const
+        {
+            if (m_pos != m_end)
+                return static_cast<unsigned char>(*m_pos);
+            else
+                return EOF;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        [[noreturn]] void fail(const std::string& error) const
+        {
+            const auto lineNumber = std::count(m_begin, m_pos, '\n') + 1;
+            throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string describeCurrentChar() const
+        {
+            return "'" + std::string(1, *m_pos) + "'";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        StringView finish(const Slice& slice)
+        {
+            if (slice.copied)
+                return m_document.storeString(slice.copy);
+            else
+                return {slice.start, slice.size};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void skipLineComment()
+        {
+            while (m_pos != m_end)
+            {
+                if (*m_pos++ == '\n')
+                    break;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void skipBlockComment()
+        {
+            while (m_pos != m_end)
+            {
+                ++m_pos;
+                if (peek() == '*')
+                {
+                    ++m_pos;
+                    if (peek() == '/')
+                    {
+                        ++m_pos;
+                        return;
+                    }
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns false when the end of the input was reached
+        bool skipWhitespaceAndComments(bool errorOnEOF)
+        {
+            for (;;)
+            {
+                while ((m_pos != m_end) && isSpace(*m_pos))
+                    ++m_pos;
+
+                if (m_pos == m_end)
+                    break;
+
+                if (*m_pos == '/')
+                {
+                    ++m_pos;
+                    if (peek() == '/')
+                        skipLineComment();
+                    else if (peek() == '*')
+                        skipBlockComment();
+                    else
+                        fail("Unexpected '/' found.");
+
+                    continue;
+                }
+                break;
+            }
+
+            if (m_pos == m_end)
+            {
+                if (errorOnEOF)
+                    fail("Unexpected EOF while parsing.");
+
+                return false;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void readQuotedString(Slice& slice)
+        {
+            bool backslash = false;
+            while (m_pos != m_end)
+            {
+                const char* pos = m_pos++;
+                slice.append(pos);
+
+                if ((*pos == '"') && !backslash)
+                    break;
+
+                backslash = (*pos == '\\') && !backslash;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        StringView readWord()
+        {
+            Slice word;
+            while (m_pos != m_end)
+            {
+                const char c = *m_pos;
+                if (c == '\r')
+                {
+                    ++m_pos;
+                    return finish(word);
+                }
+                else if (!isSpace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                {
+                    const char* pos = m_pos++;
+                    if ((c == '/') && (peek() == '/'))
+                    {
+                        while (m_pos != m_end)
+                        {
+                            if (*m_pos++ == '\n')
+                                return finish(word);
+                        }
+                    }
+                    else if ((c == '/') && (peek() == '*'))
+                    {
+                        while (m_pos != m_end)
+                        {
+                            if ((*m_pos++ == '*') && (peek() == '/'))
+                            {
+                                ++m_pos;
+                                break;
+                            }
+                        }
+                    }
+                    else if (c == '"')
+                    {
+                        word.append(pos);
+                        readQuotedString(word);
+                    }
+                    else
+                        word.append(pos);
+                }
+                else
+                    return finish(word);
+            }
+
+            return {};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        StringView readLine()
+        {
+            Slice line;
+            bool whitespaceFound = false;
+            while (m_pos != m_end)
+            {
+                char c = *m_pos;
+                if (c == '/')
+                {
+                    ++m_pos;
+                    if (peek() == '/')
+                        skipLineComment();
+                    else if (peek() == '*')
+                        skipBlockComment();
+                    else
+                        return {};
+
+                    continue;
+                }
+
+                if (c == '"')
+                {
+                    line.append(m_pos++);
+                    readQuotedString(line);
+
+                    if (m_pos == m_end)
+                        return {};
+
+                    c = *m_pos;
+                }
+
+                if ((c == '=') || (c == '{'))
+                    return {};
+                else if ((c == ';') || (c == '}'))
+                    return finish(line);
+                else if (isSpace(c))
+                {
+                    // Multiple whitespace characters are replaced by a single space
+                    if (!whitespaceFound)
+                    {
+                        whitespaceFound = true;
+                        if (c == ' ')
+                            line.append(m_pos);
+                        else
+                            line.appendSpace();
+                    }
+
+                    ++m_pos;
+                }
+                else
+                {
+                    whitespaceFound = false;
+                    line.append(m_pos++);
+                }
+            }
+
+            return {};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void setProperty(Node& node, StringView key, StringView value)
+        {
+            if (std::any_of(key.data, key.data + key.size, [](char c){ return std::isupper(static_cast<unsigned char>(c)) != 0; }))
+                key = m_document.storeString(toLower(key.toString()));
+
+            // When a property occurs multiple times in a section then the last value is used
+            ValueNode* last = nullptr;
+            for (auto* property = node.firstProperty; property; property = property->next)
+            {
+                if ((property->key.size == key.size) && (std::memcmp(property->key.data, key.data, key.size) == 0))
+                {
+                    property->value = value;
+                    return;
+                }
+
+                last = property;
+            }
+
+            auto* property = m_document.create<ValueNode>();
+            property->key = key;
+            property->value = value;
+
+            if (last)
+                last->next = property;
+            else
+                node.firstProperty = property;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void parseKeyValue(Node& node, StringView key)
+        {
+            // Skip the assignment symbol and the whitespace behind it
+            ++m_pos;
+            skipWhitespaceAndComments(true);
+
+            // Check for subsection as value
+            if (*m_pos == '{')
+            {
+                parseSection(node, key);
+                return;
+            }
+
+            const StringView value = trimView(readLine());
+            if (!value.empty())
+            {
+                if (peek() == ';')
+                    ++m_pos;
+
+                setProperty(node, key, value);
+            }
+            else
+            {
+                if (m_pos == m_end)
+                    fail("Found EOF while trying to read a value.");
+                else if (*m_pos == '=')
+                    fail("Found '=' while trying to read a value.");
+                else if (*m_pos == '{')
+                    fail("Found '{' while trying to read a value.");
+                else
+                    fail("Found empty value.");
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void parseSection(Node& parent, StringView name)
+        {
+            auto* node = m_document.create<Node>();
+            node->parent = &parent;
+            node->name = name;
+
+            // Skip the brace
+            ++m_pos;
+
+            while (m_pos != m_end)
+            {
+                skipWhitespaceAndComments(true);
+
+                const StringView word = readWord();
+                if (word.empty())
+                {
+                    if (m_pos == m_end)
+                        fail("Found EOF while trying to read property or nested section name.");
+                    else if (*m_pos == '}')
+                    {
+                        if (parent.lastChild)
+                            parent.lastChild->nextSibling = node;
+                        else
+                            parent.firstChild = node;
+
+                        parent.lastChild = node;
+                        ++m_pos;
+
+                        // Ignore semicolon behind closing brace
+                        if (!skipWhitespaceAndComments(false))
+                            return;
+
+                        if (*m_pos == ';')
+                            ++m_pos;
+
+                        skipWhitespaceAndComments(false);
+                        return;
+                    }
+                    else if (*m_pos != '{')
+                        fail("Expected property or nested section name, found " + describeCurrentChar() + " instead.");
+                }
+
+                skipWhitespaceAndComments(true);
+                if (*m_pos == '{')
+                    parseSection(*node, word);
+                else if (*m_pos == '=')
+                    parseKeyValue(*node, word);
+                else
+                    fail("Expected '{' or '=', found " + describeCurrentChar() + " instead.");
+            }
+
+            fail("Found EOF while reading section.");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void parseRootSection()
+        {
+            if (!skipWhitespaceAndComments(false))
+                return;
+
+            const StringView word = readWord();
+            if (word.empty())
+            {
+                skipWhitespaceAndComments(true);
+                if (*m_pos != '{')
+                    fail("Expected section name, found " + describeCurrentChar() + " instead.");
+            }
+
+            skipWhitespaceAndComments(true);
+            if (*m_pos == '{')
+                parseSection(*m_document.m_root, word);
+            else if (*m_pos == '=')
+                parseKeyValue(*m_document.m_root, word);
+            else
+                fail("Expected '{' or '=', found " + describeCurrentChar() + " instead.");
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    private:
+
+        DataDocument& m_document;
+        const char* const m_begin;
+        const char* m_pos;
+        const char* const m_end;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String DataDocument::ValueNode::getValue() const
+    {
+        return sf::String{value.toString()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DataDocument::ValueNode::isList() const
+    {
+        return (value.size >= 2) && (value.data[0] == '[') && (value.data[value.size - 1] == ']');
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<DataDocument::StringView> DataDocument::ValueNode::getListItems() const
+    {
+        std::vector<StringView> items;
+        if (!isList() || (value.size < 3))
+            return items;
+
+        // Split the value on the commas that aren't part of a string
+        const char* const end = value.data + value.size - 1;
+        const char* itemStart = value.data + 1;
+        const char* pos = itemStart;
+        while (pos < end)
+        {
+            if (*pos == ',')
+            {
+                items.push_back(trimView({itemStart, static_cast<std::size_t>(pos - itemStart)}));
+                itemStart = ++pos;
+            }
+            else if (*pos == '"')
+            {
+                ++pos;
+
+                bool backslash = false;
+                while (pos < end)
+                {
+                    if ((*pos == '"') && !backslash)
+                    {
+                        ++pos;
+                        break;
+                    }
+
+                    backslash = (*pos == '\\') && !backslash;
+                    ++pos;
+                }
+            }
+            else
+                ++pos;
+        }
+
+        items.push_back(trimView({itemStart, static_cast<std::size_t>(end - itemStart)}));
+        return items;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DataDocument::ValueNode* DataDocument::Node::findProperty(const std::string& key) const
+    {
+        for (const auto* property = firstProperty; property; property = property->next)
+        {
+            if (property->key == key)
+                return property;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataDocument> DataDocument::parse(const char* data, std::size_t size)
+    {
+        std::unique_ptr<DataDocument> document{new DataDocument};
+        document->m_root = document->create<Node>();
+
+        Parser parser{*document, data, size};
+        parser.parse();
+        return document;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataDocument> DataDocument::parse(std::string data)
+    {
+        std::unique_ptr<DataDocument> document{new DataDocument};
+        document->m_root = document->create<Node>();
+        document->m_buffer = std::move(data);
+
+        Parser parser{*document, document->m_buffer.data(), document->m_buffer.size()};
+        parser.parse();
+        return document;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataDocument::toNodeTree() const
+    {
+        auto root = std::make_unique<DataIO::Node>();
+        copyNode(*m_root, *root);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DataDocument::getArenaCapacity() const
+    {
+        std::size_t capacity = 0;
+        for (const auto& block : m_blocks)
+            capacity += block.second;
+
+        return capacity;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* DataDocument::allocate(std::size_t size)
+    {
+        // Keep every allocation aligned so that nodes can be placed directly behind strings
+        const std::size_t alignment = alignof(std::max_align_t);
+        size = (size + alignment - 1) & ~(alignment - 1);
+
+        if (m_blocks.empty() || (m_blockUsed + size > m_blocks.back().second))
+        {
+            const std::size_t blockSize = std::max(size, arenaBlockSize);
+            m_blocks.emplace_back(std::unique_ptr<char[]>(new char[blockSize]), blockSize);
+            m_blockUsed = 0;
+        }
+
+        void* memory = m_blocks.back().first.get() + m_blockUsed;
+        m_blockUsed += size;
+        return memory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataDocument::StringView DataDocument::storeString(const std::string& str)
+    {
+        if (str.empty())
+            return {};
+
+        char* memory = static_cast<char*>(allocate(str.size()));
+        std::memcpy(memory, str.data(), str.size());
+        return {memory, str.size()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
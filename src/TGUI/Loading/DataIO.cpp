@@ -92,11 +92,11 @@ namespace tgui
     namespace
     {
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(std::istream& stream, DataIO::Visitor& visitor, const std::string& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(std::istream& stream)
         {
             std::string word = "";
             while (stream.peek() != EOF)
@@ -168,7 +168,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        std::string readLine(std::istream& stream)
         {
             std::string line;
             bool whitespaceFound = false;
@@ -267,7 +267,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        std::string parseKeyValue(std::istream& stream, DataIO::Visitor& visitor, const std::string& key)
         {
             // Read the assignment symbol from the stream and remove the whitespace behind it
             char chr;
@@ -277,7 +277,7 @@ namespace tgui
 
             // Check for subsection as value
             if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+                return parseSection(stream, visitor, key);
 
             // Read the value
             std::string line = trim(readLine(stream));
@@ -292,58 +292,9 @@ namespace tgui
                 valueNode->value = line;
 
                 // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
-                {
-                    valueNode->listNode = true;
-                    if (line.size() >= 3)
-                    {
-                        valueNode->valueList.push_back("");
-
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
-                        {
-                            if (line[i] == ',')
-                            {
-                                i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
-                            }
-                            else if (line[i] == '"')
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-
-                                bool backslash = false;
-                                while (i < line.size()-1)
-                                {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
+                DataIO::parseList(*valueNode);
 
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
-
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
-                                }
-                            }
-                            else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-                            }
-                        }
-
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
-                    }
-                }
-
-                node->propertyValuePairs[toLower(key)] = std::move(valueNode);
+                visitor.property(toLower(key), std::move(valueNode));
                 return "";
             }
             else
@@ -365,12 +316,9 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(std::istream& stream, DataIO::Visitor& visitor, const std::string& sectionName)
         {
-            // Create a new node for this section
-            auto sectionNode = std::make_unique<DataIO::Node>();
-            sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            visitor.beginNode(sectionName);
 
             // Read the brace from the stream
             char chr;
@@ -387,7 +335,7 @@ namespace tgui
                         return "Found EOF while trying to read property or nested section name.";
                     else if (stream.peek() == '}')
                     {
-                        node->children.push_back(std::move(sectionNode));
+                        visitor.endNode();
 
                         stream.read(&chr, 1);
 
@@ -406,13 +354,13 @@ namespace tgui
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
                 if (stream.peek() == '{')
                 {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    std::string error = parseSection(stream, visitor, word);
                     if (!error.empty())
                         return error;
                 }
                 else if (stream.peek() == '=')
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    std::string error = parseKeyValue(stream, visitor, word);
                     if (!error.empty())
                         return error;
                 }
@@ -425,7 +373,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(std::istream& stream, DataIO::Visitor& visitor)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
@@ -439,47 +387,54 @@ namespace tgui
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
             if (stream.peek() == '{')
-                return parseSection(stream, root, word);
+                return parseSection(stream, visitor, word);
             else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+                return parseKeyValue(stream, visitor, word);
             else
                 return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        // Visitor that builds the tree of nodes that is returned by DataIO::parse
+        class TreeBuilder : public DataIO::Visitor
         {
-            std::vector<std::string> output;
-            if (node->name.empty())
-                output.emplace_back("{");
-            else
-                output.emplace_back(node->name + " {");
+        public:
+            TreeBuilder() :
+                m_root{std::make_unique<DataIO::Node>()},
+                m_openNodes{m_root.get()}
+            {
+            }
 
-            if (!node->propertyValuePairs.empty())
+            void beginNode(const std::string& name) override
             {
-                for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                auto node = std::make_unique<DataIO::Node>();
+                node->parent = m_openNodes.back();
+                node->name = name;
+
+                m_openNodes.push_back(node.get());
+                node->parent->children.push_back(std::move(node));
             }
 
-            if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
+            void property(const std::string& key, std::unique_ptr<DataIO::ValueNode> value) override
+            {
+                m_openNodes.back()->propertyValuePairs[key] = std::move(value);
+            }
 
-            if (!node->children.empty())
+            void endNode() override
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
-                {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
-                        output.emplace_back("    " + line);
+                m_openNodes.pop_back();
+            }
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
-                }
+            std::unique_ptr<DataIO::Node> takeRoot()
+            {
+                return std::move(m_root);
             }
 
-            output.emplace_back("}");
-            return output;
-        }
+        private:
+            std::unique_ptr<DataIO::Node> m_root;
+            std::vector<DataIO::Node*> m_openNodes;
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
@@ -488,51 +443,198 @@ namespace tgui
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
-        auto root = std::make_unique<Node>();
+        TreeBuilder builder;
+        parse(stream, builder);
+        return builder.takeRoot();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void DataIO::parse(std::istream& stream, Visitor& visitor)
+    {
         std::string error;
         while (stream.peek() != EOF)
         {
-            error = parseRootSection(stream, root);
+            error = parseRootSection(stream, visitor);
             if (!error.empty())
             {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
+                const auto position = stream.tellg();
+                if (position != std::istream::pos_type(-1))
                 {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
+                    // Read the stream again from the start to find the line on which the error occurred
+                    stream.seekg(0);
+                    std::size_t lineNumber = 1;
+                    for (std::streamoff i = 0; (i < static_cast<std::streamoff>(position)) && (stream.peek() != EOF); ++i)
+                    {
+                        if (stream.get() == '\n')
+                            ++lineNumber;
+                    }
+
                     throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
                 }
                 else
                     throw Exception{"Error while parsing input. " + error};
             }
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return root;
+    void DataIO::parseList(ValueNode& valueNode)
+    {
+        const std::size_t size = valueNode.value.getSize();
+        if ((size >= 2) && (valueNode.value[0] == '[') && (valueNode.value[size-1] == ']'))
+        {
+            const std::string line = valueNode.value;
+            valueNode.listNode = true;
+            if (line.size() >= 3)
+            {
+                valueNode.valueList.push_back("");
+
+                std::size_t i = 1;
+                while (i < line.size()-1)
+                {
+                    if (line[i] == ',')
+                    {
+                        i++;
+                        valueNode.valueList.back() = trim(valueNode.valueList.back());
+                        valueNode.valueList.push_back("");
+                    }
+                    else if (line[i] == '"')
+                    {
+                        valueNode.valueList.back().insert(valueNode.valueList.back().getSize(), line[i]);
+                        i++;
+
+                        bool backslash = false;
+                        while (i < line.size()-1)
+                        {
+                            valueNode.valueList.back().insert(valueNode.valueList.back().getSize(), line[i]);
+
+                            if (line[i] == '"' && !backslash)
+                            {
+                                i++;
+                                break;
+                            }
+
+                            if (line[i] == '\\' && !backslash)
+                                backslash = true;
+                            else
+                                backslash = false;
+
+                            i++;
+                        }
+                    }
+                    else
+                    {
+                        valueNode.valueList.back().insert(valueNode.valueList.back().getSize(), line[i]);
+                        i++;
+                    }
+                }
+
+                valueNode.valueList.back() = trim(valueNode.valueList.back());
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
     {
+        Writer writer{stream};
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";" << std::endl;
+            writer.property(pair.first, pair.second->value);
 
-        if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+        for (const auto& child : rootNode->children)
+            writer.writeNode(*child);
+    }
 
-        std::vector<std::string> output;
-        for (std::size_t i = 0; i < rootNode->children.size(); ++i)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataIO::Writer::Writer(std::ostream& stream) :
+        m_stream  {stream},
+        m_sections(1)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::beginNode(const std::string& name)
+    {
+        separateChild();
+
+        writeIndentation(m_sections.size() - 1);
+        if (name.empty())
+            m_stream << "{\n";
+        else
+            m_stream << name << " {\n";
+
+        m_sections.emplace_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::property(const std::string& key, std::unique_ptr<ValueNode> value)
+    {
+        property(key, value->value);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::property(const std::string& key, const sf::String& value)
+    {
+        writeIndentation(m_sections.size() - 1);
+        m_stream << key << " = " << value.toAnsiString() << ";\n";
+        m_sections.back().hasProperties = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::endNode()
+    {
+        assert(m_sections.size() > 1);
+        m_sections.pop_back();
+
+        writeIndentation(m_sections.size() - 1);
+        m_stream << "}\n";
+        m_sections.back().hasChildren = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::writeNode(const Node& node)
+    {
+        beginNode(node.name);
+
+        for (const auto& pair : node.propertyValuePairs)
+            property(pair.first, pair.second->value);
+
+        for (const auto& child : node.children)
+            writeNode(*child);
+
+        endNode();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::writeIndentation(std::size_t level)
+    {
+        for (std::size_t i = 0; i < level; ++i)
+            m_stream << "    ";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::Writer::separateChild()
+    {
+        // Child sections are separated by an empty line from the properties and sections in front of them.
+        // The empty line is indented like the section that contains them, except for the top-level sections.
+        if (m_sections.back().hasProperties || m_sections.back().hasChildren)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            if (m_sections.size() > 2)
+                writeIndentation(m_sections.size() - 2);
 
-            if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+            m_stream << "\n";
         }
-
-        for (const auto& line : output)
-            stream << line << std::endl;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/ResourcePreloader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <cstdint>
@@ -95,17 +96,21 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
+            // Insert the resource path into the filename unless the filename is an absolute path
         #ifdef SFML_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
         #else
             if (filename[0] != '/')
         #endif
-                font->loadFromFile(getResourcePath() + filename);
-            else
-                font->loadFromFile(filename);
+                filename = getResourcePath() + filename;
+
+            // Use the font if it was already loaded while loading a widget file
+            std::shared_ptr<sf::Font> font;
+            if (ResourcePreloader::findFont(filename, font))
+                return Font(font);
 
+            font = std::make_shared<sf::Font>();
+            font->loadFromFile(filename);
             return Font(font);
         }
 
@@ -272,85 +277,11 @@ namespace tgui
                     return Texture{value};
             }
 
-            std::string::const_iterator c = value.begin();
-            ++c; // Skip the opening quote
-
             std::string filename;
-            char prev = '\0';
-
-            // Look for the end quote
-            bool filenameFound = false;
-            while (c != value.end())
-            {
-                if ((*c != '"') || (prev == '\\'))
-                {
-                    prev = *c;
-                    filename.push_back(*c);
-                    ++c;
-                }
-                else
-                {
-                    ++c;
-                    filenameFound = true;
-                    break;
-                }
-            }
-
-            if (!filenameFound)
-                throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find the closing quote of the filename."};
-
-            // There may be optional parameters
             sf::IntRect partRect;
             sf::IntRect middleRect;
             bool smooth = false;
-
-            while (removeWhitespace(value, c))
-            {
-                std::string word;
-                auto openingBracketPos = value.find('(', c - value.begin());
-                if (openingBracketPos != std::string::npos)
-                    word = value.substr(c - value.begin(), openingBracketPos - (c - value.begin()));
-                else
-                {
-                    if (toLower(trim(value.substr(c - value.begin()))) == "smooth")
-                    {
-                        smooth = true;
-                        break;
-                    }
-                    else
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Invalid text found behind filename."};
-                }
-
-                sf::IntRect* rect = nullptr;
-                if ((word == "Part") || (word == "part"))
-                {
-                    rect = &partRect;
-                    std::advance(c, 4);
-                }
-                else if ((word == "Middle") || (word == "middle"))
-                {
-                    rect = &middleRect;
-                    std::advance(c, 6);
-                }
-                else
-                {
-                    if (word.empty())
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Expected 'Part' or 'Middle' in front of opening bracket."};
-                    else
-                        throw Exception{"Failed to deserialize texture '" + value + "'. Unexpected word '" + word + "' in front of opening bracket. Expected 'Part' or 'Middle'."};
-                }
-
-                auto closeBracketPos = value.find(')', c - value.begin());
-                if (closeBracketPos != std::string::npos)
-                {
-                    if (!readIntRect(value.substr(c - value.begin(), closeBracketPos - (c - value.begin()) + 1), *rect))
-                        throw Exception{"Failed to parse " + word + " rectangle while deserializing texture '" + value + "'."};
-                }
-                else
-                    throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find closing bracket for " + word + " rectangle."};
-
-                std::advance(c, closeBracketPos - (c - value.begin()) + 1);
-            }
+            Deserializer::parseTexture(value, filename, partRect, middleRect, smooth);
 
             return Texture{filename, partRect, middleRect, smooth};
         }
@@ -444,6 +375,101 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Deserializer::parseTexture(const std::string& value, std::string& filename, sf::IntRect& partRect, sf::IntRect& middleRect, bool& smooth)
+    {
+        filename.clear();
+        partRect = {};
+        middleRect = {};
+        smooth = false;
+
+        if (value.empty() || (toLower(value) == "none"))
+            return;
+
+        // If there are no quotes then the value just contains a filename
+        if (value[0] != '"')
+        {
+            filename = value;
+            return;
+        }
+
+        std::string::const_iterator c = value.begin();
+        ++c; // Skip the opening quote
+
+        char prev = '\0';
+
+        // Look for the end quote
+        bool filenameFound = false;
+        while (c != value.end())
+        {
+            if ((*c != '"') || (prev == '\\'))
+            {
+                prev = *c;
+                filename.push_back(*c);
+                ++c;
+            }
+            else
+            {
+                ++c;
+                filenameFound = true;
+                break;
+            }
+        }
+
+        if (!filenameFound)
+            throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find the closing quote of the filename."};
+
+        // There may be optional parameters
+        while (removeWhitespace(value, c))
+        {
+            std::string word;
+            auto openingBracketPos = value.find('(', c - value.begin());
+            if (openingBracketPos != std::string::npos)
+                word = value.substr(c - value.begin(), openingBracketPos - (c - value.begin()));
+            else
+            {
+                if (toLower(trim(value.substr(c - value.begin()))) == "smooth")
+                {
+                    smooth = true;
+                    break;
+                }
+                else
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Invalid text found behind filename."};
+            }
+
+            sf::IntRect* rect = nullptr;
+            if ((word == "Part") || (word == "part"))
+            {
+                rect = &partRect;
+                std::advance(c, 4);
+            }
+            else if ((word == "Middle") || (word == "middle"))
+            {
+                rect = &middleRect;
+                std::advance(c, 6);
+            }
+            else
+            {
+                if (word.empty())
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Expected 'Part' or 'Middle' in front of opening bracket."};
+                else
+                    throw Exception{"Failed to deserialize texture '" + value + "'. Unexpected word '" + word + "' in front of opening bracket. Expected 'Part' or 'Middle'."};
+            }
+
+            auto closeBracketPos = value.find(')', c - value.begin());
+            if (closeBracketPos != std::string::npos)
+            {
+                if (!readIntRect(value.substr(c - value.begin(), closeBracketPos - (c - value.begin()) + 1), *rect))
+                    throw Exception{"Failed to parse " + word + " rectangle while deserializing texture '" + value + "'."};
+            }
+            else
+                throw Exception{"Failed to deserialize texture '" + value + "'. Failed to find closing bracket for " + word + " rectangle."};
+
+            std::advance(c, closeBracketPos - (c - value.begin()) + 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<std::string> Deserializer::split(const std::string& str, char delim)
     {
         std::vector<std::string> tokens;
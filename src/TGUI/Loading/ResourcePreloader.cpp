@@ -0,0 +1,293 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/ResourcePreloader.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/PropertyTable.hpp>
+#include <TGUI/Texture.hpp>
+#include <TGUI/Global.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::vector<ResourcePreloader*> ResourcePreloader::m_preloaders;
+
+    namespace
+    {
+        bool isAbsolutePath(const std::string& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            return (filename[0] == '/') || (filename[0] == '\\') || ((filename.size() > 1) && (filename[1] == ':'));
+        #else
+            return filename[0] == '/';
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the filename that will be passed to the texture loader when the value is deserialized
+        std::string getTextureFilename(const std::string& value)
+        {
+            std::string filename;
+            sf::IntRect partRect;
+            sf::IntRect middleRect;
+            bool smooth;
+            Deserializer::parseTexture(value, filename, partRect, middleRect, smooth);
+            if (filename.empty())
+                return "";
+
+            // An unquoted filename gets the resource path in front of it while deserializing, before the texture adds it again
+            if ((value[0] != '"') && !isAbsolutePath(filename))
+                filename = getResourcePath() + filename;
+
+            if (isAbsolutePath(filename))
+                return filename;
+            else
+                return getResourcePath() + filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the filename that will be loaded when the value is deserialized
+        std::string getFontFilename(const std::string& value)
+        {
+            if ((value == "null") || (value == "nullptr"))
+                return "";
+
+            const std::string filename = Deserializer::deserialize(ObjectConverter::Type::String, value).getString();
+            if (filename.empty())
+                return "";
+
+            if (isAbsolutePath(filename))
+                return filename;
+            else
+                return getResourcePath() + filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns whether the node has a Visible property that is set to false
+        bool isHidden(const DataIO::Node& node)
+        {
+            const auto it = node.propertyValuePairs.find("visible");
+            if ((it == node.propertyValuePairs.end()) || !it->second)
+                return false;
+
+            try
+            {
+                return !Deserializer::deserialize(ObjectConverter::Type::Bool, it->second->value).getBool();
+            }
+            catch (const Exception&)
+            {
+                return false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns whether the node describes a child widget instead of e.g. a renderer
+        bool isWidgetSection(const DataIO::Node& node)
+        {
+            return WidgetFactory::getConstructFunction(toLower(node.name.substr(0, node.name.find('.')))) != nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePreloader::ResourcePreloader(priv::ThreadPool* threadPool) :
+        m_threadPool{threadPool}
+    {
+        m_preloaders.push_back(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePreloader::~ResourcePreloader()
+    {
+        // Tasks that are still running only keep their own result alive, so they don't have to be waited for
+        m_preloaders.erase(std::find(m_preloaders.begin(), m_preloaders.end(), this));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ResourcePreloader::PendingResources ResourcePreloader::preload(const DataIO::Node& node, bool skipHiddenWidgets)
+    {
+        PendingResources resources;
+        preloadNode(node, resources, skipHiddenWidgets);
+        return resources;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> ResourcePreloader::preloadImage(const std::string& filename)
+    {
+        auto it = m_images.find(filename);
+        if (it != m_images.end())
+            return it->second.loaded;
+
+        auto image = std::make_shared<std::shared_ptr<sf::Image>>();
+        const auto& imageLoader = Texture::getImageLoader();
+        const std::shared_future<void> loaded = getThreadPool().submit([image,imageLoader,filename]{
+                *image = imageLoader(filename);
+            }).share();
+
+        m_images[filename] = {loaded, image};
+        return loaded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<void> ResourcePreloader::preloadFont(const std::string& filename)
+    {
+        auto it = m_fonts.find(filename);
+        if (it != m_fonts.end())
+            return it->second.loaded;
+
+        auto font = std::make_shared<std::shared_ptr<sf::Font>>(std::make_shared<sf::Font>());
+        const std::shared_future<void> loaded = getThreadPool().submit([font,filename]{
+                (*font)->loadFromFile(filename);
+            }).share();
+
+        m_fonts[filename] = {loaded, font};
+        return loaded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ResourcePreloader::isReady(const PendingResources& resources)
+    {
+        for (const auto& resource : resources)
+        {
+            if (resource.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ResourcePreloader::findImage(const std::string& filename, std::unique_ptr<sf::Image>& image)
+    {
+        for (auto preloaderIt = m_preloaders.rbegin(); preloaderIt != m_preloaders.rend(); ++preloaderIt)
+        {
+            const auto it = (*preloaderIt)->m_images.find(filename);
+            if (it == (*preloaderIt)->m_images.end())
+                continue;
+
+            it->second.loaded.wait();
+            if (*it->second.value)
+                image = std::make_unique<sf::Image>(**it->second.value);
+            else
+                image = nullptr;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ResourcePreloader::findFont(const std::string& filename, std::shared_ptr<sf::Font>& font)
+    {
+        for (auto preloaderIt = m_preloaders.rbegin(); preloaderIt != m_preloaders.rend(); ++preloaderIt)
+        {
+            const auto it = (*preloaderIt)->m_fonts.find(filename);
+            if (it == (*preloaderIt)->m_fonts.end())
+                continue;
+
+            it->second.loaded.wait();
+            font = *it->second.value;
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ResourcePreloader::preloadNode(const DataIO::Node& node, PendingResources& resources, bool skipHiddenWidgets)
+    {
+        for (const auto& pair : node.propertyValuePairs)
+        {
+            if (!pair.second)
+                continue;
+
+            const auto type = priv::getPropertyType(priv::internPropertyName(pair.first));
+            if ((type != ObjectConverter::Type::Texture) && (type != ObjectConverter::Type::Font))
+                continue;
+
+            // Values that can't be parsed are skipped here, the error will be reported when the widget is loaded
+            std::string filename;
+            try
+            {
+                if (type == ObjectConverter::Type::Texture)
+                    filename = getTextureFilename(pair.second->value);
+                else
+                    filename = getFontFilename(pair.second->value);
+            }
+            catch (const Exception&)
+            {
+                continue;
+            }
+
+            if (filename.empty())
+                continue;
+
+            if (type == ObjectConverter::Type::Texture)
+                resources.push_back(preloadImage(filename));
+            else
+                resources.push_back(preloadFont(filename));
+        }
+
+        // The child widgets of a hidden container aren't created yet when they are loaded lazily
+        const bool skipChildWidgets = skipHiddenWidgets && isHidden(node);
+        for (const auto& child : node.children)
+        {
+            if (!skipChildWidgets || !isWidgetSection(*child))
+                preloadNode(*child, resources, skipHiddenWidgets);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::ThreadPool& ResourcePreloader::getThreadPool()
+    {
+        if (!m_threadPool)
+            m_threadPool = &priv::ThreadPool::getDefault();
+
+        return *m_threadPool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
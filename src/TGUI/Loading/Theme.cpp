@@ -266,60 +266,25 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
+            const auto properties = m_themeLoader->loadProperties(m_primary, pair.first);
+
+            // The widgets using the renderer are notified once about all updated properties, both new ones and old ones
+            // that are now reset to their default value
+            renderer->beginUpdate();
+            for (const auto& property : renderer->propertyValuePairs.getIndex())
+                renderer->propertyChanged(property.first);
 
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
-            {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
-                    ++oldIt;
-                }
-                else
-                {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
-                }
-            }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
+            renderer->propertyValuePairs = properties;
 
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
+            for (const auto& property : renderer->propertyValuePairs.getIndex())
+                renderer->propertyChanged(property.first);
 
-                ++newIt;
-            }
+            renderer->endUpdate();
         }
     }
 
@@ -335,9 +300,7 @@ namespace tgui
             return it->second;
 
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -358,9 +321,7 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = m_themeLoader->loadProperties(m_primary, lowercaseSecondary);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -26,6 +26,7 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
@@ -53,6 +54,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> DefaultThemeLoader::m_rendererCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,31 +107,117 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
+        using SectionMap = std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the lowercase name of the section that a property refers to, or an empty string when it isn't a reference
+        std::string getReferencedSection(const sf::String& value)
+        {
+            if (value.isEmpty() || (value[0] != '&'))
+                return "";
+
+            return toLower(Deserializer::deserialize(ObjectConverter::Type::String, value.substring(1)).getString());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Replaces the references to other sections by a string containing the referenced section.
+        // Every referenced section is only serialized once, the string is stored in resolvedSections.
+        void resolveReferences(const SectionMap& sections, std::map<std::string, sf::String>& resolvedSections, const std::unique_ptr<DataIO::Node>& node)
         {
             for (const auto& pair : node->propertyValuePairs)
             {
-                // Check if this property is a reference to another section
-                if (!pair.second->value.isEmpty() && (pair.second->value[0] == '&'))
-                {
-                    std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, pair.second->value.substring(1)).getString());
+                const std::string name = getReferencedSection(pair.second->value);
+                if (name.empty())
+                    continue;
 
+                auto resolvedIt = resolvedSections.find(name);
+                if (resolvedIt == resolvedSections.end())
+                {
                     auto sectionsIt = sections.find(name);
                     if (sectionsIt == sections.end())
                         throw Exception{"Undefined reference to '" + name + "' encountered."};
 
                     // Resolve references recursively
-                    resolveReferences(sections, sectionsIt->second);
+                    resolveReferences(sections, resolvedSections, sectionsIt->second);
 
                     // Make a copy of the section
                     std::stringstream ss;
                     DataIO::emit(sectionsIt->second, ss);
-                    pair.second->value = "{\n" + ss.str() + "}";
+                    resolvedIt = resolvedSections.emplace(name, "{\n" + ss.str() + "}").first;
                 }
+
+                pair.second->value = resolvedIt->second;
             }
 
             for (const auto& child : node->children)
-                resolveReferences(sections, child);
+                resolveReferences(sections, resolvedSections, child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::shared_ptr<RendererData> getSectionRenderer(const std::string& name, const SectionMap& sections,
+                                                         std::map<std::string, std::shared_ptr<RendererData>>& renderers);
+
+        // Creates the renderer data for a section. Nested sections become renderer data themselves and references to other
+        // sections are linked to the renderer data of the referenced section, so that no section has to be parsed again.
+        std::shared_ptr<RendererData> createRenderer(const DataIO::Node& node, const SectionMap& sections,
+                                                     std::map<std::string, std::shared_ptr<RendererData>>& renderers)
+        {
+            auto rendererData = RendererData::create();
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                const std::string name = getReferencedSection(pair.second->value);
+                if (name.empty())
+                    rendererData->propertyValuePairs[toLower(pair.first)] = ObjectConverter(pair.second->value);
+                else
+                    rendererData->propertyValuePairs[toLower(pair.first)] = ObjectConverter(getSectionRenderer(name, sections, renderers));
+            }
+
+            for (const auto& child : node.children)
+                rendererData->propertyValuePairs[toLower(child->name)] = ObjectConverter(createRenderer(*child, sections, renderers));
+
+            return rendererData;
+        }
+
+        // Returns the renderer data of a top-level section, which is created when it didn't exist yet
+        std::shared_ptr<RendererData> getSectionRenderer(const std::string& name, const SectionMap& sections,
+                                                         std::map<std::string, std::shared_ptr<RendererData>>& renderers)
+        {
+            const auto renderersIt = renderers.find(name);
+            if (renderersIt != renderers.end())
+            {
+                // The renderer is only still missing when it is being created, so the section refers to itself
+                if (!renderersIt->second)
+                    throw Exception{"Circular reference to '" + name + "' encountered."};
+
+                return renderersIt->second;
+            }
+
+            const auto sectionsIt = sections.find(name);
+            if (sectionsIt == sections.end())
+                throw Exception{"Undefined reference to '" + name + "' encountered."};
+
+            renderers[name] = nullptr;
+            auto rendererData = createRenderer(*sectionsIt->second.get(), sections, renderers);
+            renderers[name] = rendererData;
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates renderer data that overrides the shared data, with its own overrides for the nested renderers at every depth
+        std::shared_ptr<RendererData> createNestedOverride(const std::shared_ptr<RendererData>& sharedData)
+        {
+            auto data = RendererData::createOverride(sharedData);
+            for (auto& pair : sharedData->getAllProperties())
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    data->propertyValuePairs[pair.first] = {createNestedOverride(pair.second.getRenderer())};
+            }
+
+            return data;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +231,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> BaseThemeLoader::loadProperties(const std::string& primary, const std::string& secondary)
+    {
+        std::map<std::string, ObjectConverter> properties;
+        for (const auto& pair : load(primary, secondary))
+            properties.emplace(pair.first, ObjectConverter{pair.second});
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -150,10 +249,13 @@ namespace tgui
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            m_rendererCache.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
+            m_rendererCache.clear();
         }
     }
 
@@ -188,15 +290,22 @@ namespace tgui
             }
 
             // Get a list of section names and map them to their nodes (needed for resolving references)
-            std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+            SectionMap sections;
             for (const auto& child : root->children)
             {
                 std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
                 sections.emplace(name, std::cref(child));
             }
 
+            // Create the renderer data of each section once, before the references are replaced by strings
+            auto& renderers = m_rendererCache[filename];
+            renderers.clear();
+            for (const auto& section : sections)
+                getSectionRenderer(section.first, sections, renderers);
+
             // Resolve references to sections
-            resolveReferences(sections, root);
+            std::map<std::string, sf::String> resolvedSections;
+            resolveReferences(sections, resolvedSections, root);
 
             // Cache all propery value pairs
             for (const auto& section : sections)
@@ -218,6 +327,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, ObjectConverter> DefaultThemeLoader::loadProperties(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename.empty())
+            return {};
+
+        const auto& renderers = m_rendererCache[filename];
+        const auto it = renderers.find(toLower(section));
+        if (it == renderers.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        // The nested renderers are shared with the other sections that use them. Every call gets its own renderer data
+        // that overrides the shared data, also for renderers that are nested deeper (e.g. the scrollbar inside the list box
+        // of a combo box), so that changing a nested renderer doesn't affect the other users.
+        auto properties = it->second->getAllProperties();
+        for (auto& pair : properties)
+        {
+            if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                pair.second = createNestedOverride(pair.second.getRenderer());
+        }
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
     {
         preload(filename);
@@ -246,6 +383,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<std::string> DefaultThemeLoader::getSectionNames(const std::string& filename)
+    {
+        preload(filename);
+
+        std::vector<std::string> names;
+        for (const auto& section : m_propertiesCache[filename])
+            names.push_back(section.first);
+
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::readFile(const std::string& filename, std::stringstream& contents) const
     {
         if (filename.empty())
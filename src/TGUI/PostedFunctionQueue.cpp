@@ -0,0 +1,185 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PostedFunctionQueue.hpp>
+#include <SFML/System/Clock.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        PostedFunctionQueue::PostedFunctionQueue() :
+            m_head{&m_stub},
+            m_tail{&m_stub}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        PostedFunctionQueue::~PostedFunctionQueue()
+        {
+            while (Node* node = popNode())
+                delete node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void PostedFunctionQueue::push(std::function<void()> function, const void* key)
+        {
+            Node* node = new Node;
+            node->function = std::move(function);
+            node->key = key;
+            pushNode(node);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void PostedFunctionQueue::process(sf::Time timeBudget)
+        {
+            // Don't execute the functions recursively when one of them causes the queue to be processed again
+            if (m_processing)
+                return;
+
+            collectPushedFunctions();
+            if (m_pending.empty())
+                return;
+
+            // The flag is reset by the guard, so that the queue can still be processed after a posted function has thrown
+            struct ProcessingGuard
+            {
+                explicit ProcessingGuard(bool& processing) : flag{processing} { flag = true; }
+                ~ProcessingGuard() { flag = false; }
+                bool& flag;
+            };
+
+            const ProcessingGuard guard{m_processing};
+            const sf::Clock clock;
+            do
+            {
+                PendingFunction pending = std::move(m_pending.front());
+                m_pending.pop_front();
+
+                if (pending.key)
+                    m_pendingKeys.erase(pending.key);
+                ++m_frontSequenceNumber;
+
+                pending.function();
+            }
+            while (!m_pending.empty() && ((timeBudget == sf::Time::Zero) || (clock.getElapsedTime() < timeBudget)));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool PostedFunctionQueue::empty() const
+        {
+            return m_pending.empty() && (m_tail == &m_stub) && (m_stub.next.load(std::memory_order_acquire) == nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void PostedFunctionQueue::collectPushedFunctions()
+        {
+            while (Node* node = popNode())
+            {
+                if (node->key)
+                {
+                    // If there is already a function with the same key waiting then it is replaced by the newer one
+                    const auto it = m_pendingKeys.find(node->key);
+                    if (it != m_pendingKeys.end())
+                    {
+                        m_pending[static_cast<std::size_t>(it->second - m_frontSequenceNumber)].function = std::move(node->function);
+                        delete node;
+                        continue;
+                    }
+
+                    m_pendingKeys[node->key] = m_frontSequenceNumber + m_pending.size();
+                }
+
+                m_pending.push_back({std::move(node->function), node->key});
+                delete node;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void PostedFunctionQueue::pushNode(Node* node)
+        {
+            node->next.store(nullptr, std::memory_order_relaxed);
+            Node* const previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        PostedFunctionQueue::Node* PostedFunctionQueue::popNode()
+        {
+            Node* tail = m_tail;
+            Node* next = tail->next.load(std::memory_order_acquire);
+
+            // Skip the stub node, it is only there to make sure the list is never empty
+            if (tail == &m_stub)
+            {
+                if (!next)
+                    return nullptr;
+
+                m_tail = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if (next)
+            {
+                m_tail = next;
+                return tail;
+            }
+
+            // A producer may have swapped the head without having linked its node yet, we will find the node next time
+            if (tail != m_head.load(std::memory_order_acquire))
+                return nullptr;
+
+            // The tail is the last node, put the stub node behind it so that the tail can be removed
+            pushNode(&m_stub);
+
+            next = tail->next.load(std::memory_order_acquire);
+            if (next)
+            {
+                m_tail = next;
+                return tail;
+            }
+
+            return nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
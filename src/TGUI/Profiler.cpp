@@ -0,0 +1,416 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Profiler.hpp>
+
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Font.hpp>
+
+#include <ostream>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            bool isGuiScope(Profiler::ScopeKind kind)
+            {
+                return (kind == Profiler::ScopeKind::HandleEvent) || (kind == Profiler::ScopeKind::UpdateTime) || (kind == Profiler::ScopeKind::Draw);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            const char* getCategory(Profiler::ScopeKind kind)
+            {
+                switch (kind)
+                {
+                    case Profiler::ScopeKind::WidgetDraw:
+                        return "draw";
+                    case Profiler::ScopeKind::WidgetUpdate:
+                        return "update";
+                    case Profiler::ScopeKind::WidgetRendererChanged:
+                        return "rendererChanged";
+                    default:
+                        return "gui";
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            const char* getGuiFunctionName(Profiler::ScopeKind kind)
+            {
+                switch (kind)
+                {
+                    case Profiler::ScopeKind::HandleEvent:
+                        return "Gui::handleEvent";
+                    case Profiler::ScopeKind::UpdateTime:
+                        return "Gui::updateTime";
+                    default:
+                        return "Gui::draw";
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            sf::Time toTime(std::chrono::steady_clock::duration duration)
+            {
+                return sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            double toMicroseconds(std::chrono::steady_clock::duration duration)
+            {
+                return std::chrono::duration<double, std::micro>(duration).count();
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void writeJsonString(std::ostream& stream, const std::string& str)
+            {
+                stream << '"';
+                for (const char c : str)
+                {
+                    if ((c == '"') || (c == '\\'))
+                        stream << '\\' << c;
+                    else if (static_cast<unsigned char>(c) < 0x20)
+                        stream << ' ';
+                    else
+                        stream << c;
+                }
+                stream << '"';
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Profiler* Profiler::m_activeProfiler = nullptr;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Profiler::~Profiler()
+        {
+            if (m_activeProfiler == this)
+                m_activeProfiler = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::setEnabled(bool enabled)
+        {
+            m_enabled = enabled;
+            m_currentFrame = {};
+            m_completedFrame = {};
+            m_lastTexture = nullptr;
+
+            if (!enabled)
+            {
+                m_tracing = false;
+                m_traceEvents.clear();
+                m_traceCounters.clear();
+
+                if (m_activeProfiler == this)
+                    m_activeProfiler = nullptr;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool Profiler::isEnabled() const
+        {
+            return m_enabled;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::activate()
+        {
+            if (m_enabled)
+                m_activeProfiler = this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const FrameStatistics& Profiler::getFrameStatistics() const
+        {
+            return m_completedFrame;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::startTrace()
+        {
+            m_tracing = true;
+            m_traceEvents.clear();
+            m_traceCounters.clear();
+            m_traceStart = Clock::now();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool Profiler::isTracing() const
+        {
+            return m_tracing;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::stopTrace(std::ostream& stream)
+        {
+            stream << "{\"traceEvents\":[";
+
+            bool first = true;
+            for (const auto& event : m_traceEvents)
+            {
+                stream << (first ? "\n" : ",\n");
+                first = false;
+
+                stream << "{\"name\":";
+                if (isGuiScope(event.kind))
+                    writeJsonString(stream, getGuiFunctionName(event.kind));
+                else
+                    writeJsonString(stream, event.widgetType);
+
+                stream << ",\"cat\":\"" << getCategory(event.kind) << "\",\"ph\":\"X\""
+                       << ",\"ts\":" << toMicroseconds(event.start - m_traceStart)
+                       << ",\"dur\":" << toMicroseconds(event.duration)
+                       << ",\"pid\":1,\"tid\":1}";
+            }
+
+            for (const auto& counters : m_traceCounters)
+            {
+                stream << (first ? "\n" : ",\n");
+                first = false;
+
+                stream << "{\"name\":\"Frame\",\"ph\":\"C\",\"ts\":" << toMicroseconds(counters.time - m_traceStart)
+                       << ",\"pid\":1,\"tid\":1,\"args\":{"
+                       << "\"drawCalls\":" << counters.drawCalls
+                       << ",\"vertices\":" << counters.vertices
+                       << ",\"textureBinds\":" << counters.textureBinds
+                       << ",\"clipChanges\":" << counters.clipChanges << "}}";
+            }
+
+            stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+            m_tracing = false;
+            m_traceEvents.clear();
+            m_traceCounters.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Profiler* Profiler::getActive()
+        {
+            return m_activeProfiler;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::countDrawCall(std::size_t vertexCount, const sf::Texture* texture)
+        {
+            Profiler* profiler = m_activeProfiler;
+            if (!profiler)
+                return;
+
+            profiler->m_currentFrame.drawCalls++;
+            profiler->m_currentFrame.vertices += vertexCount;
+
+            if (texture && (texture != profiler->m_lastTexture))
+            {
+                profiler->m_currentFrame.textureBinds++;
+                profiler->m_lastTexture = texture;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::countDrawCall(const sf::Shape& shape)
+        {
+            if (!m_activeProfiler)
+                return;
+
+            // The inside of a shape is drawn as a triangle fan and its outline in a separate draw call as a triangle strip
+            const std::size_t pointCount = shape.getPointCount();
+            countDrawCall(pointCount + 2, shape.getTexture());
+            if (shape.getOutlineThickness() != 0)
+                countDrawCall((pointCount + 1) * 2, nullptr);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::countDrawCall(const sf::Sprite& sprite)
+        {
+            if (m_activeProfiler)
+                countDrawCall(4, sprite.getTexture());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::countDrawCall(const sf::Text& text)
+        {
+            if (!m_activeProfiler || !text.getFont())
+                return;
+
+            // Every visible character becomes two triangles, twice when the text has an outline
+            const sf::String& string = text.getString();
+            std::size_t glyphs = 0;
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                if ((string[i] != ' ') && (string[i] != '\t') && (string[i] != '\n') && (string[i] != '\r'))
+                    glyphs++;
+            }
+
+            const sf::Texture* texture = &text.getFont()->getTexture(text.getCharacterSize());
+            if (text.getOutlineThickness() != 0)
+                countDrawCall(glyphs * 12, texture);
+            else
+                countDrawCall(glyphs * 6, texture);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::countClipChange()
+        {
+            if (m_activeProfiler)
+                m_activeProfiler->m_currentFrame.clipChanges++;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::beginScope(ScopeKind kind)
+        {
+            m_openScopes.push_back({kind, Clock::now(), Clock::duration::zero()});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::endScope(const std::string* widgetType)
+        {
+            const Clock::time_point end = Clock::now();
+            const OpenScope scope = m_openScopes.back();
+            m_openScopes.pop_back();
+
+            const Clock::duration duration = end - scope.start;
+            const Clock::duration selfDuration = duration - scope.childTime;
+
+            // Gui functions exclude each other (draw calls updateTime), widgets only exclude nested widgets doing the same thing
+            const bool guiScope = isGuiScope(scope.kind);
+            for (auto it = m_openScopes.rbegin(); it != m_openScopes.rend(); ++it)
+            {
+                if (guiScope ? isGuiScope(it->kind) : (it->kind == scope.kind))
+                {
+                    it->childTime += duration;
+                    break;
+                }
+            }
+
+            switch (scope.kind)
+            {
+                case ScopeKind::HandleEvent:
+                {
+                    m_currentFrame.eventTime += toTime(selfDuration);
+                    m_currentFrame.events++;
+                    break;
+                }
+                case ScopeKind::UpdateTime:
+                {
+                    m_currentFrame.updateTime += toTime(selfDuration);
+                    break;
+                }
+                case ScopeKind::Draw:
+                {
+                    m_currentFrame.drawTime += toTime(selfDuration);
+                    break;
+                }
+                case ScopeKind::WidgetDraw:
+                case ScopeKind::WidgetUpdate:
+                case ScopeKind::WidgetRendererChanged:
+                {
+                    auto& statistics = m_currentFrame.widgetTypes[*widgetType];
+                    FrameStatistics::Timing& timing = (scope.kind == ScopeKind::WidgetDraw) ? statistics.draw
+                                                    : ((scope.kind == ScopeKind::WidgetUpdate) ? statistics.update : statistics.rendererChanged);
+                    timing.time += toTime(duration);
+                    timing.selfTime += toTime(selfDuration);
+                    timing.count++;
+                    break;
+                }
+            }
+
+            if (m_tracing)
+                m_traceEvents.push_back({scope.kind, guiScope ? std::string{} : *widgetType, scope.start, duration});
+
+            if (scope.kind == ScopeKind::Draw)
+                finishFrame();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Profiler::finishFrame()
+        {
+            if (!m_enabled)
+                return;
+
+            if (m_tracing)
+            {
+                m_traceCounters.push_back({Clock::now(), m_currentFrame.drawCalls, m_currentFrame.vertices,
+                                           m_currentFrame.textureBinds, m_currentFrame.clipChanges});
+            }
+
+            m_completedFrame = std::move(m_currentFrame);
+            m_currentFrame = {};
+            m_lastTexture = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ProfileScope::ProfileScope(Profiler::ScopeKind kind, const std::string* widgetType) :
+            m_profiler  {Profiler::getActive()},
+            m_widgetType{widgetType}
+        {
+            if (m_profiler)
+                m_profiler->beginScope(kind);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ProfileScope::~ProfileScope()
+        {
+            if (m_profiler)
+                m_profiler->endScope(m_widgetType);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
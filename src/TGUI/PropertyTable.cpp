@@ -0,0 +1,337 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PropertyTable.hpp>
+#include <TGUI/Global.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct PropertyNameRegistry
+        {
+            PropertyNameRegistry()
+            {
+                // The predefined properties are registered first, so that their ids match the values in the Property enum
+            #define TGUI_REGISTER_PROPERTY_NAME(NAME, TYPE) \
+                ids.emplace(toLower(#NAME), static_cast<PropertyId>(names.size())); \
+                names.push_back(toLower(#NAME));
+
+                TGUI_RENDERER_PROPERTIES(TGUI_REGISTER_PROPERTY_NAME)
+            #undef TGUI_REGISTER_PROPERTY_NAME
+            }
+
+            std::mutex mutex;
+            std::unordered_map<std::string, PropertyId> ids;
+            std::deque<std::string> names; // A deque is used to keep references to the names valid
+        };
+
+        PropertyNameRegistry& getPropertyNameRegistry()
+        {
+            static PropertyNameRegistry registry;
+            return registry;
+        }
+
+        bool compareIndexEntry(const std::pair<PropertyId, ObjectConverter*>& entry, PropertyId id)
+        {
+            return entry.first < id;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        PropertyId internPropertyName(const std::string& name)
+        {
+            auto& registry = getPropertyNameRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            const auto it = registry.ids.find(name);
+            if (it != registry.ids.end())
+                return it->second;
+
+            const auto id = static_cast<PropertyId>(registry.names.size());
+            registry.names.push_back(name);
+            registry.ids.emplace(name, id);
+            return id;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::string& getPropertyName(PropertyId id)
+        {
+            auto& registry = getPropertyNameRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            return registry.names[id];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ObjectConverter::Type getPropertyType(PropertyId id)
+        {
+            static const ObjectConverter::Type types[] = {
+            #define TGUI_PROPERTY_TYPE(NAME, TYPE) ObjectConverter::Type::TYPE,
+                TGUI_RENDERER_PROPERTIES(TGUI_PROPERTY_TYPE)
+            #undef TGUI_PROPERTY_TYPE
+            };
+
+            if (id < Property::BuiltinPropertyCount)
+                return types[id];
+            else
+                return ObjectConverter::Type::None;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::PropertyTable(const Map& properties) :
+        m_properties{properties}
+    {
+        rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::PropertyTable(const PropertyTable& other) :
+        m_properties{other.m_properties}
+    {
+        rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable& PropertyTable::operator=(const PropertyTable& other)
+    {
+        if (this != &other)
+        {
+            m_properties = other.m_properties;
+            rebuildIndex();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable& PropertyTable::operator=(const Map& properties)
+    {
+        m_properties = properties;
+        rebuildIndex();
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyTable::operator[](const std::string& property)
+    {
+        const auto it = m_properties.find(property);
+        if (it != m_properties.end())
+            return it->second;
+
+        ObjectConverter& value = m_properties[property];
+        addToIndex(priv::internPropertyName(property), &value);
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& PropertyTable::operator[](PropertyId id)
+    {
+        if (ObjectConverter* value = get(id))
+            return *value;
+
+        ObjectConverter& value = m_properties[priv::getPropertyName(id)];
+        addToIndex(id, &value);
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* PropertyTable::get(PropertyId id)
+    {
+        const auto it = std::lower_bound(m_index.begin(), m_index.end(), id, compareIndexEntry);
+        if ((it != m_index.end()) && (it->first == id))
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ObjectConverter* PropertyTable::get(PropertyId id) const
+    {
+        const auto it = std::lower_bound(m_index.begin(), m_index.end(), id, compareIndexEntry);
+        if ((it != m_index.end()) && (it->first == id))
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::iterator PropertyTable::find(const std::string& property)
+    {
+        return m_properties.find(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::const_iterator PropertyTable::find(const std::string& property) const
+    {
+        return m_properties.find(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyTable::count(const std::string& property) const
+    {
+        return m_properties.count(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyTable::erase(const std::string& property)
+    {
+        if (m_properties.find(property) == m_properties.end())
+            return 0;
+
+        removeFromIndex(property);
+        return m_properties.erase(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::iterator PropertyTable::erase(const_iterator it)
+    {
+        removeFromIndex(it->first);
+        return m_properties.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::clear()
+    {
+        m_properties.clear();
+        m_index.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PropertyTable::size() const
+    {
+        return m_properties.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PropertyTable::empty() const
+    {
+        return m_properties.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::iterator PropertyTable::begin()
+    {
+        return m_properties.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::iterator PropertyTable::end()
+    {
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::const_iterator PropertyTable::begin() const
+    {
+        return m_properties.begin();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyTable::const_iterator PropertyTable::end() const
+    {
+        return m_properties.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const PropertyTable::Map& PropertyTable::getMap() const
+    {
+        return m_properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::pair<PropertyId, ObjectConverter*>>& PropertyTable::getIndex() const
+    {
+        return m_index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::addToIndex(PropertyId id, ObjectConverter* value)
+    {
+        const auto it = std::lower_bound(m_index.begin(), m_index.end(), id, compareIndexEntry);
+        m_index.insert(it, {id, value});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::removeFromIndex(const std::string& property)
+    {
+        const auto id = priv::internPropertyName(property);
+        const auto it = std::lower_bound(m_index.begin(), m_index.end(), id, compareIndexEntry);
+        if ((it != m_index.end()) && (it->first == id))
+            m_index.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PropertyTable::rebuildIndex()
+    {
+        m_index.clear();
+        m_index.reserve(m_properties.size());
+        for (auto& pair : m_properties)
+            m_index.emplace_back(priv::internPropertyName(pair.first), &pair.second);
+
+        std::sort(m_index.begin(), m_index.end(),
+                  [](const std::pair<PropertyId, ObjectConverter*>& left, const std::pair<PropertyId, ObjectConverter*>& right){ return left.first < right.first; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
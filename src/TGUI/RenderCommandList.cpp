@@ -0,0 +1,656 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/RenderCommandList.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        thread_local RenderCommandList* recordingCommands = nullptr;
+
+        // Amount of ParallelRecordingScope objects that currently exist, several guis may be drawn at the same time
+        std::atomic<unsigned int> parallelRecordingCount{0};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Render target that is passed to widgets while recording without a real target. Nothing is ever drawn on it.
+        class RecordingTarget : public sf::RenderTarget
+        {
+        public:
+
+            sf::Vector2u getSize() const override
+            {
+                return {0, 0};
+            }
+
+        #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
+        private:
+
+            bool activate(bool) override
+            {
+                return false;
+            }
+        #endif
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isIdentity(const sf::Transform& transform)
+        {
+            const float* matrix = transform.getMatrix();
+            for (unsigned int i = 0; i < 16; ++i)
+            {
+                if (matrix[i] != ((i % 5 == 0) ? 1.f : 0.f))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vector2f computeNormal(sf::Vector2f p1, sf::Vector2f p2)
+        {
+            sf::Vector2f normal{p1.y - p2.y, p2.x - p1.x};
+            const float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+            if (length != 0.f)
+                normal /= length;
+            return normal;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float dotProduct(sf::Vector2f p1, sf::Vector2f p2)
+        {
+            return p1.x * p2.x + p1.y * p2.y;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool intersect(const FloatRect& rect1, const FloatRect& rect2, FloatRect& intersection)
+        {
+            const float left = std::max(rect1.left, rect2.left);
+            const float top = std::max(rect1.top, rect2.top);
+            const float right = std::min(rect1.left + rect1.width, rect2.left + rect2.width);
+            const float bottom = std::min(rect1.top + rect1.height, rect2.top + rect2.height);
+            if ((left >= right) || (top >= bottom))
+            {
+                intersection = {left, top, 0, 0};
+                return false;
+            }
+
+            intersection = {left, top, right - left, bottom - top};
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Clips the polygon against one side of the clipping rectangle (Sutherland-Hodgman)
+        template <typename InsideFunc, typename IntersectFunc>
+        void clipPolygon(std::vector<sf::Vector2f>& polygon, std::vector<sf::Vector2f>& output, InsideFunc isInside, IntersectFunc getIntersection)
+        {
+            output.clear();
+            for (std::size_t i = 0; i < polygon.size(); ++i)
+            {
+                const sf::Vector2f& current = polygon[i];
+                const sf::Vector2f& previous = polygon[(i + polygon.size() - 1) % polygon.size()];
+                if (isInside(current))
+                {
+                    if (!isInside(previous))
+                        output.push_back(getIntersection(previous, current));
+                    output.push_back(current);
+                }
+                else if (isInside(previous))
+                    output.push_back(getIntersection(previous, current));
+            }
+
+            polygon.swap(output);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float getTriangleArea(sf::Vector2f p1, sf::Vector2f p2, sf::Vector2f p3, const FloatRect* clipRect)
+        {
+            if (!clipRect)
+                return std::abs((p2.x - p1.x) * (p3.y - p1.y) - (p3.x - p1.x) * (p2.y - p1.y)) / 2.f;
+
+            const float left = clipRect->left;
+            const float top = clipRect->top;
+            const float right = clipRect->left + clipRect->width;
+            const float bottom = clipRect->top + clipRect->height;
+
+            std::vector<sf::Vector2f> polygon{p1, p2, p3};
+            std::vector<sf::Vector2f> output;
+            clipPolygon(polygon, output, [=](sf::Vector2f p){ return p.x >= left; },
+                [=](sf::Vector2f a, sf::Vector2f b){ return sf::Vector2f{left, a.y + (b.y - a.y) * (left - a.x) / (b.x - a.x)}; });
+            clipPolygon(polygon, output, [=](sf::Vector2f p){ return p.x <= right; },
+                [=](sf::Vector2f a, sf::Vector2f b){ return sf::Vector2f{right, a.y + (b.y - a.y) * (right - a.x) / (b.x - a.x)}; });
+            clipPolygon(polygon, output, [=](sf::Vector2f p){ return p.y >= top; },
+                [=](sf::Vector2f a, sf::Vector2f b){ return sf::Vector2f{a.x + (b.x - a.x) * (top - a.y) / (b.y - a.y), top}; });
+            clipPolygon(polygon, output, [=](sf::Vector2f p){ return p.y <= bottom; },
+                [=](sf::Vector2f a, sf::Vector2f b){ return sf::Vector2f{a.x + (b.x - a.x) * (bottom - a.y) / (b.y - a.y), bottom}; });
+
+            // Shoelace formula
+            float area = 0;
+            for (std::size_t i = 0; i < polygon.size(); ++i)
+            {
+                const sf::Vector2f& current = polygon[i];
+                const sf::Vector2f& next = polygon[(i + 1) % polygon.size()];
+                area += current.x * next.y - next.x * current.y;
+            }
+
+            return std::abs(area) / 2.f;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::clear()
+    {
+        m_commands.clear();
+        m_vertices.clear();
+
+        // The texts aren't destroyed, so that the next frame can copy its texts into them without allocating memory
+        m_textCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addVertices(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        addCommand(m_vertices.size(), count, type, states);
+        m_vertices.insert(m_vertices.end(), vertices, vertices + count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addShape(const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        // The geometry is created in the same way as sfml does it, so that the result is identical to drawing the shape
+        const std::size_t pointCount = shape.getPointCount();
+        if (pointCount < 3)
+            return;
+
+        sf::RenderStates shapeStates = states;
+        shapeStates.transform *= shape.getTransform();
+        shapeStates.texture = shape.getTexture();
+
+        // The vertices are added directly to the list to avoid allocating memory for every shape
+        const std::size_t first = m_vertices.size();
+        m_vertices.resize(first + pointCount + 2);
+        sf::Vertex* vertices = &m_vertices[first];
+
+        for (std::size_t i = 0; i < pointCount; ++i)
+            vertices[i + 1].position = shape.getPoint(i);
+        vertices[pointCount + 1].position = vertices[1].position;
+
+        float minX = vertices[1].position.x;
+        float maxX = vertices[1].position.x;
+        float minY = vertices[1].position.y;
+        float maxY = vertices[1].position.y;
+        for (std::size_t i = 2; i <= pointCount; ++i)
+        {
+            minX = std::min(minX, vertices[i].position.x);
+            maxX = std::max(maxX, vertices[i].position.x);
+            minY = std::min(minY, vertices[i].position.y);
+            maxY = std::max(maxY, vertices[i].position.y);
+        }
+
+        const FloatRect insideBounds{minX, minY, maxX - minX, maxY - minY};
+        vertices[0].position = {insideBounds.left + insideBounds.width / 2.f, insideBounds.top + insideBounds.height / 2.f};
+
+        const sf::IntRect& textureRect = shape.getTextureRect();
+        for (std::size_t i = 0; i < pointCount + 2; ++i)
+        {
+            vertices[i].color = shape.getFillColor();
+
+            const float xRatio = (insideBounds.width > 0) ? (vertices[i].position.x - insideBounds.left) / insideBounds.width : 0;
+            const float yRatio = (insideBounds.height > 0) ? (vertices[i].position.y - insideBounds.top) / insideBounds.height : 0;
+            vertices[i].texCoords = {textureRect.left + textureRect.width * xRatio, textureRect.top + textureRect.height * yRatio};
+        }
+
+        addCommand(first, pointCount + 2, sf::PrimitiveType::TriangleFan, shapeStates);
+
+        const float outlineThickness = shape.getOutlineThickness();
+        if (outlineThickness == 0)
+            return;
+
+        const std::size_t firstOutline = m_vertices.size();
+        m_vertices.resize(firstOutline + (pointCount + 1) * 2);
+        vertices = &m_vertices[first]; // The vertices may have been moved by resizing
+        sf::Vertex* outlineVertices = &m_vertices[firstOutline];
+
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            const std::size_t index = i + 1;
+
+            const sf::Vector2f p0 = (i == 0) ? vertices[pointCount].position : vertices[index - 1].position;
+            const sf::Vector2f p1 = vertices[index].position;
+            const sf::Vector2f p2 = vertices[index + 1].position;
+
+            sf::Vector2f n1 = computeNormal(p0, p1);
+            sf::Vector2f n2 = computeNormal(p1, p2);
+
+            // Make sure that the normals point towards the outside of the shape
+            if (dotProduct(n1, vertices[0].position - p1) > 0)
+                n1 = -n1;
+            if (dotProduct(n2, vertices[0].position - p1) > 0)
+                n2 = -n2;
+
+            const float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+            const sf::Vector2f normal = (n1 + n2) / factor;
+
+            outlineVertices[i * 2 + 0].position = p1;
+            outlineVertices[i * 2 + 1].position = p1 + normal * outlineThickness;
+        }
+
+        outlineVertices[pointCount * 2 + 0].position = outlineVertices[0].position;
+        outlineVertices[pointCount * 2 + 1].position = outlineVertices[1].position;
+
+        for (std::size_t i = 0; i < (pointCount + 1) * 2; ++i)
+        {
+            outlineVertices[i].color = shape.getOutlineColor();
+            outlineVertices[i].texCoords = {};
+        }
+
+        shapeStates.texture = nullptr;
+        addCommand(firstOutline, (pointCount + 1) * 2, sf::PrimitiveType::TriangleStrip, shapeStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addText(const sf::Text& text, const sf::RenderStates& states)
+    {
+        RenderCommand command;
+        command.type = RenderCommand::Type::Text;
+        command.states = states;
+        command.first = m_textCount;
+        m_commands.push_back(command);
+
+        if (m_textCount < m_texts.size())
+            m_texts[m_textCount] = text;
+        else
+            m_texts.push_back(text);
+
+        ++m_textCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::pushClip(const sf::RenderStates& states, Vector2f topLeft, Vector2f size)
+    {
+        RenderCommand command;
+        command.type = RenderCommand::Type::PushClip;
+        command.states = states;
+        command.clipRect = {topLeft, size};
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::popClip()
+    {
+        RenderCommand command;
+        command.type = RenderCommand::Type::PopClip;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::append(const RenderCommandList& commands)
+    {
+        const std::size_t vertexOffset = m_vertices.size();
+
+        m_commands.reserve(m_commands.size() + commands.m_commands.size());
+        for (const auto& command : commands.m_commands)
+        {
+            if (command.type == RenderCommand::Type::Text)
+                addText(commands.m_texts[command.first], command.states);
+            else
+            {
+                m_commands.push_back(command);
+                if (command.type == RenderCommand::Type::Vertices)
+                    m_commands.back().first += vertexOffset;
+            }
+        }
+
+        m_vertices.insert(m_vertices.end(), commands.m_vertices.begin(), commands.m_vertices.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RenderCommand>& RenderCommandList::getCommands() const
+    {
+        return m_commands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::Vertex>& RenderCommandList::getVertices() const
+    {
+        return m_vertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RenderCommandList::getTextCount() const
+    {
+        return m_textCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Text& RenderCommandList::getText(std::size_t index) const
+    {
+        assert(index < m_textCount);
+        return m_texts[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RenderCommandList::getDrawCallCount() const
+    {
+        return static_cast<std::size_t>(std::count_if(m_commands.begin(), m_commands.end(), [](const RenderCommand& command){
+                return (command.type == RenderCommand::Type::Vertices) || (command.type == RenderCommand::Type::Text);
+            }));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float RenderCommandList::getDrawnArea() const
+    {
+        float area = 0;
+        std::vector<FloatRect> clipRects;
+        for (const auto& command : m_commands)
+        {
+            const FloatRect* clipRect = clipRects.empty() ? nullptr : &clipRects.back();
+            switch (command.type)
+            {
+                case RenderCommand::Type::Vertices:
+                {
+                    const sf::Transform& transform = command.states.transform;
+                    const sf::Vertex* vertices = &m_vertices[command.first];
+                    const auto triangleArea = [&](std::size_t i1, std::size_t i2, std::size_t i3){
+                            return getTriangleArea(transform.transformPoint(vertices[i1].position),
+                                                   transform.transformPoint(vertices[i2].position),
+                                                   transform.transformPoint(vertices[i3].position),
+                                                   clipRect);
+                        };
+
+                    if (command.primitiveType == sf::PrimitiveType::Triangles)
+                    {
+                        for (std::size_t i = 0; i + 2 < command.count; i += 3)
+                            area += triangleArea(i, i + 1, i + 2);
+                    }
+                    else if (command.primitiveType == sf::PrimitiveType::TriangleStrip)
+                    {
+                        for (std::size_t i = 0; i + 2 < command.count; ++i)
+                            area += triangleArea(i, i + 1, i + 2);
+                    }
+                    else if (command.primitiveType == sf::PrimitiveType::TriangleFan)
+                    {
+                        for (std::size_t i = 1; i + 1 < command.count; ++i)
+                            area += triangleArea(0, i, i + 1);
+                    }
+                    break;
+                }
+                case RenderCommand::Type::Text:
+                {
+                    FloatRect bounds = command.states.transform.transformRect(m_texts[command.first].getGlobalBounds());
+                    if (clipRect)
+                        intersect(bounds, *clipRect, bounds);
+
+                    area += bounds.width * bounds.height;
+                    break;
+                }
+                case RenderCommand::Type::PushClip:
+                {
+                    const Vector2f topLeft = command.states.transform.transformPoint(command.clipRect.getPosition());
+                    const Vector2f bottomRight = command.states.transform.transformPoint(command.clipRect.getPosition() + command.clipRect.getSize());
+
+                    FloatRect rect{topLeft, bottomRight - topLeft};
+                    if (clipRect)
+                        intersect(rect, *clipRect, rect);
+
+                    clipRects.push_back(rect);
+                    break;
+                }
+                case RenderCommand::Type::PopClip:
+                {
+                    clipRects.pop_back();
+                    break;
+                }
+            }
+        }
+
+        return area;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::addCommand(std::size_t first, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        RenderCommand command;
+        command.type = RenderCommand::Type::Vertices;
+        command.states = states;
+        command.primitiveType = type;
+        command.first = first;
+        command.count = count;
+        m_commands.push_back(command);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderCommandList::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        // The gui draws the list without a transform, in which case the transforms of the commands don't need to be combined
+        const bool combineTransforms = !isIdentity(states.transform);
+
+        std::vector<std::unique_ptr<Clipping>> clippings;
+        for (const auto& command : m_commands)
+        {
+            sf::RenderStates commandStates = command.states;
+            if (combineTransforms)
+            {
+                commandStates.transform = states.transform;
+                commandStates.transform *= command.states.transform;
+            }
+
+            switch (command.type)
+            {
+                case RenderCommand::Type::Vertices:
+                {
+                    target.draw(&m_vertices[command.first], command.count, command.primitiveType, commandStates);
+                    TGUI_PROFILE_DRAW_CALL(command.count, commandStates.texture);
+                    break;
+                }
+                case RenderCommand::Type::Text:
+                {
+                    target.draw(m_texts[command.first], commandStates);
+                    TGUI_PROFILE_DRAW_CALL(m_texts[command.first]);
+                    break;
+                }
+                case RenderCommand::Type::PushClip:
+                {
+                    clippings.push_back(std::make_unique<Clipping>(target, commandStates, command.clipRect.getPosition(), command.clipRect.getSize()));
+                    break;
+                }
+                case RenderCommand::Type::PopClip:
+                {
+                    clippings.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderCommandRecorder::RenderCommandRecorder(RenderCommandList& commands) :
+            m_previousCommands{recordingCommands}
+        {
+            recordingCommands = &commands;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderCommandRecorder::~RenderCommandRecorder()
+        {
+            recordingCommands = m_previousCommands;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        RenderCommandList* RenderCommandRecorder::getCommandList()
+        {
+            return recordingCommands;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::RenderTarget& RenderCommandRecorder::getRecordingTarget()
+        {
+            static RecordingTarget target;
+            return target;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ParallelRecordingScope::ParallelRecordingScope()
+        {
+            ++parallelRecordingCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ParallelRecordingScope::~ParallelRecordingScope()
+        {
+            --parallelRecordingCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool ParallelRecordingScope::isActive()
+        {
+            return parallelRecordingCount > 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawOrRecord(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states)
+        {
+            if (recordingCommands)
+                recordingCommands->addVertices(vertices, count, type, states);
+            else
+            {
+                target.draw(vertices, count, type, states);
+                TGUI_PROFILE_DRAW_CALL(count, states.texture);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawOrRecord(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+        {
+            if (recordingCommands)
+                recordingCommands->addShape(shape, states);
+            else
+            {
+                target.draw(shape, states);
+                TGUI_PROFILE_DRAW_CALL(shape);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawOrRecord(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+        {
+            if (recordingCommands)
+            {
+                const sf::FloatRect bounds = sprite.getLocalBounds();
+                const sf::IntRect& textureRect = sprite.getTextureRect();
+                const float left = static_cast<float>(textureRect.left);
+                const float right = left + textureRect.width;
+                const float top = static_cast<float>(textureRect.top);
+                const float bottom = top + textureRect.height;
+
+                const sf::Vertex vertices[] = {
+                    {{0, 0}, sprite.getColor(), {left, top}},
+                    {{0, bounds.height}, sprite.getColor(), {left, bottom}},
+                    {{bounds.width, 0}, sprite.getColor(), {right, top}},
+                    {{bounds.width, bounds.height}, sprite.getColor(), {right, bottom}}
+                };
+
+                sf::RenderStates spriteStates = states;
+                spriteStates.transform *= sprite.getTransform();
+                spriteStates.texture = sprite.getTexture();
+                recordingCommands->addVertices(vertices, 4, sf::PrimitiveType::TriangleStrip, spriteStates);
+            }
+            else
+            {
+                target.draw(sprite, states);
+                TGUI_PROFILE_DRAW_CALL(sprite);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawOrRecord(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states)
+        {
+            if (recordingCommands)
+                recordingCommands->addText(text, states);
+            else
+            {
+                target.draw(text, states);
+                TGUI_PROFILE_DRAW_CALL(text);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
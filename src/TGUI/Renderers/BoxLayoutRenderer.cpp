@@ -34,22 +34,22 @@ namespace tgui
 
     void BoxLayoutRenderer::setSpaceBetweenWidgets(float distance)
     {
-        setProperty("spacebetweenwidgets", ObjectConverter{distance});
+        setProperty(Property::SpaceBetweenWidgets, ObjectConverter{distance});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("spacebetweenwidgets");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter* value = m_data->findProperty(Property::SpaceBetweenWidgets);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("padding");
-            if (it != m_data->propertyValuePairs.end())
+            value = m_data->findProperty(Property::Padding);
+            if (value)
             {
-                const Padding padding = it->second.getOutline();
+                const Padding padding = value->getOutline();
                 return std::max(std::min(padding.getLeft(), padding.getRight()), std::min(padding.getTop(), padding.getBottom()));
             }
             else
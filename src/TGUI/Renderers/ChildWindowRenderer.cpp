@@ -54,14 +54,14 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("titlebarheight");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter* value = m_data->findProperty(Property::TitleBarHeight);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("texturetitlebar");
-            if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
-                return it->second.getTexture().getImageSize().y;
+            value = m_data->findProperty(Property::TextureTitleBar);
+            if (value && value->getTexture().getData())
+                return value->getTexture().getImageSize().y;
             else
                 return 20;
         }
@@ -71,7 +71,7 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("titlebarheight", ObjectConverter{number});
+        setProperty(Property::TitleBarHeight, ObjectConverter{number});
     }
 }
 
@@ -26,6 +26,9 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 
+#include <algorithm>
+#include <cassert>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -34,6 +37,166 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererData::~RendererData()
+    {
+        if (base)
+            base->observers.erase(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> RendererData::createOverride(const std::shared_ptr<RendererData>& base)
+    {
+        auto data = std::make_shared<RendererData>();
+        data->shared = false;
+        data->base = base;
+
+        // Pass the changes in the base data on to our own observers, except for properties that we override
+        std::weak_ptr<RendererData> weakData = data;
+        base->observers[data.get()] = [weakData](const std::vector<PropertyId>& properties){
+                const auto overrideData = weakData.lock();
+                if (!overrideData)
+                    return;
+
+                std::vector<PropertyId> inheritedProperties;
+                for (const auto property : properties)
+                {
+                    if (!overrideData->propertyValuePairs.get(property))
+                        inheritedProperties.push_back(property);
+                }
+
+                if (inheritedProperties.empty())
+                    return;
+
+                if (overrideData->updateDepth > 0)
+                    overrideData->changedProperties.insert(overrideData->changedProperties.end(), inheritedProperties.begin(), inheritedProperties.end());
+                else
+                {
+                    for (const auto& observer : overrideData->observers)
+                        observer.second(inheritedProperties);
+                }
+            };
+
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererData::findProperty(PropertyId property)
+    {
+        for (RendererData* data = this; data; data = data->base.get())
+        {
+            ObjectConverter* value = data->propertyValuePairs.get(property);
+            if (value)
+                return value;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererData::findProperty(const std::string& property)
+    {
+        for (RendererData* data = this; data; data = data->base.get())
+        {
+            const auto it = data->propertyValuePairs.find(property);
+            if (it != data->propertyValuePairs.end())
+                return &it->second;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererData& RendererData::getRoot()
+    {
+        RendererData* data = this;
+        while (data->base)
+            data = data->base.get();
+
+        return *data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, ObjectConverter> RendererData::getAllProperties() const
+    {
+        if (!base)
+            return propertyValuePairs.getMap();
+
+        auto properties = base->getAllProperties();
+        for (const auto& pair : propertyValuePairs)
+            properties[pair.first] = pair.second;
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<PropertyId> RendererData::getAllPropertyIds() const
+    {
+        std::vector<PropertyId> properties;
+        for (const RendererData* data = this; data; data = data->base.get())
+        {
+            for (const auto& pair : data->propertyValuePairs.getIndex())
+                properties.push_back(pair.first);
+        }
+
+        if (base)
+        {
+            std::sort(properties.begin(), properties.end());
+            properties.erase(std::unique(properties.begin(), properties.end()), properties.end());
+        }
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::beginUpdate()
+    {
+        ++updateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::endUpdate()
+    {
+        assert(updateDepth > 0);
+        if (--updateDepth > 0)
+            return;
+
+        if (changedProperties.empty())
+            return;
+
+        std::vector<PropertyId> properties;
+        properties.swap(changedProperties);
+
+        std::sort(properties.begin(), properties.end());
+        properties.erase(std::unique(properties.begin(), properties.end()), properties.end());
+
+        for (const auto& observer : observers)
+            observer.second(properties);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::propertyChanged(PropertyId property)
+    {
+        if (updateDepth > 0)
+            changedProperties.push_back(property);
+        else
+        {
+            const std::vector<PropertyId> properties{property};
+            for (const auto& observer : observers)
+                observer.second(properties);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_GET_NUMBER(WidgetRenderer, Opacity, 1)
 
     void WidgetRenderer::setOpacity(float opacity)
@@ -43,23 +206,23 @@ namespace tgui
         else if (opacity > 1)
             opacity = 1;
 
-        setProperty("opacity", ObjectConverter{opacity});
+        setProperty(Property::Opacity, ObjectConverter{opacity});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(Property::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        ObjectConverter* value = m_data->findProperty(Property::Font);
+        if (value)
+            return value->getFont();
         else
             return {};
     }
@@ -68,14 +231,18 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(priv::internPropertyName(toLower(property)), std::move(value));
+    }
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
-        {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+    void WidgetRenderer::setProperty(PropertyId id, ObjectConverter&& value)
+    {
+        ObjectConverter& currentValue = m_data->propertyValuePairs[id];
+        if (currentValue != value)
+        {
+            currentValue = std::move(value);
+            m_data->propertyChanged(id);
         }
     }
 
@@ -83,29 +250,49 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
-        if (it != m_data->propertyValuePairs.end())
-            return it->second;
+        ObjectConverter* value = m_data->findProperty(toLower(property));
+        if (value)
+            return *value;
         else
             return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    std::map<std::string, ObjectConverter> WidgetRenderer::getPropertyValuePairs() const
     {
-        return m_data->propertyValuePairs;
+        return m_data->getAllProperties();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(PropertyId property)>& function)
+    {
+        m_data->observers[id] = [function](const std::vector<PropertyId>& properties){
+                for (const auto property : properties)
+                    function(property);
+            };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::vector<PropertyId>& properties)>& function)
     {
         m_data->observers[id] = function;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    {
+        m_data->observers[id] = [function](const std::vector<PropertyId>& properties){
+                for (const auto property : properties)
+                    function(priv::getPropertyName(property));
+            };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::unsubscribe(const void* id)
     {
         m_data->observers.erase(id);
@@ -113,6 +300,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::beginUpdate()
+    {
+        m_data->beginUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::endUpdate()
+    {
+        m_data->endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::setData(const std::shared_ptr<RendererData>& data)
     {
         m_data = data;
@@ -129,8 +330,8 @@ namespace tgui
 
     std::shared_ptr<RendererData> WidgetRenderer::clone() const
     {
-        auto data = std::make_shared<RendererData>(*m_data);
-        data->observers = {};
+        auto data = RendererData::create(m_data->getAllProperties());
+        data->shared = m_data->shared;
         return data;
     }
 
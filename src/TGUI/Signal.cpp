@@ -28,6 +28,8 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,7 +60,19 @@ namespace tgui
 {
     namespace internal_signal
     {
-        std::deque<const void*> parameters;
+        std::shared_ptr<Widget> getWidget(Parameters parameters)
+        {
+            return dereference<Widget*>(parameters[0])->shared_from_this();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::~Signal()
+    {
+        // Let the handler loop know that it should stop accessing this signal
+        if (m_destroyedWhileEmitting)
+            *m_destroyedWhileEmitting = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,12 +85,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Signal::Signal(Signal&& other) :
+        m_name{std::move(other.m_name)}
+    {
+        takeHandlers(other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& Signal::operator=(const Signal& other)
     {
         if (this != &other)
         {
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -84,19 +106,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Signal& Signal::operator=(Signal&& other)
+    {
+        if (this != &other)
+        {
+            m_name = std::move(other.m_name);
+
+            // The old handlers can't be erased while they are being iterated, so they are disconnected instead
+            disconnectAll();
+            takeHandlers(other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::takeHandlers(Signal& other)
+    {
+        if (other.m_destroyedWhileEmitting)
+        {
+            // The other signal is still iterating over its handlers, so they are copied and disconnected there
+            for (const auto& handler : other.m_handlers)
+            {
+                if (handler.func)
+                    m_handlers.push_back(handler);
+            }
+
+            other.disconnectAll();
+        }
+        else if (m_handlers.empty())
+            m_handlers = std::move(other.m_handlers);
+        else
+        {
+            // New handlers are appended behind the ones that are waiting to be removed after emitting
+            m_handlers.insert(m_handlers.end(), std::make_move_iterator(other.m_handlers.begin()), std::make_move_iterator(other.m_handlers.end()));
+            other.m_handlers.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     unsigned int Signal::connect(const Delegate& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = handler;
-        return id;
+        return connectImpl([handler](internal_signal::Parameters){ handler(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::connect(const DelegateEx& handler)
+    {
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectImpl(DelegateImpl handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        m_handlers.push_back({id, std::make_shared<DelegateImpl>(std::move(handler))});
         return id;
     }
 
@@ -104,21 +172,101 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        const auto it = std::find_if(m_handlers.begin(), m_handlers.end(), [id](const Handler& handler){ return (handler.id == id) && handler.func; });
+        if (it == m_handlers.end())
+            return false;
+
+        // The handlers can't be erased while they are being iterated, they will be removed once the signal is done emitting
+        if (m_destroyedWhileEmitting)
+        {
+            it->func = nullptr;
+            m_handlersRemovedWhileEmitting = true;
+        }
+        else
+            m_handlers.erase(it);
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (m_destroyedWhileEmitting)
+        {
+            for (auto& handler : m_handlers)
+                handler.func = nullptr;
+
+            m_handlersRemovedWhileEmitting = true;
+        }
+        else
+            m_handlers.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Signal::getWidget()
+    void Signal::callHandlers(internal_signal::Parameters parameters)
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        // The handlers may destroy the widget (and this signal), so we need a way to find out about this after each call.
+        // The flag lives on the stack and the previous pointer is restored afterwards to support nested emits.
+        // The guard also restores the state when a handler throws, so that the signal remains usable afterwards.
+        class EmitGuard
+        {
+        public:
+            explicit EmitGuard(Signal& signal) :
+                m_signal           {signal},
+                m_outerDestroyedFlag{signal.m_destroyedWhileEmitting}
+            {
+                m_signal.m_destroyedWhileEmitting = &destroyed;
+            }
+
+            ~EmitGuard()
+            {
+                if (destroyed)
+                {
+                    // The signal no longer exists, only the outer emit calls need to be informed
+                    if (m_outerDestroyedFlag)
+                        *m_outerDestroyedFlag = true;
+                    return;
+                }
+
+                m_signal.m_destroyedWhileEmitting = m_outerDestroyedFlag;
+
+                // Remove the handlers that were disconnected while emitting once the outermost emit call finishes
+                if (!m_outerDestroyedFlag && m_signal.m_handlersRemovedWhileEmitting)
+                {
+                    auto& handlers = m_signal.m_handlers;
+                    handlers.erase(std::remove_if(handlers.begin(), handlers.end(), [](const Handler& handler){ return !handler.func; }), handlers.end());
+                    m_signal.m_handlersRemovedWhileEmitting = false;
+                }
+            }
+
+            EmitGuard(const EmitGuard&) = delete;
+            EmitGuard& operator=(const EmitGuard&) = delete;
+
+            bool destroyed = false;
+
+        private:
+            Signal& m_signal;
+            bool* const m_outerDestroyedFlag;
+        };
+
+        EmitGuard guard{*this};
+
+        // Handlers that are connected while emitting will only be called the next time the signal is emitted
+        const std::size_t handlerCount = m_handlers.size();
+        for (std::size_t i = 0; i < handlerCount; ++i)
+        {
+            // Copying the pointer keeps the function alive even if it gets disconnected during the call
+            const auto handler = m_handlers[i].func;
+            if (!handler)
+                continue;
+
+            (*handler)(parameters);
+
+            if (guard.destroyed)
+                return;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,16 +285,12 @@ namespace tgui
     #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<Type>(parameters[1])); }); \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<Type>(parameters[1])); }); \
     }
 
     TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
@@ -221,30 +365,21 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
-            return false;
-
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+        return emitImpl(widget, start, end);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,18 +396,14 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -283,8 +414,7 @@ namespace tgui
             return false;
 
         ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
-        internal_signal::parameters[1] = static_cast<const void*>(&sharedPtr);
-        return Signal::emit(childWindow);
+        return emitImpl(childWindow, sharedPtr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,36 +431,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,36 +475,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalMenuItem::connect(const DelegateMenuItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFull& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler](internal_signal::Parameters parameters){ handler(internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFullEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return connectImpl([handler, name=m_name](internal_signal::Parameters parameters){ handler(internal_signal::getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,860 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/TextureManager.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <unordered_map>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_SOFTWARE_RENDER_TARGET_SSE2
+    #include <emmintrin.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Area of pixels, the right and bottom are exclusive
+        struct PixelRect
+        {
+            int left;
+            int top;
+            int right;
+            int bottom;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        PixelRect intersect(const PixelRect& rect1, const PixelRect& rect2)
+        {
+            return {std::max(rect1.left, rect2.left), std::max(rect1.top, rect2.top),
+                    std::min(rect1.right, rect2.right), std::min(rect1.bottom, rect2.bottom)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Rounds a coordinate down to a pixel index, without overflowing when the coordinate lies far outside the target.
+        // This is a lot faster than std::floor, which isn't inlined without SSE4.1.
+        int floorToPixel(float value)
+        {
+            value = std::max(-1000000.f, std::min(value, 1000000.f));
+            const int truncated = static_cast<int>(value);
+            return (value < truncated) ? truncated - 1 : truncated;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Rounds a coordinate up to a pixel index, without overflowing when the coordinate lies far outside the target
+        int ceilToPixel(float value)
+        {
+            value = std::max(-1000000.f, std::min(value, 1000000.f));
+            const int truncated = static_cast<int>(value);
+            return (value > truncated) ? truncated + 1 : truncated;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Divides a value by 255 with rounding. The value has to be smaller than 65536 - 128, which products of two bytes are.
+        inline unsigned int divideBy255(unsigned int value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends a color on top of a pixel in the same way as sf::BlendAlpha
+        inline void blendPixel(std::uint8_t* pixel, unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha)
+        {
+            const unsigned int inverseAlpha = 255 - alpha;
+            pixel[0] = static_cast<std::uint8_t>(divideBy255(red * alpha + pixel[0] * inverseAlpha));
+            pixel[1] = static_cast<std::uint8_t>(divideBy255(green * alpha + pixel[1] * inverseAlpha));
+            pixel[2] = static_cast<std::uint8_t>(divideBy255(blue * alpha + pixel[2] * inverseAlpha));
+            pixel[3] = static_cast<std::uint8_t>(divideBy255(255 * alpha + pixel[3] * inverseAlpha));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends the same color on top of a row of pixels
+        void blendSpan(std::uint8_t* pixels, int count, const sf::Color& color)
+        {
+            if (color.a == 0)
+                return;
+
+            if (color.a == 255)
+            {
+                const std::uint8_t rgba[4] = {color.r, color.g, color.b, 255};
+                for (int i = 0; i < count; ++i)
+                    std::memcpy(pixels + 4 * i, rgba, 4);
+                return;
+            }
+
+        #ifdef TGUI_SOFTWARE_RENDER_TARGET_SSE2
+            // Four pixels are blended at once with the same formula as blendPixel, the results are identical
+            const short alpha = color.a;
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i inverseAlpha = _mm_set1_epi16(static_cast<short>(255 - alpha));
+            const __m128i source = _mm_set_epi16(static_cast<short>(255 * alpha + 128), static_cast<short>(color.b * alpha + 128),
+                                                 static_cast<short>(color.g * alpha + 128), static_cast<short>(color.r * alpha + 128),
+                                                 static_cast<short>(255 * alpha + 128), static_cast<short>(color.b * alpha + 128),
+                                                 static_cast<short>(color.g * alpha + 128), static_cast<short>(color.r * alpha + 128));
+            for (; count >= 4; count -= 4, pixels += 16)
+            {
+                const __m128i destination = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+                __m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(destination, zero), inverseAlpha), source);
+                __m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(destination, zero), inverseAlpha), source);
+                low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+                high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), _mm_packus_epi16(low, high));
+            }
+        #endif
+
+            for (int i = 0; i < count; ++i)
+                blendPixel(pixels + 4 * i, color.r, color.g, color.b, color.a);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Pixels of a texture, which are either borrowed from the image that tgui keeps in memory or copied from the texture
+        struct TextureSource
+        {
+            const std::uint8_t* pixels = nullptr; // Nullptr when the pixels are unavailable, the texture is then treated as white
+            int stride = 0; // Width of the image in pixels
+            int offsetX = 0; // Position of the texture inside the image
+            int offsetY = 0;
+            int width = 0;
+            int height = 0;
+            bool smooth = false;
+            bool repeated = false;
+            sf::Image copiedImage;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Looks up the pixels of every texture only once per draw call
+        class TextureCache
+        {
+        public:
+
+            // Makes the texture use the pixels of an image that was already copied from it
+            void addCopiedImage(const sf::Texture& texture, const sf::Image& image)
+            {
+                TextureSource& source = m_sources[&texture];
+                initSource(source, texture, image);
+            }
+
+            const TextureSource& get(const sf::Texture& texture)
+            {
+                const auto it = m_sources.find(&texture);
+                if (it != m_sources.end())
+                    return it->second;
+
+                TextureSource& source = m_sources[&texture];
+                const auto data = TextureManager::findTextureData(texture);
+                if (data && data->image)
+                {
+                    source.offsetX = std::max(0, data->rect.left);
+                    source.offsetY = std::max(0, data->rect.top);
+                    initSource(source, texture, *data->image);
+                }
+                else
+                {
+                    source.copiedImage = texture.copyToImage();
+                    initSource(source, texture, source.copiedImage);
+                }
+
+                return source;
+            }
+
+        private:
+
+            static void initSource(TextureSource& source, const sf::Texture& texture, const sf::Image& image)
+            {
+                source.smooth = texture.isSmooth();
+                source.repeated = texture.isRepeated();
+
+                const sf::Vector2u imageSize = image.getSize();
+                source.stride = static_cast<int>(imageSize.x);
+                source.width = std::min(static_cast<int>(texture.getSize().x), source.stride - source.offsetX);
+                source.height = std::min(static_cast<int>(texture.getSize().y), static_cast<int>(imageSize.y) - source.offsetY);
+                if ((source.width > 0) && (source.height > 0))
+                    source.pixels = image.getPixelsPtr();
+            }
+
+        private:
+
+            std::unordered_map<const sf::Texture*, TextureSource> m_sources;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Color with floating point channels between 0 and 255, used to interpolate between vertices
+        struct ColorF
+        {
+            float r;
+            float g;
+            float b;
+            float a;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        int wrapTexel(int value, int size, bool repeated)
+        {
+            if (repeated)
+            {
+                value %= size;
+                return (value < 0) ? value + size : value;
+            }
+            else
+                return std::max(0, std::min(value, size - 1));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ColorF getTexel(const TextureSource& texture, int x, int y)
+        {
+            x = wrapTexel(x, texture.width, texture.repeated);
+            y = wrapTexel(y, texture.height, texture.repeated);
+
+            const std::uint8_t* texel = texture.pixels + 4 * ((y + texture.offsetY) * texture.stride + x + texture.offsetX);
+            return {static_cast<float>(texel[0]), static_cast<float>(texel[1]), static_cast<float>(texel[2]), static_cast<float>(texel[3])};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the color of the texture at a position in pixels, with linear filtering when the texture is smooth
+        ColorF sampleTexture(const TextureSource& texture, float u, float v)
+        {
+            if (!texture.pixels)
+                return {255, 255, 255, 255};
+
+            if (!texture.smooth)
+                return getTexel(texture, floorToPixel(u), floorToPixel(v));
+
+            u -= 0.5f;
+            v -= 0.5f;
+            const float left = std::floor(u);
+            const float top = std::floor(v);
+            const float ratioX = u - left;
+            const float ratioY = v - top;
+            const int x = static_cast<int>(left);
+            const int y = static_cast<int>(top);
+
+            const ColorF topLeft = getTexel(texture, x, y);
+            const ColorF topRight = getTexel(texture, x + 1, y);
+            const ColorF bottomLeft = getTexel(texture, x, y + 1);
+            const ColorF bottomRight = getTexel(texture, x + 1, y + 1);
+
+            const auto interpolate = [=](float tl, float tr, float bl, float br) {
+                return (tl + (tr - tl) * ratioX) * (1 - ratioY) + (bl + (br - bl) * ratioX) * ratioY;
+            };
+
+            return {interpolate(topLeft.r, topRight.r, bottomLeft.r, bottomRight.r),
+                    interpolate(topLeft.g, topRight.g, bottomLeft.g, bottomRight.g),
+                    interpolate(topLeft.b, topRight.b, bottomLeft.b, bottomRight.b),
+                    interpolate(topLeft.a, topRight.a, bottomLeft.a, bottomRight.a)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Vertex of which the position has already been transformed to pixels
+        struct PixelVertex
+        {
+            sf::Vector2f position;
+            sf::Color color;
+            sf::Vector2f texCoords;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Edge of a triangle, the value a*x + b*y + c is positive inside the triangle
+        struct Edge
+        {
+            Edge(const sf::Vector2f& from, const sf::Vector2f& to) :
+                a{from.y - to.y},
+                b{to.x - from.x},
+                c{from.x * to.y - to.x * from.y},
+                // Pixels that lie exactly on an edge shared by two triangles are only drawn by one of them, because the
+                // coefficients of the other triangle have the opposite sign. Otherwise transparent quads would show their diagonal.
+                inclusive{(a > 0) || ((a == 0) && (b > 0))}
+            {
+            }
+
+            float a;
+            float b;
+            float c;
+            bool inclusive;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        class Rasterizer
+        {
+        public:
+
+            Rasterizer(std::uint8_t* pixels, unsigned int width) :
+                m_pixels{pixels},
+                m_width {static_cast<int>(width)}
+            {
+            }
+
+            void setClipRect(const PixelRect& clipRect)
+            {
+                m_clipRect = clipRect;
+            }
+
+            const PixelRect& getClipRect() const
+            {
+                return m_clipRect;
+            }
+
+            // Fills the pixels with their centers inside the triangle, like OpenGL does
+            void drawTriangle(PixelVertex v0, PixelVertex v1, PixelVertex v2, const TextureSource* texture)
+            {
+                float area = (v1.position.x - v0.position.x) * (v2.position.y - v0.position.y)
+                           - (v1.position.y - v0.position.y) * (v2.position.x - v0.position.x);
+                if (!(area != 0)) // Also skips the triangle when the area is NaN
+                    return;
+
+                if (area < 0)
+                {
+                    std::swap(v1, v2);
+                    area = -area;
+                }
+
+                const PixelRect bounds = intersect(m_clipRect, {
+                    floorToPixel(std::min({v0.position.x, v1.position.x, v2.position.x})),
+                    floorToPixel(std::min({v0.position.y, v1.position.y, v2.position.y})),
+                    ceilToPixel(std::max({v0.position.x, v1.position.x, v2.position.x})),
+                    ceilToPixel(std::max({v0.position.y, v1.position.y, v2.position.y}))});
+                if ((bounds.left >= bounds.right) || (bounds.top >= bounds.bottom))
+                    return;
+
+                // The value of the edge opposite of a vertex, divided by the area, is the weight of that vertex
+                const Edge edges[3] = {{v1.position, v2.position}, {v2.position, v0.position}, {v0.position, v1.position}};
+                const bool solidColor = !texture && (v0.color == v1.color) && (v0.color == v2.color);
+
+                for (int y = bounds.top; y < bounds.bottom; ++y)
+                {
+                    const float centerY = y + 0.5f;
+
+                    // Find the pixels in this row of which the center lies inside all edges
+                    int left = bounds.left;
+                    int right = bounds.right;
+                    float rowValues[3];
+                    for (unsigned int i = 0; i < 3; ++i)
+                    {
+                        const Edge& edge = edges[i];
+                        rowValues[i] = edge.b * centerY + edge.c;
+                        if (edge.a == 0)
+                        {
+                            if ((rowValues[i] < 0) || ((rowValues[i] == 0) && !edge.inclusive))
+                                right = left;
+                            continue;
+                        }
+
+                        // Position at which the center of a pixel would lie exactly on the edge
+                        const float crossing = -rowValues[i] / edge.a - 0.5f;
+                        if (edge.a > 0)
+                            left = std::max(left, edge.inclusive ? ceilToPixel(crossing) : floorToPixel(crossing) + 1);
+                        else
+                            right = std::min(right, edge.inclusive ? floorToPixel(crossing) + 1 : ceilToPixel(crossing));
+                    }
+
+                    if (left >= right)
+                        continue;
+
+                    std::uint8_t* pixel = m_pixels + 4 * (y * m_width + left);
+                    if (solidColor)
+                    {
+                        blendSpan(pixel, right - left, v0.color);
+                        continue;
+                    }
+
+                    const float centerX = left + 0.5f;
+                    float weights[3];
+                    float steps[3];
+                    for (unsigned int i = 0; i < 3; ++i)
+                    {
+                        weights[i] = (edges[i].a * centerX + rowValues[i]) / area;
+                        steps[i] = edges[i].a / area;
+                    }
+
+                    for (int x = left; x < right; ++x, pixel += 4)
+                    {
+                        // The weights are clamped because they can become slightly negative due to rounding errors
+                        const float w0 = std::max(0.f, weights[0]);
+                        const float w1 = std::max(0.f, weights[1]);
+                        const float w2 = std::max(0.f, weights[2]);
+                        for (unsigned int i = 0; i < 3; ++i)
+                            weights[i] += steps[i];
+
+                        ColorF color = {v0.color.r * w0 + v1.color.r * w1 + v2.color.r * w2,
+                                        v0.color.g * w0 + v1.color.g * w1 + v2.color.g * w2,
+                                        v0.color.b * w0 + v1.color.b * w1 + v2.color.b * w2,
+                                        v0.color.a * w0 + v1.color.a * w1 + v2.color.a * w2};
+
+                        if (texture)
+                        {
+                            const ColorF texel = sampleTexture(*texture,
+                                                               v0.texCoords.x * w0 + v1.texCoords.x * w1 + v2.texCoords.x * w2,
+                                                               v0.texCoords.y * w0 + v1.texCoords.y * w1 + v2.texCoords.y * w2);
+                            color = {color.r * texel.r / 255, color.g * texel.g / 255, color.b * texel.b / 255, color.a * texel.a / 255};
+                        }
+
+                        const unsigned int alpha = toByte(color.a);
+                        if (alpha > 0)
+                            blendPixel(pixel, toByte(color.r), toByte(color.g), toByte(color.b), alpha);
+                    }
+                }
+            }
+
+        private:
+
+            static unsigned int toByte(float value)
+            {
+                return static_cast<unsigned int>(std::max(0.f, std::min(value + 0.5f, 255.f)));
+            }
+
+        private:
+
+            std::uint8_t* m_pixels;
+            int m_width;
+            PixelRect m_clipRect = {0, 0, 0, 0};
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Quad of a glyph or line in a text, the corners are in the order top left, top right, bottom left and bottom right
+        struct TextQuad
+        {
+            sf::Vector2f positions[4];
+            sf::Vector2f texCoords[4];
+            sf::Color color;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Calls the function for every quad of either the outline or the inside of a text, with the same geometry as sfml uses
+        template <typename Func>
+        void forEachTextQuad(const sf::Text& text, bool outline, Func&& func)
+        {
+            const sf::Font* font = text.getFont();
+            if (!font || text.getString().isEmpty())
+                return;
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            const float outlineThickness = outline ? text.getOutlineThickness() : 0;
+            const sf::Color color = outline ? text.getOutlineColor() : text.getFillColor();
+        #else
+            const float outlineThickness = 0;
+            const sf::Color color = text.getColor();
+        #endif
+            if (outline && (outlineThickness == 0))
+                return;
+
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            const float letterSpacingFactor = text.getLetterSpacing();
+            const float lineSpacingFactor = text.getLineSpacing();
+            const float padding = 1;
+        #else
+            const float letterSpacingFactor = 1;
+            const float lineSpacingFactor = 1;
+            const float padding = 0;
+        #endif
+
+            const unsigned int characterSize = text.getCharacterSize();
+            const bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+            const bool underlined = (text.getStyle() & sf::Text::Underlined) != 0;
+            const bool strikeThrough = (text.getStyle() & sf::Text::StrikeThrough) != 0;
+            const float italicShear = (text.getStyle() & sf::Text::Italic) ? 0.209f : 0.f;
+
+            const float underlineOffset = font->getUnderlinePosition(characterSize);
+            const float underlineThickness = font->getUnderlineThickness(characterSize);
+            const sf::FloatRect xBounds = font->getGlyph(U'x', characterSize, bold).bounds;
+            const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+            float whitespaceWidth = font->getGlyph(U' ', characterSize, bold).advance;
+            const float letterSpacing = (whitespaceWidth / 3.f) * (letterSpacingFactor - 1.f);
+            whitespaceWidth += letterSpacing;
+            const float lineSpacing = font->getLineSpacing(characterSize) * lineSpacingFactor;
+
+            // Lines use the white pixels in the top left corner of the font texture
+            const auto addLine = [&](float lineLength, float lineTop, float offset) {
+                const float top = std::floor(lineTop + offset - (underlineThickness / 2) + 0.5f) - outlineThickness;
+                const float bottom = top + std::floor(underlineThickness + 0.5f) + 2 * outlineThickness;
+                const float left = -outlineThickness;
+                const float right = lineLength + outlineThickness;
+                func(TextQuad{{{left, top}, {right, top}, {left, bottom}, {right, bottom}}, {{1, 1}, {1, 1}, {1, 1}, {1, 1}}, color});
+            };
+
+            const auto addLines = [&](float x, float y) {
+                if (underlined)
+                    addLine(x, y, underlineOffset);
+                if (strikeThrough)
+                    addLine(x, y, strikeThroughOffset);
+            };
+
+            const sf::String& string = text.getString();
+            float x = 0;
+            float y = static_cast<float>(characterSize);
+            std::uint32_t prevChar = 0;
+            for (std::size_t i = 0; i < string.getSize(); ++i)
+            {
+                const std::uint32_t curChar = string[i];
+                if (curChar == U'\r')
+                    continue;
+
+                x += font->getKerning(prevChar, curChar, characterSize);
+
+                if ((curChar == U'\n') && (prevChar != U'\n'))
+                    addLines(x, y);
+
+                prevChar = curChar;
+
+                if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+                {
+                    if (curChar == U' ')
+                        x += whitespaceWidth;
+                    else if (curChar == U'\t')
+                        x += whitespaceWidth * 4;
+                    else
+                    {
+                        y += lineSpacing;
+                        x = 0;
+                    }
+
+                    continue;
+                }
+
+            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold, outlineThickness);
+            #else
+                const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+            #endif
+
+                const float left = glyph.bounds.left - padding;
+                const float top = glyph.bounds.top - padding;
+                const float right = glyph.bounds.left + glyph.bounds.width + padding;
+                const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+                const float u1 = glyph.textureRect.left - padding;
+                const float v1 = glyph.textureRect.top - padding;
+                const float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
+                const float v2 = glyph.textureRect.top + glyph.textureRect.height + padding;
+
+                func(TextQuad{{{x + left - italicShear * top, y + top}, {x + right - italicShear * top, y + top},
+                               {x + left - italicShear * bottom, y + bottom}, {x + right - italicShear * bottom, y + bottom}},
+                              {{u1, v1}, {u2, v1}, {u1, v2}, {u2, v2}},
+                              color});
+
+                // The advance is taken from the glyph without outline
+                if (outline)
+                    x += font->getGlyph(curChar, characterSize, bold).advance + letterSpacing;
+                else
+                    x += glyph.advance + letterSpacing;
+            }
+
+            if (x > 0)
+                addLines(x, y);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderTarget::SoftwareRenderTarget(unsigned int width, unsigned int height) :
+        m_size  {width, height},
+        m_pixels(static_cast<std::size_t>(width) * height * 4, 0),
+        m_view  {sf::FloatRect{0, 0, static_cast<float>(width), static_cast<float>(height)}}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u SoftwareRenderTarget::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::setView(const sf::View& view)
+    {
+        m_view = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::View& SoftwareRenderTarget::getView() const
+    {
+        return m_view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::clear(const Color& color)
+    {
+        if (m_pixels.empty())
+            return;
+
+        // Fill the first row and copy it to the other rows
+        const std::uint8_t rgba[4] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        const std::size_t rowSize = 4 * static_cast<std::size_t>(m_size.x);
+        for (std::size_t i = 0; i < rowSize; i += 4)
+            std::memcpy(&m_pixels[i], rgba, 4);
+        for (std::size_t i = rowSize; i < m_pixels.size(); i += rowSize)
+            std::memcpy(&m_pixels[i], &m_pixels[0], rowSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::draw(const RenderCommandList& commands)
+    {
+        drawWithView(commands, m_view);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::draw(Gui& gui)
+    {
+        gui.draw(m_guiCommands);
+        drawWithView(m_guiCommands, gui.getView());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Color SoftwareRenderTarget::getPixel(unsigned int x, unsigned int y) const
+    {
+        assert((x < m_size.x) && (y < m_size.y));
+
+        const std::uint8_t* pixel = &m_pixels[4 * (static_cast<std::size_t>(y) * m_size.x + x)];
+        return {pixel[0], pixel[1], pixel[2], pixel[3]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* SoftwareRenderTarget::getPixelsPtr() const
+    {
+        return m_pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Image SoftwareRenderTarget::copyToImage() const
+    {
+        sf::Image image;
+        image.create(m_size.x, m_size.y, m_pixels.data());
+        return image;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::saveToFile(const std::string& filename) const
+    {
+        if (!copyToImage().saveToFile(filename))
+            throw Exception{"Failed to save the software render target to '" + filename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::updateFontPages(const RenderCommandList& commands)
+    {
+        // Load the glyphs of all texts before copying any font texture, as loading glyphs may change the texture.
+        // A glyph never moves on the texture once it was added, so only a texture that got new glyphs or was resized has
+        // to be copied again.
+        std::unordered_map<const sf::Texture*, std::vector<std::uint64_t>> newGlyphs;
+        for (std::size_t i = 0; i < commands.getTextCount(); ++i)
+        {
+            const sf::Text& text = commands.getText(i);
+            if (!text.getFont())
+                continue;
+
+            const sf::Texture* texture = &text.getFont()->getTexture(text.getCharacterSize());
+            const auto pageIt = m_fontPages.find(texture);
+            std::vector<std::uint64_t>& glyphs = newGlyphs[texture];
+            const auto addGlyph = [&](const TextQuad& quad) {
+                const std::uint64_t position = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(quad.texCoords[0].x)) << 32)
+                                             | static_cast<std::uint32_t>(quad.texCoords[0].y);
+                if ((pageIt == m_fontPages.end()) || (pageIt->second.glyphs.count(position) == 0))
+                    glyphs.push_back(position);
+            };
+
+            forEachTextQuad(text, true, addGlyph);
+            forEachTextQuad(text, false, addGlyph);
+        }
+
+        // Textures that weren't needed in this draw call are forgotten, their font may no longer exist
+        for (auto it = m_fontPages.begin(); it != m_fontPages.end();)
+        {
+            if (newGlyphs.find(it->first) == newGlyphs.end())
+                it = m_fontPages.erase(it);
+            else
+                ++it;
+        }
+
+        for (const auto& pair : newGlyphs)
+        {
+            FontPage& page = m_fontPages[pair.first];
+            if (pair.second.empty() && (page.textureSize == pair.first->getSize()))
+                continue;
+
+            page.textureSize = pair.first->getSize();
+            page.glyphs.insert(pair.second.begin(), pair.second.end());
+            page.image = pair.first->copyToImage();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawWithView(const RenderCommandList& commands, const sf::View& view)
+    {
+        // The viewport is rounded to whole pixels in the same way as sfml does
+        const sf::FloatRect& viewport = view.getViewport();
+        const int viewportLeft = static_cast<int>(0.5f + m_size.x * viewport.left);
+        const int viewportTop = static_cast<int>(0.5f + m_size.y * viewport.top);
+        const int viewportWidth = static_cast<int>(0.5f + m_size.x * viewport.width);
+        const int viewportHeight = static_cast<int>(0.5f + m_size.y * viewport.height);
+
+        // Transform that maps coordinates in the view to pixels, by mapping the normalized device coordinates to the viewport
+        sf::Transform viewTransform{viewportWidth / 2.f, 0, viewportLeft + viewportWidth / 2.f,
+                                    0, -viewportHeight / 2.f, viewportTop + viewportHeight / 2.f,
+                                    0, 0, 1};
+        viewTransform *= view.getTransform();
+
+        Rasterizer rasterizer{m_pixels.data(), m_size.x};
+        rasterizer.setClipRect(intersect({0, 0, static_cast<int>(m_size.x), static_cast<int>(m_size.y)},
+                                         {viewportLeft, viewportTop, viewportLeft + viewportWidth, viewportTop + viewportHeight}));
+
+        updateFontPages(commands);
+
+        TextureCache textureCache;
+        for (const auto& pair : m_fontPages)
+            textureCache.addCopiedImage(*pair.first, pair.second.image);
+
+        std::vector<PixelRect> clipRects;
+        const std::vector<sf::Vertex>& vertices = commands.getVertices();
+        for (const auto& command : commands.getCommands())
+        {
+            const sf::Transform transform = viewTransform * command.states.transform;
+            switch (command.type)
+            {
+                case RenderCommand::Type::Vertices:
+                {
+                    const TextureSource* texture = command.states.texture ? &textureCache.get(*command.states.texture) : nullptr;
+                    const auto toPixels = [&](std::size_t index) {
+                        const sf::Vertex& vertex = vertices[command.first + index];
+                        return PixelVertex{transform.transformPoint(vertex.position), vertex.color, vertex.texCoords};
+                    };
+
+                    // Points and lines are not rasterized, widgets only draw triangles
+                    switch (command.primitiveType)
+                    {
+                        case sf::PrimitiveType::Triangles:
+                            for (std::size_t i = 0; i + 2 < command.count; i += 3)
+                                rasterizer.drawTriangle(toPixels(i), toPixels(i + 1), toPixels(i + 2), texture);
+                            break;
+                        case sf::PrimitiveType::TriangleStrip:
+                            for (std::size_t i = 2; i < command.count; ++i)
+                                rasterizer.drawTriangle(toPixels(i - 2), toPixels(i - 1), toPixels(i), texture);
+                            break;
+                        case sf::PrimitiveType::TriangleFan:
+                            for (std::size_t i = 2; i < command.count; ++i)
+                                rasterizer.drawTriangle(toPixels(0), toPixels(i - 1), toPixels(i), texture);
+                            break;
+                        case sf::PrimitiveType::Quads:
+                            for (std::size_t i = 0; i + 3 < command.count; i += 4)
+                            {
+                                rasterizer.drawTriangle(toPixels(i), toPixels(i + 1), toPixels(i + 2), texture);
+                                rasterizer.drawTriangle(toPixels(i), toPixels(i + 2), toPixels(i + 3), texture);
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                }
+                case RenderCommand::Type::Text:
+                {
+                    const sf::Text& text = commands.getText(command.first);
+                    if (!text.getFont())
+                        break;
+
+                    const sf::Transform textTransform = transform * text.getTransform();
+                    const TextureSource& texture = textureCache.get(text.getFont()->getTexture(text.getCharacterSize()));
+                    const auto drawQuad = [&](const TextQuad& quad) {
+                        PixelVertex corners[4];
+                        for (unsigned int i = 0; i < 4; ++i)
+                            corners[i] = {textTransform.transformPoint(quad.positions[i]), quad.color, quad.texCoords[i]};
+
+                        rasterizer.drawTriangle(corners[0], corners[1], corners[2], &texture);
+                        rasterizer.drawTriangle(corners[2], corners[1], corners[3], &texture);
+                    };
+
+                    // Like in sfml, the outline is drawn below the inside of the text
+                    forEachTextQuad(text, true, drawQuad);
+                    forEachTextQuad(text, false, drawQuad);
+                    break;
+                }
+                case RenderCommand::Type::PushClip:
+                {
+                    const sf::FloatRect area = transform.transformRect({command.clipRect.left, command.clipRect.top,
+                                                                        command.clipRect.width, command.clipRect.height});
+                    const int left = static_cast<int>(std::floor(area.left + 0.5f));
+                    const int top = static_cast<int>(std::floor(area.top + 0.5f));
+                    const PixelRect clipRect{left, top,
+                                             left + static_cast<int>(std::floor(area.width + 0.5f)),
+                                             top + static_cast<int>(std::floor(area.height + 0.5f))};
+
+                    clipRects.push_back(rasterizer.getClipRect());
+                    rasterizer.setClipRect(intersect(rasterizer.getClipRect(), clipRect));
+                    break;
+                }
+                case RenderCommand::Type::PopClip:
+                {
+                    rasterizer.setClipRect(clipRects.back());
+                    clipRects.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/SpatialIndex.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Widgets that cover more cells than this are not stored in the grid
+            const std::int64_t maxCellsPerItem = 64;
+
+            std::int32_t toCell(float coordinate, float cellSize)
+            {
+                const float cell = std::floor(coordinate / cellSize);
+                if (!(cell > -1e9f)) // Also catches NaN
+                    return -1000000000;
+                else if (cell > 1e9f)
+                    return 1000000000;
+                else
+                    return static_cast<std::int32_t>(cell);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SpatialIndex::SpatialIndex(float cellSize) :
+            m_cellSize{cellSize > 0 ? cellSize : 1}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float SpatialIndex::getCellSize() const
+        {
+            return m_cellSize;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::clear()
+        {
+            m_cells.clear();
+            m_items.clear();
+            m_largeItems.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::insert(const Widget* widget, std::size_t order, FloatRect bounds)
+        {
+            const auto it = m_items.find(widget);
+            if (it != m_items.end())
+            {
+                it->second.order = order;
+                update(widget, bounds);
+                return;
+            }
+
+            const CellRange cells = getCellRange(bounds);
+            const Item item{order, bounds, cells, isLarge(cells)};
+            m_items.emplace(widget, item);
+            addToCells(widget, item);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::update(const Widget* widget, FloatRect bounds)
+        {
+            const auto it = m_items.find(widget);
+            if (it == m_items.end())
+                return;
+
+            Item& item = it->second;
+            item.bounds = bounds;
+
+            // Only touch the grid when the widget moved to other cells
+            const CellRange cells = getCellRange(bounds);
+            if ((cells.left == item.cells.left) && (cells.top == item.cells.top)
+             && (cells.right == item.cells.right) && (cells.bottom == item.cells.bottom))
+                return;
+
+            removeFromCells(widget, item);
+            item.cells = cells;
+            item.large = isLarge(cells);
+            addToCells(widget, item);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<std::size_t>& SpatialIndex::query(Vector2f point)
+        {
+            m_queryResult.clear();
+
+            const auto addCandidates = [this,point](const std::vector<const Widget*>& widgets)
+                {
+                    for (const Widget* widget : widgets)
+                    {
+                        const Item& item = m_items.find(widget)->second;
+                        if ((point.x >= item.bounds.left) && (point.x <= item.bounds.left + item.bounds.width)
+                         && (point.y >= item.bounds.top) && (point.y <= item.bounds.top + item.bounds.height))
+                        {
+                            m_queryResult.push_back(item.order);
+                        }
+                    }
+                };
+
+            const auto cellIt = m_cells.find(getCellKey(toCell(point.x, m_cellSize), toCell(point.y, m_cellSize)));
+            if (cellIt != m_cells.end())
+                addCandidates(cellIt->second);
+
+            addCandidates(m_largeItems);
+
+            std::sort(m_queryResult.begin(), m_queryResult.end(), [](std::size_t left, std::size_t right){ return left > right; });
+            return m_queryResult;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t SpatialIndex::size() const
+        {
+            return m_items.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SpatialIndex::CellRange SpatialIndex::getCellRange(FloatRect bounds) const
+        {
+            const float right = bounds.left + bounds.width;
+            const float bottom = bounds.top + bounds.height;
+            return {toCell(std::min(bounds.left, right), m_cellSize), toCell(std::min(bounds.top, bottom), m_cellSize),
+                    toCell(std::max(bounds.left, right), m_cellSize), toCell(std::max(bounds.top, bottom), m_cellSize)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool SpatialIndex::isLarge(const CellRange& cells) const
+        {
+            const std::int64_t columns = static_cast<std::int64_t>(cells.right) - cells.left + 1;
+            const std::int64_t rows = static_cast<std::int64_t>(cells.bottom) - cells.top + 1;
+            return columns * rows > maxCellsPerItem;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::addToCells(const Widget* widget, const Item& item)
+        {
+            if (item.large)
+            {
+                m_largeItems.push_back(widget);
+                return;
+            }
+
+            for (std::int32_t y = item.cells.top; y <= item.cells.bottom; ++y)
+            {
+                for (std::int32_t x = item.cells.left; x <= item.cells.right; ++x)
+                    m_cells[getCellKey(x, y)].push_back(widget);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::removeFromCells(const Widget* widget, const Item& item)
+        {
+            if (item.large)
+            {
+                m_largeItems.erase(std::find(m_largeItems.begin(), m_largeItems.end(), widget));
+                return;
+            }
+
+            for (std::int32_t y = item.cells.top; y <= item.cells.bottom; ++y)
+            {
+                for (std::int32_t x = item.cells.left; x <= item.cells.right; ++x)
+                {
+                    const auto cellIt = m_cells.find(getCellKey(x, y));
+                    auto& widgets = cellIt->second;
+                    widgets.erase(std::find(widgets.begin(), widgets.end(), widget));
+                    if (widgets.empty())
+                        m_cells.erase(cellIt);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t SpatialIndex::getCellKey(std::int32_t x, std::int32_t y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderCommandList.hpp>
 
 #include <cassert>
 
@@ -37,9 +38,18 @@
 
 namespace tgui
 {
+    Sprite::Sprite()
+    {
+        // All sprites start out sharing the same empty data, it only gets copied once the sprite is changed
+        static const std::shared_ptr<Data> emptyData = std::make_shared<Data>();
+        m_data = emptyData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::setTexture(const Texture& texture)
     {
-        m_texture = texture;
+        modifyData().texture = texture;
 
         if (isSet())
         {
@@ -54,29 +64,32 @@ namespace tgui
 
     const Texture& Sprite::getTexture() const
     {
-        return m_texture;
+        return m_data->texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Texture& Sprite::getTexture()
     {
-        return m_texture;
+        return modifyData().texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Sprite::isSet() const
     {
-        return m_texture.getData() != nullptr;
+        return m_data->texture.getData() != nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::setSize(const Vector2f& size)
     {
-        m_size.x = std::max(size.x, 0.f);
-        m_size.y = std::max(size.y, 0.f);
+        const Vector2f newSize{std::max(size.x, 0.f), std::max(size.y, 0.f)};
+        if (newSize == m_data->size)
+            return;
+
+        modifyData().size = newSize;
 
         if (isSet())
             updateVertices();
@@ -86,17 +99,18 @@ namespace tgui
 
     Vector2f Sprite::getSize() const
     {
-        return m_size;
+        return m_data->size;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::setColor(const Color& color)
     {
-        m_vertexColor = color;
+        Data& data = modifyData();
+        data.vertexColor = color;
 
-        const sf::Color vertexColor = Color::calcColorOpacity(m_vertexColor, m_opacity);
-        for (auto& vertex : m_vertices)
+        const sf::Color vertexColor = Color::calcColorOpacity(data.vertexColor, data.opacity);
+        for (auto& vertex : data.vertices)
             vertex.color = vertexColor;
     }
 
@@ -104,14 +118,17 @@ namespace tgui
 
     const Color& Sprite::getColor() const
     {
-        return m_vertexColor;
+        return m_data->vertexColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::setOpacity(float opacity)
     {
-        m_opacity = opacity;
+        if (opacity == m_data->opacity)
+            return;
+
+        modifyData().opacity = opacity;
         setColor(getColor());
     }
 
@@ -119,28 +136,29 @@ namespace tgui
 
     float Sprite::getOpacity() const
     {
-        return m_opacity;
+        return m_data->opacity;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::setVisibleRect(const FloatRect& visibleRect)
     {
-        m_visibleRect = visibleRect;
+        if (visibleRect != m_data->visibleRect)
+            modifyData().visibleRect = visibleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     FloatRect Sprite::getVisibleRect() const
     {
-        return m_visibleRect;
+        return m_data->visibleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || !m_data->texture.getData()->image || (m_data->size.x == 0) || (m_data->size.y == 0))
             return true;
 
         if (getRotation() != 0)
@@ -169,75 +187,75 @@ namespace tgui
 
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
-        sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
-        switch (m_scalingType)
+        sf::IntRect middleRect = m_data->texture.getMiddleRect();
+        const sf::Texture& texture = m_data->texture.getData()->texture;
+        switch (m_data->scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_data->size.x * texture.getSize().x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_data->size.y * texture.getSize().y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_data->size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_data->size.y / texture.getSize().y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_data->size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_data->size.y / texture.getSize().y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_data->size.y * texture.getSize().y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_data->size.y / texture.getSize().y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_data->size.y / texture.getSize().y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_data->size.x - ((texture.getSize().x - middleRect.width) * (m_data->size.y / texture.getSize().y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_data->size.y * texture.getSize().y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_data->size.y * texture.getSize().y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_data->size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_data->size.x / texture.getSize().x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_data->size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_data->size.x / texture.getSize().x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_data->size.x * texture.getSize().x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_data->size.x / texture.getSize().x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_data->size.x / texture.getSize().x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_data->size.y - ((texture.getSize().y - middleRect.height) * (m_data->size.x / texture.getSize().x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_data->size.x * texture.getSize().x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_data->size.x * texture.getSize().x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_data->size.x - (texture.getSize().x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_data->size.x + texture.getSize().x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_data->size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_data->size.y - (texture.getSize().y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_data->size.y + texture.getSize().y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_data->size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -245,58 +263,60 @@ namespace tgui
             }
         };
 
-        return m_texture.isTransparentPixel(pixel);
+        return m_data->texture.isTransparentPixel(pixel);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Sprite::ScalingType Sprite::getScalingType() const
     {
-        return m_scalingType;
+        return m_data->scalingType;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Sprite::updateVertices()
     {
+        Data& data = modifyData();
+
         // Figure out how the image is scaled best
-        Vector2f textureSize{m_texture.getImageSize()};
-        FloatRect middleRect{sf::FloatRect{m_texture.getMiddleRect()}};
+        Vector2f textureSize{data.texture.getImageSize()};
+        FloatRect middleRect{sf::FloatRect{data.texture.getMiddleRect()}};
         if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
         {
-            m_scalingType = ScalingType::Normal;
+            data.scalingType = ScalingType::Normal;
         }
         else if (middleRect.height == textureSize.y)
         {
-            if (m_size.x >= (textureSize.x - middleRect.width) * (m_size.y / textureSize.y))
-                m_scalingType = ScalingType::Horizontal;
+            if (data.size.x >= (textureSize.x - middleRect.width) * (data.size.y / textureSize.y))
+                data.scalingType = ScalingType::Horizontal;
             else
-                m_scalingType = ScalingType::Normal;
+                data.scalingType = ScalingType::Normal;
         }
         else if (middleRect.width == textureSize.x)
         {
-            if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
+            if (data.size.y >= (textureSize.y - middleRect.height) * (data.size.x / textureSize.x))
+                data.scalingType = ScalingType::Vertical;
             else
-                m_scalingType = ScalingType::Normal;
+                data.scalingType = ScalingType::Normal;
         }
         else
         {
-            if (m_size.x >= textureSize.x - middleRect.width)
+            if (data.size.x >= textureSize.x - middleRect.width)
             {
-                if (m_size.y >= textureSize.y - middleRect.height)
-                    m_scalingType = ScalingType::NineSlice;
+                if (data.size.y >= textureSize.y - middleRect.height)
+                    data.scalingType = ScalingType::NineSlice;
                 else
-                    m_scalingType = ScalingType::Horizontal;
+                    data.scalingType = ScalingType::Horizontal;
             }
-            else if (m_size.y >= (textureSize.y - middleRect.height) * (m_size.x / textureSize.x))
-                m_scalingType = ScalingType::Vertical;
+            else if (data.size.y >= (textureSize.y - middleRect.height) * (data.size.x / textureSize.x))
+                data.scalingType = ScalingType::Vertical;
             else
-                m_scalingType = ScalingType::Normal;
+                data.scalingType = ScalingType::Normal;
         }
 
         // Calculate the vertices based on the way we are scaling
-        switch (m_scalingType)
+        switch (data.scalingType)
         {
         case ScalingType::Normal:
             ///////////
@@ -304,11 +324,11 @@ namespace tgui
             // |   | //
             // 2---3 //
             ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            data.vertices.resize(4);
+            data.vertices[0] = {{0, 0}, data.vertexColor, {0, 0}};
+            data.vertices[1] = {{data.size.x, 0}, data.vertexColor, {textureSize.x, 0}};
+            data.vertices[2] = {{0, data.size.y}, data.vertexColor, {0, textureSize.y}};
+            data.vertices[3] = {{data.size.x, data.size.y}, data.vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Horizontal:
@@ -317,15 +337,15 @@ namespace tgui
             // |   |       |   | //
             // 1---3-------5---7 //
             ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            data.vertices.resize(8);
+            data.vertices[0] = {{0, 0}, data.vertexColor, {0, 0}};
+            data.vertices[1] = {{0, data.size.y}, data.vertexColor, {0, textureSize.y}};
+            data.vertices[2] = {{middleRect.left * (data.size.y / textureSize.y), 0}, data.vertexColor, {middleRect.left, 0}};
+            data.vertices[3] = {{middleRect.left * (data.size.y / textureSize.y), data.size.y}, data.vertexColor, {middleRect.left, textureSize.y}};
+            data.vertices[4] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width) * (data.size.y / textureSize.y), 0}, data.vertexColor, {middleRect.left + middleRect.width, 0}};
+            data.vertices[5] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width) * (data.size.y / textureSize.y), data.size.y}, data.vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            data.vertices[6] = {{data.size.x, 0}, data.vertexColor, {textureSize.x, 0}};
+            data.vertices[7] = {{data.size.x, data.size.y}, data.vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Vertical:
@@ -340,15 +360,15 @@ namespace tgui
             // |   | //
             // 6---7-//
             ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            data.vertices.resize(8);
+            data.vertices[0] = {{0, 0}, data.vertexColor, {0, 0}};
+            data.vertices[1] = {{data.size.x, 0}, data.vertexColor, {textureSize.x, 0}};
+            data.vertices[2] = {{0, middleRect.top * (data.size.x / textureSize.x)}, data.vertexColor, {0, middleRect.top}};
+            data.vertices[3] = {{data.size.x, middleRect.top * (data.size.x / textureSize.x)}, data.vertexColor, {textureSize.x, middleRect.top}};
+            data.vertices[4] = {{0, data.size.y - (textureSize.y - middleRect.top - middleRect.height) * (data.size.x / textureSize.x)}, data.vertexColor, {0, middleRect.top + middleRect.height}};
+            data.vertices[5] = {{data.size.x, data.size.y - (textureSize.y - middleRect.top - middleRect.height) * (data.size.x / textureSize.x)}, data.vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            data.vertices[6] = {{0, data.size.y}, data.vertexColor, {0, textureSize.y}};
+            data.vertices[7] = {{data.size.x, data.size.y}, data.vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::NineSlice:
@@ -363,35 +383,45 @@ namespace tgui
             // |    |              |     |  //
             // 6----7-------------8/20---21 //
             //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            data.vertices.resize(22);
+            data.vertices[0] = {{0, 0}, data.vertexColor, {0, 0}};
+            data.vertices[1] = {{middleRect.left, 0}, data.vertexColor, {middleRect.left, 0}};
+            data.vertices[2] = {{0, middleRect.top}, data.vertexColor, {0, middleRect.top}};
+            data.vertices[3] = {{middleRect.left, middleRect.top}, data.vertexColor, {middleRect.left, middleRect.top}};
+            data.vertices[4] = {{0, data.size.y - (textureSize.y - middleRect.top - middleRect.height)}, data.vertexColor, {0, middleRect.top + middleRect.height}};
+            data.vertices[5] = {{middleRect.left, data.size.y - (textureSize.y - middleRect.top - middleRect.height)}, data.vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
+            data.vertices[6] = {{0, data.size.y}, data.vertexColor, {0, textureSize.y}};
+            data.vertices[7] = {{middleRect.left, data.size.y}, data.vertexColor, {middleRect.left, textureSize.y}};
+            data.vertices[8] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width), data.size.y}, data.vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            data.vertices[9] = data.vertices[5];
+            data.vertices[10] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width), data.size.y - (textureSize.y - middleRect.top - middleRect.height)}, data.vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
+            data.vertices[11] = data.vertices[3];
+            data.vertices[12] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, data.vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
+            data.vertices[13] = data.vertices[1];
+            data.vertices[14] = {{data.size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, data.vertexColor, {middleRect.left + middleRect.width, 0}};
+            data.vertices[15] = {{data.size.x, 0}, data.vertexColor, {textureSize.x, 0}};
+            data.vertices[16] = data.vertices[12];
+            data.vertices[17] = {{data.size.x, middleRect.top}, data.vertexColor, {textureSize.x, middleRect.top}};
+            data.vertices[18] = data.vertices[10];
+            data.vertices[19] = {{data.size.x, data.size.y - (textureSize.y - middleRect.top - middleRect.height)}, data.vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            data.vertices[20] = data.vertices[8];
+            data.vertices[21] = {{data.size.x, data.size.y}, data.vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Sprite::Data& Sprite::modifyData()
+    {
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<Data>(*m_data);
+
+        return *m_data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Sprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
@@ -410,17 +440,17 @@ namespace tgui
             // Apply clipping when needed
         #ifdef TGUI_USE_CPP17
             std::optional<Clipping> clipping;
-            if (m_visibleRect != FloatRect{})
-                clipping.emplace(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
+            if (m_data->visibleRect != FloatRect{})
+                clipping.emplace(target, states, Vector2f{m_data->visibleRect.left, m_data->visibleRect.top}, Vector2f{m_data->visibleRect.width, m_data->visibleRect.height});
         #else
             std::unique_ptr<Clipping> clipping;
-            if (m_visibleRect != FloatRect{0, 0, 0, 0})
-                clipping = std::make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
+            if (m_data->visibleRect != FloatRect{0, 0, 0, 0})
+                clipping = std::make_unique<Clipping>(target, states, Vector2f{m_data->visibleRect.left, m_data->visibleRect.top}, Vector2f{m_data->visibleRect.width, m_data->visibleRect.height});
         #endif
 
-            states.shader = m_texture.getData()->shader;
-            states.texture = &m_texture.getData()->texture;
-            target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            states.shader = m_data->texture.getData()->shader;
+            states.texture = &m_data->texture.getData()->texture;
+            priv::drawOrRecord(target, m_data->vertices.data(), m_data->vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -25,8 +25,48 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Widgets cache the font metrics that they need while being drawn, but the metrics may still be looked up on several
+    // threads at once when the gui is drawn in parallel. Looking up a glyph may load it into the font, so these lookups
+    // can't happen at the same time. The mutex is only locked while recording in parallel.
+    std::mutex fontMetricsMutex;
+
+    std::unique_lock<std::mutex> lockFontMetricsWhenRecordingInParallel()
+    {
+        if (tgui::priv::ParallelRecordingScope::isActive())
+            return std::unique_lock<std::mutex>{fontMetricsMutex};
+        else
+            return std::unique_lock<std::mutex>{};
+    }
+
+    // Same as Text::calculateExtraVerticalSpace, but fontMetricsMutex has to be locked by the caller
+    float calculateExtraVerticalSpaceLocked(const tgui::Font& font, unsigned int characterSize, tgui::TextStyle style)
+    {
+        if (font == nullptr)
+            return 0;
+
+        const bool bold = (style & sf::Text::Bold) != 0;
+
+        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
+        const float lineHeight = characterSize
+                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
+                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+
+        // Get the line spacing sfml returns
+        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
+
+        // Calculate the offset of the text
+        return lineHeight - lineSpacing;
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +74,15 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Text::Text()
+    {
+        // All texts start out sharing the same empty text, it only gets copied once the text is changed
+        static const std::shared_ptr<sf::Text> emptyText = std::make_shared<sf::Text>();
+        m_text = emptyText;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Text::getSize() const
     {
         return m_size;
@@ -43,7 +92,7 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
+        modifyText().setString(string);
         recalculateSize();
     }
 
@@ -51,14 +100,14 @@ namespace tgui
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_text->getString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
+        modifyText().setCharacterSize(size);
         recalculateSize();
     }
 
@@ -66,7 +115,7 @@ namespace tgui
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_text->getCharacterSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,9 +125,9 @@ namespace tgui
         m_color = color;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
+        modifyText().setFillColor(Color::calcColorOpacity(color, m_opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
+        modifyText().setColor(Color::calcColorOpacity(color, m_opacity));
     #endif
     }
 
@@ -96,9 +145,9 @@ namespace tgui
         m_opacity = opacity;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
+        modifyText().setFillColor(Color::calcColorOpacity(m_color, opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
+        modifyText().setColor(Color::calcColorOpacity(m_color, opacity));
     #endif
     }
 
@@ -116,22 +165,24 @@ namespace tgui
         m_font = font;
 
         if (font)
-            m_text.setFont(*font.getFont());
+            modifyText().setFont(*font.getFont());
         else
         {
             // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
+            if (m_text->getFont())
             {
-                m_text = sf::Text();
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
+                auto text = std::make_shared<sf::Text>();
+                text->setString(getString());
+                text->setCharacterSize(getCharacterSize());
+                text->setStyle(getStyle());
 
             #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                text->setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                text->setColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #endif
+
+                m_text = std::move(text);
             }
         }
 
@@ -149,9 +200,9 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_text->getStyle())
         {
-            m_text.setStyle(style);
+            modifyText().setStyle(style);
             recalculateSize();
         }
     }
@@ -160,14 +211,14 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_text->getStyle();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        return m_text->findCharacterPos(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,7 +233,17 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        priv::drawOrRecord(target, *m_text, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Text& Text::modifyText()
+    {
+        if (m_text.use_count() > 1)
+            m_text = std::make_shared<sf::Text>(*m_text);
+
+        return *m_text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -200,9 +261,9 @@ namespace tgui
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const sf::String& string = m_text->getString();
+        const bool bold = (m_text->getStyle() & sf::Text::Bold) != 0;
+        const unsigned int textSize = m_text->getCharacterSize();
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
             const float kerning = font->getKerning(prevChar, string[i], textSize);
@@ -220,8 +281,8 @@ namespace tgui
             prevChar = string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text->getCharacterSize(), m_text->getStyle());
+        const float height = lines * font->getLineSpacing(m_text->getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
     }
 
@@ -257,7 +318,8 @@ namespace tgui
 
     float Text::getLineHeight(Font font, unsigned int characterSize, TextStyle textStyle)
     {
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(font, characterSize, textStyle);
+        const auto lock = lockFontMetricsWhenRecordingInParallel();
+        const float extraVerticalSpace = calculateExtraVerticalSpaceLocked(font, characterSize, textStyle);
         return font.getLineSpacing(characterSize) + extraVerticalSpace;
     }
 
@@ -305,21 +367,8 @@ namespace tgui
 
     float Text::calculateExtraVerticalSpace(Font font, unsigned int characterSize, TextStyle style)
     {
-        if (font == nullptr)
-            return 0;
-
-        const bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        const auto lock = lockFontMetricsWhenRecordingInParallel();
+        return calculateExtraVerticalSpaceLocked(font, characterSize, style);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
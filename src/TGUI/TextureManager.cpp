@@ -25,6 +25,7 @@
 
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/ResourcePreloader.hpp>
 #include <TGUI/Exception.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +33,7 @@
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_map<const sf::Texture*, std::shared_ptr<TextureData>> TextureManager::m_textureIndex;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -69,15 +71,17 @@ namespace tgui
         dataHolder.users = 1;
         dataHolder.data = std::make_shared<TextureData>();
         dataHolder.data->rect = partRect;
+        m_textureIndex[&dataHolder.data->texture] = dataHolder.data;
         imageIt->second.push_back(std::move(dataHolder));
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
+        // Load the image, unless it was already decoded while loading a widget file
         auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
+        if (!ResourcePreloader::findImage(filename, data->image))
+            data->image = texture.getImageLoader()(filename);
         if (data->image != nullptr)
         {
             // Create a texture from the image
@@ -94,6 +98,8 @@ namespace tgui
         }
 
         // The image could not be loaded
+        for (const auto& holder : imageIt->second)
+            m_textureIndex.erase(&holder.data->texture);
         m_imageMap.erase(imageIt);
         return nullptr;
     }
@@ -135,6 +141,7 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        m_textureIndex.erase(&dataIt->data->texture);
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -149,6 +156,17 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::findTextureData(const sf::Texture& texture)
+    {
+        const auto it = m_textureIndex.find(&texture);
+        if (it != m_textureIndex.end())
+            return it->second;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
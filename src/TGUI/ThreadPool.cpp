@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/ThreadPool.hpp>
+
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ThreadPool::ThreadPool(unsigned int threadCount)
+        {
+            if (threadCount == 0)
+                threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+            m_threads.reserve(threadCount);
+            for (unsigned int i = 0; i < threadCount; ++i)
+                m_threads.emplace_back(&ThreadPool::workerLoop, this);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ThreadPool::~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+
+            m_condition.notify_all();
+            for (auto& thread : m_threads)
+                thread.join();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ThreadPool& ThreadPool::getDefault()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int ThreadPool::getThreadCount() const
+        {
+            return static_cast<unsigned int>(m_threads.size());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ThreadPool::enqueue(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_tasks.push_back(std::move(task));
+            }
+
+            m_condition.notify_one();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ThreadPool::workerLoop()
+        {
+            for (;;)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_condition.wait(lock, [this]{ return m_stopping || !m_tasks.empty(); });
+
+                    // Tasks that were already submitted are still executed when the pool is being destroyed
+                    if (m_tasks.empty())
+                        return;
+
+                    task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+
+                task();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
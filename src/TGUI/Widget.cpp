@@ -26,8 +26,11 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/LayoutSolver.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -39,25 +42,10 @@ namespace tgui
 
     namespace
     {
-        void addAnimation(std::vector<std::shared_ptr<priv::Animation>>& existingAnimations, std::shared_ptr<priv::Animation> newAnimation)
-        {
-            const auto type = newAnimation->getType();
-
-            // If another animation is already running with the same type then instantly finish it
-            unsigned int i = 0;
-            while (i < existingAnimations.size())
-            {
-                if (existingAnimations[i]->getType() == type)
-                {
-                    existingAnimations[i]->finish();
-                    existingAnimations.erase(existingAnimations.begin() + i);
-                }
-                else
-                    ++i;
-            }
-
-            existingAnimations.push_back(newAnimation);
-        }
+        // Indices in Widget::m_showAnimations
+        const std::size_t moveAnimation = 0;
+        const std::size_t resizeAnimation = 1;
+        const std::size_t fadeAnimation = 2;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,11 +63,14 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
+        // All layouts have to be unbound before any of them is recalculated, this widget can no longer be accessed
+        priv::LayoutSolver::suspend();
         for (auto& layout : m_boundPositionLayouts)
             layout->unbindWidget();
 
         for (auto& layout : m_boundSizeLayouts)
             layout->unbindWidget();
+        priv::LayoutSolver::resume();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,11 +86,12 @@ namespace tgui
         m_enabled                      {other.m_enabled},
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
+        m_timeDependent                {other.m_updatedEveryFrame},
+        m_updatedEveryFrame            {other.m_updatedEveryFrame},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
-        m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
@@ -134,11 +126,15 @@ namespace tgui
         m_mouseDown                    {std::move(other.m_mouseDown)},
         m_focused                      {std::move(other.m_focused)},
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
+        m_timeDependent                {std::move(other.m_timeDependent)},
+        m_updatedEveryFrame            {std::move(other.m_updatedEveryFrame)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
+        m_showAnimationScheduler       {std::move(other.m_showAnimationScheduler)},
+        m_localAnimationScheduler      {std::move(other.m_localAnimationScheduler)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
@@ -183,11 +179,15 @@ namespace tgui
             m_mouseDown            = false;
             m_focused              = false;
             m_animationTimeElapsed = {};
+            m_timeDependent        = other.m_updatedEveryFrame;
+            m_updatedEveryFrame    = other.m_updatedEveryFrame;
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
+            m_showAnimationScheduler.reset();
+            m_localAnimationScheduler = nullptr;
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
 
@@ -232,11 +232,15 @@ namespace tgui
             m_mouseDown            = std::move(other.m_mouseDown);
             m_focused              = std::move(other.m_focused);
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
+            m_timeDependent        = std::move(other.m_timeDependent);
+            m_updatedEveryFrame    = std::move(other.m_updatedEveryFrame);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
+            m_showAnimationScheduler = std::move(other.m_showAnimationScheduler);
+            m_localAnimationScheduler = std::move(other.m_localAnimationScheduler);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
 
@@ -268,23 +272,29 @@ namespace tgui
         m_renderer->subscribe(this, m_rendererChangedCallback);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // The properties are compared by id, the predefined ids are in the same order as the names of the properties.
+        // The ids are copied because the getters of the renderer may insert properties while the widget is being updated.
+        const std::vector<PropertyId> oldProperties = oldData->getAllPropertyIds();
+        const std::vector<PropertyId> newProperties = rendererData->getAllPropertyIds();
+
+        TGUI_PROFILE_WIDGET_SCOPE(RendererChanged, *this);
+        auto oldIt = oldProperties.begin();
+        auto newIt = newProperties.begin();
+        while (oldIt != oldProperties.end() && newIt != newProperties.end())
         {
-            if (oldIt->first < newIt->first)
+            if (*oldIt < *newIt)
             {
                 // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
+                rendererChanged(*oldIt);
                 ++oldIt;
             }
             else
             {
                 // Update changed and new properties
-                rendererChanged(newIt->first);
+                rendererChanged(*newIt);
 
-                if (newIt->first < oldIt->first)
+                if (*newIt < *oldIt)
                     ++newIt;
                 else
                 {
@@ -293,16 +303,18 @@ namespace tgui
                 }
             }
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        while (oldIt != oldProperties.end())
         {
-            rendererChanged(oldIt->first);
+            rendererChanged(*oldIt);
             ++oldIt;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        while (newIt != newProperties.end())
         {
-            rendererChanged(newIt->first);
+            rendererChanged(*newIt);
             ++newIt;
         }
+
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -327,9 +339,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
+            m_renderer->setData(RendererData::createOverride(m_renderer->getData()));
             m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
         }
 
         // You should not be allowed to call setters on the renderer when the widget is const
@@ -343,9 +354,8 @@ namespace tgui
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
+            m_renderer->setData(RendererData::createOverride(m_renderer->getData()));
             m_renderer->subscribe(this, m_rendererChangedCallback);
-            m_renderer->getData()->shared = false;
         }
 
         return m_renderer.get();
@@ -364,8 +374,13 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
+            // The layouts are recalculated together once they are all marked
+            priv::LayoutSolver::suspend();
             for (auto& layout : m_boundPositionLayouts)
                 layout->recalculateValue();
+            priv::LayoutSolver::resume();
+
+            boundsChanged();
         }
     }
 
@@ -382,9 +397,14 @@ namespace tgui
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
+            priv::LayoutSolver::suspend();
             for (auto& layout : m_boundSizeLayouts)
                 layout->recalculateValue();
+            priv::LayoutSolver::resume();
         }
+
+        // The parent is also informed when the size didn't change, as the full size of the widget may still have changed
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,34 +437,49 @@ namespace tgui
     {
         setVisible(true);
 
+        // The animations keep the widget alive until they are finished
+        const auto self = shared_from_this();
+        const auto position = getPosition();
+        const auto size = getSize();
+        const auto moveTo = [self](Vector2f pos){ self->setPosition(pos); };
+
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                const float opacity = getInheritedOpacity();
+                m_showAnimations[fadeAnimation] = prepareShowAnimation(fadeAnimation).animate(0.f, opacity, duration,
+                    [self](float value){ self->setInheritedOpacity(value); }, Easing::Linear,
+                    [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
                 setInheritedOpacity(0);
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition(getPosition() + (getSize() / 2.f));
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position + (size / 2.f), position, duration, moveTo);
+                m_showAnimations[resizeAnimation] = prepareShowAnimation(resizeAnimation).animate(Vector2f{0, 0}, size, duration,
+                    [self](Vector2f value){ self->setSize(value); }, Easing::Linear,
+                    [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
+                setPosition(position + (size / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition({-getFullSize().x, getPosition().y});
+                const Vector2f start{-getFullSize().x, position.y};
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(start, position, duration, moveTo, Easing::Linear,
+                    [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
+                setPosition(start);
                 break;
             }
             case ShowAnimationType::SlideFromRight:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
+                    const Vector2f start{getParent()->getSize().x + getWidgetOffset().x, position.y};
+                    m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(start, position, duration, moveTo, Easing::Linear,
+                        [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
+                    setPosition(start);
                 }
                 else
                 {
@@ -455,16 +490,20 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition({getPosition().x, -getFullSize().y});
+                const Vector2f start{position.x, -getFullSize().y};
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(start, position, duration, moveTo, Easing::Linear,
+                    [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
+                setPosition(start);
                 break;
             }
             case ShowAnimationType::SlideFromBottom:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
+                    const Vector2f start{position.x, getParent()->getSize().y + getWidgetOffset().y};
+                    m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(start, position, duration, moveTo, Easing::Linear,
+                        [self,type]{ self->onAnimationFinished.emit(self.get(), type, true); });
+                    setPosition(start);
                 }
                 else
                 {
@@ -474,37 +513,45 @@ namespace tgui
                 break;
             }
         }
+
+        updateTimeDependency();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::hideWithEffect(ShowAnimationType type, sf::Time duration)
     {
+        // The animations keep the widget alive until they are finished
+        const auto self = shared_from_this();
         const auto position = getPosition();
         const auto size = getSize();
+        const auto moveTo = [self](Vector2f pos){ self->setPosition(pos); };
 
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
-                float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
-                    [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); }));
+                const float opacity = getInheritedOpacity();
+                m_showAnimations[fadeAnimation] = prepareShowAnimation(fadeAnimation).animate(opacity, 0.f, duration,
+                    [self](float value){ self->setInheritedOpacity(value); }, Easing::Linear,
+                    [self,type,opacity]{ self->setVisible(false); self->setInheritedOpacity(opacity); self->onAnimationFinished.emit(self.get(), type, false); });
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
-                    [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position, position + (size / 2.f), duration, moveTo, Easing::Linear,
+                    [self,position,size]{ self->setVisible(false); self->setPosition(position); self->setSize(size); });
+                m_showAnimations[resizeAnimation] = prepareShowAnimation(resizeAnimation).animate(size, Vector2f{0, 0}, duration,
+                    [self](Vector2f value){ self->setSize(value); }, Easing::Linear,
+                    [self,type,position,size]{ self->setVisible(false); self->setPosition(position); self->setSize(size); self->onAnimationFinished.emit(self.get(), type, false); });
                 break;
             }
             case ShowAnimationType::SlideToRight:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, moveTo, Easing::Linear,
+                        [self,type,position]{ self->setVisible(false); self->setPosition(position); self->onAnimationFinished.emit(self.get(), type, false); });
                 }
                 else
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToRight) does not work before widget has a parent.");
@@ -513,29 +560,31 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position, Vector2f{-getFullSize().x, position.y}, duration, moveTo, Easing::Linear,
+                    [self,type,position]{ self->setVisible(false); self->setPosition(position); self->onAnimationFinished.emit(self.get(), type, false); });
                 break;
             }
             case ShowAnimationType::SlideToBottom:
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                    m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, moveTo, Easing::Linear,
+                        [self,type,position]{ self->setVisible(false); self->setPosition(position); self->onAnimationFinished.emit(self.get(), type, false); });
                 }
-                else
+                else
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
 
                 break;
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                m_showAnimations[moveAnimation] = prepareShowAnimation(moveAnimation).animate(position, Vector2f{position.x, -getFullSize().y}, duration, moveTo, Easing::Linear,
+                    [self,type,position]{ self->setVisible(false); self->setPosition(position); self->onAnimationFinished.emit(self.get(), type, false); });
                 break;
             }
         }
+
+        updateTimeDependency();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -586,6 +635,8 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        updateTimeDependency();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,7 +667,8 @@ namespace tgui
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("font");
+        rendererChanged(Property::Font);
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,7 +683,7 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("opacity");
+        rendererChanged(Property::Opacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -688,13 +740,46 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
-        {
-            if (m_showAnimations[i]->update(elapsedTime))
-                m_showAnimations.erase(m_showAnimations.begin() + i);
-            else
-                i++;
-        }
+        if (m_localAnimationScheduler)
+            m_localAnimationScheduler->update(elapsedTime);
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isTimeDependent() const
+    {
+        return m_updatedEveryFrame || (m_localAnimationScheduler && (m_localAnimationScheduler->getAnimationCount() > 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setUpdatedEveryFrame(bool updatedEveryFrame)
+    {
+        m_updatedEveryFrame = updatedEveryFrame;
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateTimeDependency()
+    {
+        const bool timeDependent = isTimeDependent();
+        if (m_timeDependent == timeDependent)
+            return;
+
+        m_timeDependent = timeDependent;
+        if (m_parent)
+            m_parent->childTimeDependencyChanged(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::boundsChanged()
+    {
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -825,27 +910,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChanged(const std::string& property)
+    void Widget::rendererChanged(PropertyId property)
     {
-        if (property == "opacity")
-        {
-            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == "font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = getGlobalFont();
-        }
-        else if (property == "transparenttexture")
+        switch (property)
         {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            case Property::Opacity:
+            {
+                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
+            }
+            case Property::Font:
+            {
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = getGlobalFont();
+                break;
+            }
+            case Property::TransparentTexture:
+            {
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                break;
+            }
+            default:
+                rendererChanged(priv::getPropertyName(property));
         }
-        else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererChanged(const std::string& property)
+    {
+        throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1005,9 +1103,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const std::string& property)
+    void Widget::rendererChangedCallback(const std::vector<PropertyId>& properties)
     {
-        rendererChanged(property);
+        TGUI_PROFILE_WIDGET_SCOPE(RendererChanged, *this);
+        for (const auto property : properties)
+            rendererChanged(property);
+
+        // Properties such as borders or the font can change the area that the widget covers
+        boundsChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    AnimationScheduler& Widget::prepareShowAnimation(std::size_t kind)
+    {
+        const Container* root = m_parent;
+        while (root && root->getParent())
+            root = root->getParent();
+
+        std::shared_ptr<AnimationScheduler> scheduler;
+        if (const auto guiContainer = dynamic_cast<const GuiContainer*>(root))
+            scheduler = guiContainer->getAnimationScheduler();
+        else
+        {
+            if (!m_localAnimationScheduler)
+                m_localAnimationScheduler = std::make_shared<AnimationScheduler>();
+
+            scheduler = m_localAnimationScheduler;
+        }
+
+        // All running show animations have to be on the same scheduler, so the ones on another scheduler are finished first
+        const auto previousScheduler = m_showAnimationScheduler.lock();
+        if (previousScheduler != scheduler)
+        {
+            if (previousScheduler)
+            {
+                for (auto& id : m_showAnimations)
+                {
+                    previousScheduler->finish(id);
+                    id = 0;
+                }
+            }
+
+            m_showAnimationScheduler = scheduler;
+        }
+        else if (m_showAnimations[kind])
+        {
+            // If another animation is already running with the same type then instantly finish it
+            scheduler->finish(m_showAnimations[kind]);
+            m_showAnimations[kind] = 0;
+        }
+
+        return *scheduler;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1024,7 +1171,7 @@ namespace tgui
         else
             shape.setFillColor(color);
 
-        target.draw(shape, states);
+        priv::drawOrRecord(target, shape, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1043,7 +1190,7 @@ namespace tgui
             sf::RectangleShape border;
             border.setFillColor(color);
             border.setSize({size.x, size.y});
-            target.draw(border, states);
+            priv::drawOrRecord(target, border, states);
         }
         else // Draw borders in the normal way
         {
@@ -1070,7 +1217,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            priv::drawOrRecord(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
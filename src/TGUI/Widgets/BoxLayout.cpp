@@ -89,12 +89,7 @@ namespace tgui
         if (index < m_widgets.size())
         {
             Group::add(widget, widgetName);
-
-            m_widgets.pop_back();
-            m_widgetNames.pop_back();
-
-            m_widgets.insert(m_widgets.begin() + index, widget);
-            m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+            moveWidgetToIndex(m_widgets.size() - 1, index);
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
@@ -140,23 +135,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const std::string& property)
+    void BoxLayout::rendererChanged(PropertyId property)
     {
-        if (property == "spacebetweenwidgets")
-        {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else if (property == "padding")
+        switch (property)
         {
-            Group::rendererChanged(property);
-
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case Property::SpaceBetweenWidgets:
+            {
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+            case Property::Padding:
+            {
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -262,99 +262,130 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Button::rendererChanged(const std::string& property)
+    void Button::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled") || (property == "textcolorfocused")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled") || (property == "textstylefocused"))
-        {
-            updateTextColorAndStyle();
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedown")
-        {
-            m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordown")
-        {
-            m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordown")
-        {
-            m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorfocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
+            }
+            case Property::TextColor:
+            case Property::TextColorHover:
+            case Property::TextColorDown:
+            case Property::TextColorDisabled:
+            case Property::TextColorFocused:
+            case Property::TextStyle:
+            case Property::TextStyleHover:
+            case Property::TextStyleDown:
+            case Property::TextStyleDisabled:
+            case Property::TextStyleFocused:
+            {
+                updateTextColorAndStyle();
+                break;
+            }
+            case Property::Texture:
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+            }
+            case Property::TextureHover:
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+            }
+            case Property::TextureDown:
+            {
+                m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
+                break;
+            }
+            case Property::TextureDisabled:
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+            }
+            case Property::TextureFocused:
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+            case Property::BorderColorDown:
+            {
+                m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
+                break;
+            }
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+            case Property::BorderColorFocused:
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::BackgroundColorDown:
+            {
+                m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
+                break;
+            }
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+            case Property::BackgroundColorFocused:
+            {
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDown.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDown.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/RenderCommandList.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -146,11 +147,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Canvas::rendererChanged(const std::string& property)
+    void Canvas::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (property == Property::Opacity)
             m_sprite.setColor(Color::calcColorOpacity(Color::White, getSharedRenderer()->getOpacity()));
     }
 
@@ -159,7 +160,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        priv::drawOrRecord(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
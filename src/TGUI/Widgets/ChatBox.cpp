@@ -234,6 +234,7 @@ namespace tgui
     void ChatBox::setTextSize(unsigned int size)
     {
         m_textSize = size;
+        m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
         m_scroll->setScrollAmount(size);
 
         for (auto& line : m_lines)
@@ -417,61 +418,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const std::string& property)
+    void ChatBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::Scrollbar:
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+            case Property::ScrollbarWidth:
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                setSize(m_size);
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
 
-            recalculateAllLines();
+                m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+                recalculateAllLines();
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -587,7 +602,7 @@ namespace tgui
         const Clipping clipping{target, states, {}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - m_scroll->getSize().x,
                                                      getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-        states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize), -static_cast<float>(m_scroll->getValue())});
+        states.transform.translate({m_extraHorizontalPaddingCached, -static_cast<float>(m_scroll->getValue())});
 
         // Put the lines at the bottom of the chat box if needed
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -121,6 +122,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            boundsChanged();
             onCheck.emit(this, true);
         }
         else
@@ -151,12 +153,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const std::string& property)
+    void CheckBox::rendererChanged(PropertyId property)
     {
-        if (property == "textureunchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (property)
+        {
+            case Property::TextureUnchecked:
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+            case Property::TextureChecked:
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+        }
 
         RadioButton::rendererChanged(property);
     }
@@ -257,7 +264,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                priv::drawOrRecord(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
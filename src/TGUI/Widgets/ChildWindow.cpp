@@ -725,127 +725,148 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const std::string& property)
+    void ChildWindow::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "titlecolor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if (property == "texturetitlebar")
-        {
-            m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::TitleColor:
+            {
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
+            }
+            case Property::TextureTitleBar:
+            {
+                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
-            // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                    updateTitleBarHeight();
+                break;
+            }
+            case Property::TitleBarHeight:
+            {
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
                 updateTitleBarHeight();
-        }
-        else if (property == "titlebarheight")
-        {
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
-        }
-        else if (property == "borderbelowtitlebar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == "paddingbetweenbuttons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == "minimumresizableborderwidth")
-        {
-            m_MinimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == "showtextontitlebuttons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == "closebutton")
-        {
-            if (m_closeButton->isVisible())
+                break;
+            }
+            case Property::BorderBelowTitleBar:
             {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
+                break;
             }
-
-            updateTitleBarHeight();
-        }
-        else if (property == "maximizebutton")
-        {
-            if (m_maximizeButton->isVisible())
+            case Property::DistanceToSide:
             {
-                m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
             }
-
-            updateTitleBarHeight();
-        }
-        else if (property == "minimizebutton")
-        {
-            if (m_minimizeButton->isVisible())
+            case Property::PaddingBetweenButtons:
+            {
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
+            }
+            case Property::MinimumResizableBorderWidth:
+            {
+                m_MinimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                break;
+            }
+            case Property::ShowTextOnTitleButtons:
             {
-                m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
             }
+            case Property::CloseButton:
+            {
+                if (m_closeButton->isVisible())
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "titlebarcolor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "opacity")
-        {
-            Container::rendererChanged(property);
+                updateTitleBarHeight();
+                break;
+            }
+            case Property::MaximizeButton:
+            {
+                if (m_maximizeButton->isVisible())
+                {
+                    m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                updateTitleBarHeight();
+                break;
+            }
+            case Property::MinimizeButton:
             {
-                if (button->isVisible())
-                    button->setInheritedOpacity(m_opacityCached);
+                if (m_minimizeButton->isVisible())
+                {
+                    m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
             }
+            case Property::TitleBarColor:
+            {
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Container::rendererChanged(property);
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Container::rendererChanged(property);
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedOpacity(m_opacityCached);
+                }
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
-            {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                break;
             }
+            case Property::Font:
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
 
-            setPosition(m_position);
+                setPosition(m_position);
+                break;
+            }
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <TGUI/RenderCommandList.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,6 +60,7 @@ namespace tgui
         m_nrOfItemsToDisplay             {other.m_nrOfItemsToDisplay},
         m_listBox                        {ListBox::copy(other.m_listBox)},
         m_text                           {other.m_text},
+        m_extraHorizontalPaddingCached   {other.m_extraHorizontalPaddingCached},
         m_expandDirection                {other.m_expandDirection},
         m_spriteBackground               {other.m_spriteBackground},
         m_spriteArrow                    {other.m_spriteArrow},
@@ -83,6 +85,7 @@ namespace tgui
         m_nrOfItemsToDisplay             {std::move(other.m_nrOfItemsToDisplay)},
         m_listBox                        {std::move(other.m_listBox)},
         m_text                           {std::move(other.m_text)},
+        m_extraHorizontalPaddingCached   {std::move(other.m_extraHorizontalPaddingCached)},
         m_expandDirection                {std::move(other.m_expandDirection)},
         m_spriteBackground               {std::move(other.m_spriteBackground)},
         m_spriteArrow                    {std::move(other.m_spriteArrow)},
@@ -112,6 +115,7 @@ namespace tgui
             std::swap(m_nrOfItemsToDisplay,              temp.m_nrOfItemsToDisplay);
             std::swap(m_listBox,                         temp.m_listBox);
             std::swap(m_text,                            temp.m_text);
+            std::swap(m_extraHorizontalPaddingCached,    temp.m_extraHorizontalPaddingCached);
             std::swap(m_expandDirection,                 temp.m_expandDirection);
             std::swap(m_spriteBackground,                temp.m_spriteBackground);
             std::swap(m_spriteArrow,                     temp.m_spriteArrow);
@@ -140,6 +144,7 @@ namespace tgui
             m_nrOfItemsToDisplay              = std::move(other.m_nrOfItemsToDisplay);
             m_listBox                         = std::move(other.m_listBox);
             m_text                            = std::move(other.m_text);
+            m_extraHorizontalPaddingCached    = std::move(other.m_extraHorizontalPaddingCached);
             m_expandDirection                 = std::move(other.m_expandDirection);
             m_spriteBackground                = std::move(other.m_spriteBackground);
             m_spriteArrow                     = std::move(other.m_spriteArrow);
@@ -228,6 +233,7 @@ namespace tgui
         }
 
         m_text.setCharacterSize(m_listBox->getTextSize());
+        m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,6 +449,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
+        m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,88 +573,109 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const std::string& property)
+    void ComboBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_text.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "textstyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturearrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == "texturearrowhover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == "listbox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextColor:
+            {
+                m_text.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case Property::TextStyle:
+            {
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_text);
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::TextureArrow:
+            {
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureArrowHover:
+            {
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+            }
+            case Property::ListBox:
+            {
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::ArrowBackgroundColor:
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+            case Property::ArrowBackgroundColorHover:
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+            case Property::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+            case Property::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            m_text.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
+                m_text.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
 
-            setSize(m_size);
+                setSize(m_size);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -884,7 +912,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            priv::drawOrRecord(target, arrow, states);
         }
 
         // Draw the selected item
@@ -892,7 +920,7 @@ namespace tgui
         {
             const Clipping clipping{target, statesForText, {m_paddingCached.getLeft(), m_paddingCached.getTop()}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - arrowSize, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-            statesForText.transform.translate(m_paddingCached.getLeft() + Text::getExtraHorizontalPadding(m_text),
+            statesForText.transform.translate(m_paddingCached.getLeft() + m_extraHorizontalPaddingCached,
                                               m_paddingCached.getTop() + (((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) - m_text.getSize().y) / 2.0f));
             m_text.draw(target, statesForText);
         }
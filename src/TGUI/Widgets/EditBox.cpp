@@ -521,6 +521,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            updateTimeDependency();
         }
 
         // Set the mouse down flag
@@ -954,144 +955,176 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const std::string& property)
+    void EditBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
 
-            setText(m_text);
+                setText(m_text);
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == "caretwidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
-        {
-            updateTextColor();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "defaulttextcolor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == "textstyle")
-        {
-            const TextStyle style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textFull.setStyle(style);
-        }
-        else if (property == "defaulttextstyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorfocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretcolorhover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == "caretcolorfocused")
-        {
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+            }
+            case Property::CaretWidth:
+            {
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+            }
+            case Property::TextColor:
+            case Property::TextColorDisabled:
+            case Property::TextColorFocused:
+            {
+                updateTextColor();
+                break;
+            }
+            case Property::SelectedTextColor:
+            {
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
+            case Property::DefaultTextColor:
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+            }
+            case Property::Texture:
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+            }
+            case Property::TextureHover:
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+            }
+            case Property::TextureDisabled:
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+            }
+            case Property::TextureFocused:
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                break;
+            }
+            case Property::TextStyle:
+            {
+                const TextStyle style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textFull.setStyle(style);
+                break;
+            }
+            case Property::DefaultTextStyle:
+            {
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+            case Property::BorderColorFocused:
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+            case Property::BackgroundColorFocused:
+            {
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                break;
+            }
+            case Property::CaretColor:
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+            case Property::CaretColorHover:
+            {
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                break;
+            }
+            case Property::CaretColorFocused:
+            {
+                m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+                break;
+            }
+            case Property::SelectedTextBackgroundColor:
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
 
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
 
-            // Recalculate the text size and position
-            setText(m_text);
+                // Recalculate the text size and position
+                setText(m_text);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1457,6 +1490,15 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || m_focused || m_possibleDoubleClick;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
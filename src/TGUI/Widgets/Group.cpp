@@ -143,15 +143,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const std::string& property)
+    void Group::rendererChanged(PropertyId property)
     {
-        if (property == "padding")
+        switch (property)
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -471,48 +472,60 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const std::string& property)
+    void Knob::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
-        }
-        else if (property == "textureforeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "imagerotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureForeground:
+            {
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                setSize(m_size);
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+            case Property::ImageRotation:
+            {
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,7 +589,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            priv::drawOrRecord(target, bordersShape, states);
         }
 
         // Draw the background
@@ -586,7 +599,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            priv::drawOrRecord(target, background, states);
         }
 
         // Draw the foreground
@@ -608,7 +621,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            priv::drawOrRecord(target, thumb, states);
         }
     }
 
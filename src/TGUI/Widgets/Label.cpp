@@ -264,6 +264,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateTimeDependency();
             }
         }
     }
@@ -280,53 +281,65 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const std::string& property)
+    void Label::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
+            }
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
+            }
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                break;
+            }
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                    line.setColor(m_textColorCached);
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+                rearrangeText();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
+                for (auto& line : m_lines)
+                    line.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -410,6 +423,15 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Label::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || m_possibleDoubleClick;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +388,8 @@ namespace tgui
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
             for (auto& item : m_items)
                 item.setCharacterSize(m_textSize);
+
+            m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
         }
 
         m_scroll->setScrollAmount(m_itemHeight);
@@ -416,6 +418,7 @@ namespace tgui
         for (auto& item : m_items)
             item.setCharacterSize(m_textSize);
 
+        m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
         setPosition(m_position);
     }
 
@@ -552,6 +555,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateTimeDependency();
             }
         }
 
@@ -658,122 +662,147 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const std::string& property)
+    void ListBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "texturebackground")
+        switch (property)
         {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == "selectedtextstyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
+            case Property::Borders:
             {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
             }
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
-            m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case Property::TextColorHover:
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case Property::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case Property::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
 
-            m_scroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                for (auto& item : m_items)
+                    item.setStyle(m_textStyleCached);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
+                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                break;
+            }
+            case Property::SelectedTextStyle:
+            {
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
 
-            // Recalculate the text size with the new font
-            if (m_requestedTextSize == 0)
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[m_selectedItem].setStyle(m_textStyleCached);
+                }
+                break;
+            }
+            case Property::Scrollbar:
+            {
+                m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+            case Property::ScrollbarWidth:
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
+                m_scroll->setSize({width, m_scroll->getSize().y});
+                setSize(m_size);
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case Property::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+            case Property::Opacity:
             {
-                m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                Widget::rendererChanged(property);
+
+                m_scroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
+                    item.setOpacity(m_opacityCached);
+                break;
             }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            setPosition(m_position);
+                for (auto& item : m_items)
+                    item.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if (m_requestedTextSize == 0)
+                {
+                    m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.setCharacterSize(m_textSize);
+                }
+
+                m_extraHorizontalPaddingCached = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
+
+                setPosition(m_position);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -962,6 +991,15 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || m_possibleDoubleClick;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1030,7 +1068,7 @@ namespace tgui
             }
 
             // Draw the items
-            states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
+            states.transform.translate({m_extraHorizontalPaddingCached, 0});
             for (std::size_t i = firstItem; i < lastItem; ++i)
                 m_items[i].draw(target, states);
         }
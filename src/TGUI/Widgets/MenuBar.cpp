@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -712,60 +713,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const std::string& property)
+    void MenuBar::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        switch (property)
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "textcolordisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textureitembackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == "textureselecteditembackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case Property::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case Property::TextColorDisabled:
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::TextureItemBackground:
+            {
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
+            }
+            case Property::TextureSelectedItemBackground:
+            {
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case Property::DistanceToSide:
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+                updateTextFont(m_menus);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1291,7 +1307,7 @@ namespace tgui
                 else
                     arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
 
-                target.draw(arrow, states);
+                priv::drawOrRecord(target, arrow, states);
                 states.transform = textTransform;
             }
 
@@ -303,31 +303,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const std::string& property)
+    void MessageBox::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        switch (property)
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == "font")
-        {
-            ChildWindow::rendererChanged(property);
+            case Property::TextColor:
+            {
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case Property::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
+            case Property::Font:
+            {
+                ChildWindow::rendererChanged(property);
 
-            m_label->setInheritedFont(m_fontCached);
+                m_label->setInheritedFont(m_fontCached);
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
 
-            rearrange();
+                rearrange();
+                break;
+            }
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                updateTimeDependency();
             }
         }
     }
@@ -175,24 +176,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const std::string& property)
+    void Picture::rendererChanged(PropertyId property)
     {
-        if (property == "texture")
+        switch (property)
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            case Property::Texture:
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
-                setSize(texture.getImageSize());
+                if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
+                    setSize(texture.getImageSize());
 
-            m_sprite.setTexture(texture);
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +235,15 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Picture::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || m_possibleDoubleClick;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,68 +301,83 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const std::string& property)
+    void ProgressBar::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
-        {
-            m_textBack.setColor(getSharedRenderer()->getTextColor());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextColor:
+            case Property::TextColorFilled:
+            {
+                m_textBack.setColor(getSharedRenderer()->getTextColor());
 
-            if (getSharedRenderer()->getTextColorFilled().isSet())
-                m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
-            else
-                m_textFront.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturefill")
-        {
-            m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
-            recalculateFillSize();
-        }
-        else if (property == "textstyle")
-        {
-            m_textBack.setStyle(getSharedRenderer()->getTextStyle());
-            m_textFront.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "fillcolor")
-        {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+                if (getSharedRenderer()->getTextColorFilled().isSet())
+                    m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
+                else
+                    m_textFront.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::TextureFill:
+            {
+                m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
+                recalculateFillSize();
+                break;
+            }
+            case Property::TextStyle:
+            {
+                m_textBack.setStyle(getSharedRenderer()->getTextStyle());
+                m_textFront.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::FillColor:
+            {
+                m_fillColorCached = getSharedRenderer()->getFillColor();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteFill.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteFill.setOpacity(m_opacityCached);
 
-            m_textBack.setOpacity(m_opacityCached);
-            m_textFront.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                m_textBack.setOpacity(m_opacityCached);
+                m_textFront.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            m_textBack.setFont(m_fontCached);
-            m_textFront.setFont(m_fontCached);
-            setText(getText());
+                m_textBack.setFont(m_fontCached);
+                m_textFront.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
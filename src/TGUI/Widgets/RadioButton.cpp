@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -102,6 +103,7 @@ namespace tgui
             setText(getText());
 
         updateTextureSizes();
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,6 +153,9 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        // The text style can change the size of the text next to the radio button
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +170,8 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,167 +292,207 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const std::string& property)
+    void RadioButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
-        {
-            updateTextColor();
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateTextureSizes();
+                break;
+            }
+            case Property::TextColor:
+            case Property::TextColorHover:
+            case Property::TextColorDisabled:
+            case Property::TextColorChecked:
+            case Property::TextColorCheckedHover:
+            case Property::TextColorCheckedDisabled:
+            {
+                updateTextColor();
+                break;
+            }
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textstylechecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
+            case Property::TextStyleChecked:
+            {
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textureunchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == "texturechecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == "textureuncheckedhover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == "texturecheckedhover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == "textureuncheckeddisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == "texturecheckeddisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == "textureuncheckedfocused")
-        {
-            m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
-        }
-        else if (property == "texturecheckedfocused")
-        {
-            m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
-        }
-        else if (property == "checkcolor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == "checkcolorhover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == "checkcolordisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorfocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == "bordercolorchecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == "bordercolorcheckedhover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == "bordercolorcheckeddisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == "bordercolorcheckedfocused")
-        {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorchecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == "backgroundcolorcheckedhover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == "backgroundcolorcheckeddisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == "textdistanceratio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteUncheckedFocused.setOpacity(m_opacityCached);
-            m_spriteCheckedFocused.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
+            case Property::TextureUnchecked:
+            {
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateTextureSizes();
+                break;
+            }
+            case Property::TextureChecked:
+            {
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateTextureSizes();
+                break;
+            }
+            case Property::TextureUncheckedHover:
+            {
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                break;
+            }
+            case Property::TextureCheckedHover:
+            {
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                break;
+            }
+            case Property::TextureUncheckedDisabled:
+            {
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                break;
+            }
+            case Property::TextureCheckedDisabled:
+            {
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                break;
+            }
+            case Property::TextureUncheckedFocused:
+            {
+                m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
+                break;
+            }
+            case Property::TextureCheckedFocused:
+            {
+                m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
+                break;
+            }
+            case Property::CheckColor:
+            {
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                break;
+            }
+            case Property::CheckColorHover:
+            {
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                break;
+            }
+            case Property::CheckColorDisabled:
+            {
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+            case Property::BorderColorFocused:
+            {
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+            }
+            case Property::BorderColorChecked:
+            {
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                break;
+            }
+            case Property::BorderColorCheckedHover:
+            {
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                break;
+            }
+            case Property::BorderColorCheckedDisabled:
+            {
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                break;
+            }
+            case Property::BorderColorCheckedFocused:
+            {
+                m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+            case Property::BackgroundColorChecked:
+            {
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                break;
+            }
+            case Property::BackgroundColorCheckedHover:
+            {
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                break;
+            }
+            case Property::BackgroundColorCheckedDisabled:
+            {
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                break;
+            }
+            case Property::TextDistanceRatio:
+            {
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteUncheckedFocused.setOpacity(m_opacityCached);
+                m_spriteCheckedFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -659,7 +706,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            priv::drawOrRecord(target, circle, states);
         }
 
         // Draw the box
@@ -693,7 +740,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            priv::drawOrRecord(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -701,7 +748,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                priv::drawOrRecord(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
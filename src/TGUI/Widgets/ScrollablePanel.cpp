@@ -569,22 +569,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const std::string& property)
+    void ScrollablePanel::rendererChanged(PropertyId property)
     {
-        if (property == "scrollbar")
+        switch (property)
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "scrollbarwidth")
-        {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            updateScrollbars();
+            case Property::Scrollbar:
+            {
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+            case Property::ScrollbarWidth:
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
+                updateScrollbars();
+                break;
+            }
+            default:
+                Panel::rendererChanged(property);
+                break;
         }
-        else
-            Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -743,101 +744,122 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::rendererChanged(const std::string& property)
+    void Scrollbar::rendererChanged(PropertyId property)
     {
-        if (property == "texturetrack")
+        switch (property)
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            if (m_sizeSet)
-                updateSize();
-            else
+            case Property::TextureTrack:
             {
-                if (m_verticalScroll)
-                    setSize({getDefaultWidth(), getSize().y});
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                if (m_sizeSet)
+                    updateSize();
                 else
-                    setSize({getSize().x, getDefaultWidth()});
+                {
+                    if (m_verticalScroll)
+                        setSize({getDefaultWidth(), getSize().y});
+                    else
+                        setSize({getSize().x, getDefaultWidth()});
 
-                m_sizeSet = false;
+                    m_sizeSet = false;
+                }
+                break;
             }
+            case Property::TextureTrackHover:
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+            case Property::TextureThumb:
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateSize();
+                break;
+            }
+            case Property::TextureThumbHover:
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+            }
+            case Property::TextureArrowUp:
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                updateSize();
+                break;
+            }
+            case Property::TextureArrowUpHover:
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+            }
+            case Property::TextureArrowDown:
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                updateSize();
+                break;
+            }
+            case Property::TextureArrowDownHover:
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+            }
+            case Property::TrackColor:
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+            case Property::TrackColorHover:
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+            case Property::ThumbColorHover:
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+            case Property::ArrowBackgroundColor:
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+            case Property::ArrowBackgroundColorHover:
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+            case Property::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+            case Property::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            updateSize();
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "texturearrowup")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            updateSize();
-        }
-        else if (property == "texturearrowuphover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "texturearrowdown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            updateSize();
-        }
-        else if (property == "texturearrowdownhover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -937,7 +959,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            priv::drawOrRecord(target, arrow, states);
         }
 
         // Draw the track
@@ -1011,7 +1033,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            priv::drawOrRecord(target, arrow, states);
         }
     }
 
@@ -168,6 +168,9 @@ namespace tgui
         }
 
         updateThumbPosition();
+
+        // The thumb size was only updated after the widget was resized
+        boundsChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,72 +468,88 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Slider::rendererChanged(const std::string& property)
+    void Slider::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturetrack")
+        switch (property)
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureTrack:
+            {
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_verticalImage = true;
-            else
-                m_verticalImage = false;
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_verticalImage = true;
+                else
+                    m_verticalImage = false;
 
-            setSize(m_size);
-        }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureTrackHover:
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+            case Property::TextureThumb:
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureThumbHover:
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+            }
+            case Property::TrackColor:
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+            case Property::TrackColorHover:
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+            case Property::ThumbColorHover:
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/RenderCommandList.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -313,65 +314,81 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButton::rendererChanged(const std::string& property)
+    void SpinButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "borderbetweenarrows")
-        {
-            m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
-        }
-        else if (property == "texturearrowup")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-        }
-        else if (property == "texturearrowuphover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "texturearrowdown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-        }
-        else if (property == "texturearrowdownhover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::BorderBetweenArrows:
+            {
+                m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextureArrowUp:
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                break;
+            }
+            case Property::TextureArrowUpHover:
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+            }
+            case Property::TextureArrowDown:
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                break;
+            }
+            case Property::TextureArrowDownHover:
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+            case Property::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -469,8 +486,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            priv::drawOrRecord(target, arrowBack, states);
+            priv::drawOrRecord(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -535,8 +552,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            priv::drawOrRecord(target, arrowBack, states);
+            priv::drawOrRecord(target, arrow, states);
         }
     }
 
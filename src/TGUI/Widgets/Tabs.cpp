@@ -563,115 +563,139 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const std::string& property)
+    void Tabs::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property)
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "textcolordisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "texturetab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == "texturetabhover")
-        {
-            m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
-        }
-        else if (property == "textureselectedtab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == "textureselectedtabhover")
-        {
-            m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
-        }
-        else if (property == "texturedisabledtab")
-        {
-            m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                recalculateTabsWidth();
+                break;
+            }
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors();
+                break;
+            }
+            case Property::TextColorHover:
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors();
+                break;
+            }
+            case Property::TextColorDisabled:
+            {
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors();
+                break;
+            }
+            case Property::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors();
+                break;
+            }
+            case Property::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors();
+                break;
+            }
+            case Property::TextureTab:
+            {
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                break;
+            }
+            case Property::TextureTabHover:
+            {
+                m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
+                break;
+            }
+            case Property::TextureSelectedTab:
+            {
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                break;
+            }
+            case Property::TextureSelectedTabHover:
+            {
+                m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
+                break;
+            }
+            case Property::TextureDisabledTab:
+            {
+                m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
+                break;
+            }
+            case Property::DistanceToSide:
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                recalculateTabsWidth();
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+            case Property::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteTabHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTabHover.setOpacity(m_opacityCached);
-            m_spriteDisabledTab.setOpacity(m_opacityCached);
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteTabHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTabHover.setOpacity(m_opacityCached);
+                m_spriteDisabledTab.setOpacity(m_opacityCached);
 
-            for (auto& tab : m_tabs)
-                tab.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+                for (auto& tab : m_tabs)
+                    tab.text.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
 
-            for (auto& tab : m_tabs)
-                tab.text.setFont(m_fontCached);
+                for (auto& tab : m_tabs)
+                    tab.text.setFont(m_fontCached);
 
-            // Recalculate the size when the text is auto sizing
-            if (m_requestedTextSize == 0)
-                setTextSize(0);
-            else
-                recalculateTabsWidth();
+                // Recalculate the size when the text is auto sizing
+                if (m_requestedTextSize == 0)
+                    setTextSize(0);
+                else
+                    recalculateTabsWidth();
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,6 +182,7 @@ namespace tgui
 
         // Calculate the height of one line
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
+        m_extraVerticalSpaceCached = Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
 
         m_verticalScroll->setScrollAmount(m_lineHeight);
 
@@ -413,6 +414,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                updateTimeDependency();
             }
 
             // Update the texts
@@ -1196,7 +1198,7 @@ namespace tgui
         const bool scrollbarShown = m_verticalScroll->isShown();
 
         m_verticalScroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight
-                                                              + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                              + m_extraVerticalSpaceCached
                                                               + Text::getExtraVerticalPadding(m_textSize)));
 
         // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
@@ -1285,7 +1287,7 @@ namespace tgui
                 m_verticalScroll->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
             else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
                 m_verticalScroll->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight)
-                                                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                                    + m_extraVerticalSpaceCached
                                                                     + Text::getExtraVerticalPadding(m_textSize)
                                                                     - m_verticalScroll->getViewportSize()));
         }
@@ -1319,6 +1321,15 @@ namespace tgui
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        updateTimeDependency();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::isTimeDependent() const
+    {
+        return Widget::isTimeDependent() || m_focused || m_possibleDoubleClick;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1462,88 +1473,106 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rendererChanged(const std::string& property)
+    void TextBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
-        {
-            m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "scrollbarwidth")
+        switch (property)
         {
-            const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScroll->getDefaultWidth();
-            m_verticalScroll->setSize({width, m_verticalScroll->getSize().y});
-            setSize(m_size);
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretwidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-
-            m_verticalScroll->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            setTextSize(getTextSize());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+            case Property::TextColor:
+            {
+                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+            case Property::SelectedTextColor:
+            {
+                m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
+                m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+            case Property::Scrollbar:
+            {
+                m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+            case Property::ScrollbarWidth:
+            {
+                const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScroll->getDefaultWidth();
+                m_verticalScroll->setSize({width, m_verticalScroll->getSize().y});
+                setSize(m_size);
+                break;
+            }
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+            case Property::SelectedTextBackgroundColor:
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+            case Property::CaretColor:
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+            case Property::CaretWidth:
+            {
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                break;
+            }
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScroll->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection1.setOpacity(m_opacityCached);
+                m_textAfterSelection2.setOpacity(m_opacityCached);
+                m_textSelection1.setOpacity(m_opacityCached);
+                m_textSelection2.setOpacity(m_opacityCached);
+                break;
+            }
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection1.setFont(m_fontCached);
+                m_textSelection2.setFont(m_fontCached);
+                m_textAfterSelection1.setFont(m_fontCached);
+                m_textAfterSelection2.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                break;
+            }
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1621,7 +1650,7 @@ namespace tgui
             for (const auto& selectionRect : m_selectionRects)
             {
                 states.transform.translate({selectionRect.left, selectionRect.top});
-                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)}, m_selectedTextBackgroundColorCached);
+                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + m_extraVerticalSpaceCached}, m_selectedTextBackgroundColorCached);
                 states.transform.translate({-selectionRect.left, -selectionRect.top});
             }
 
@@ -1638,7 +1667,7 @@ namespace tgui
             // Only draw the caret when needed
             if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
             {
-                const float caretHeight = m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+                const float caretHeight = m_lineHeight + m_extraVerticalSpaceCached;
                 states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
                 drawRectangleShape(target, states, {m_caretWidthCached, caretHeight}, m_caretColorCached);
             }
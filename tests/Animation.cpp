@@ -200,3 +200,146 @@ TEST_CASE("[Animation]") {
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
 }
+
+TEST_CASE("[AnimationScheduler]") {
+    tgui::AnimationScheduler scheduler;
+
+    SECTION("Float") {
+        float value = -1;
+        unsigned int finishedCount = 0;
+        const auto id = scheduler.animate(10.f, 20.f, sf::milliseconds(400), [&](float v){ value = v; }, tgui::Easing::Linear, [&]{ ++finishedCount; });
+        REQUIRE(id != 0);
+        REQUIRE(scheduler.isRunning(id));
+        REQUIRE(scheduler.getAnimationCount() == 1);
+        REQUIRE(value == -1);
+
+        scheduler.update(sf::milliseconds(100));
+        REQUIRE(tgui::compareFloats(value, 12.5f));
+        REQUIRE(finishedCount == 0);
+
+        scheduler.update(sf::milliseconds(400));
+        REQUIRE(value == 20);
+        REQUIRE(finishedCount == 1);
+        REQUIRE(!scheduler.isRunning(id));
+        REQUIRE(scheduler.getAnimationCount() == 0);
+
+        scheduler.update(sf::milliseconds(100));
+        REQUIRE(finishedCount == 1);
+    }
+
+    SECTION("Vector") {
+        tgui::Vector2f value;
+        scheduler.animate(tgui::Vector2f{0, 100}, tgui::Vector2f{100, 0}, sf::milliseconds(200), [&](tgui::Vector2f v){ value = v; });
+        scheduler.update(sf::milliseconds(50));
+        REQUIRE(compareVector2f(value, {25, 75}));
+    }
+
+    SECTION("Color") {
+        tgui::Color value;
+        scheduler.animate(tgui::Color{0, 0, 0, 255}, tgui::Color{200, 100, 50, 55}, sf::milliseconds(100), [&](tgui::Color c){ value = c; });
+        scheduler.update(sf::milliseconds(50));
+        REQUIRE(value == tgui::Color(100, 50, 25, 155));
+        scheduler.update(sf::milliseconds(50));
+        REQUIRE(value == tgui::Color(200, 100, 50, 55));
+    }
+
+    SECTION("Easing") {
+        float value = 0;
+        SECTION("Predefined") {
+            scheduler.animate(0.f, 100.f, sf::milliseconds(100), [&](float v){ value = v; }, tgui::Easing::EaseIn);
+            scheduler.update(sf::milliseconds(50));
+            REQUIRE(tgui::compareFloats(value, 25));
+        }
+
+        SECTION("Custom") {
+            scheduler.animate(0.f, 100.f, sf::milliseconds(100), [&](float v){ value = v; }, [](float t){ return 1 - t; });
+            scheduler.update(sf::milliseconds(25));
+            REQUIRE(tgui::compareFloats(value, 75));
+
+            // The end value is always reached
+            scheduler.update(sf::milliseconds(75));
+            REQUIRE(value == 100);
+        }
+
+        REQUIRE(tgui::compareFloats(tgui::AnimationScheduler::getEasingFunction(tgui::Easing::EaseOut)(0.5f), 0.75f));
+        REQUIRE(tgui::AnimationScheduler::getEasingFunction(tgui::Easing::Smoothstep)(0) == 0);
+        REQUIRE(tgui::AnimationScheduler::getEasingFunction(tgui::Easing::CubicInOut)(1) == 1);
+    }
+
+    SECTION("Finish and stop") {
+        float value1 = 0;
+        float value2 = 0;
+        unsigned int finishedCount = 0;
+        const auto id1 = scheduler.animate(0.f, 10.f, sf::seconds(1), [&](float v){ value1 = v; }, tgui::Easing::Linear, [&]{ ++finishedCount; });
+        const auto id2 = scheduler.animate(0.f, 10.f, sf::seconds(1), [&](float v){ value2 = v; }, tgui::Easing::Linear, [&]{ ++finishedCount; });
+
+        REQUIRE(scheduler.finish(id1));
+        REQUIRE(value1 == 10);
+        REQUIRE(finishedCount == 1);
+        REQUIRE(!scheduler.finish(id1));
+
+        REQUIRE(scheduler.stop(id2));
+        REQUIRE(!scheduler.stop(id2));
+        REQUIRE(scheduler.getAnimationCount() == 0);
+
+        scheduler.update(sf::seconds(2));
+        REQUIRE(value2 == 0);
+        REQUIRE(finishedCount == 1);
+    }
+
+    SECTION("Changing animations while updating") {
+        std::vector<float> values(3, 0);
+        tgui::AnimationScheduler::Id id3 = 0;
+        const auto id2 = scheduler.animate(0.f, 10.f, sf::seconds(1), [&](float v){ values[1] = v; });
+        scheduler.animate(0.f, 10.f, sf::seconds(1), [&](float v){
+                values[0] = v;
+                scheduler.stop(id2);
+                if (!id3)
+                    id3 = scheduler.animate(0.f, 10.f, sf::seconds(1), [&](float v2){ values[2] = v2; });
+            });
+
+        scheduler.update(sf::milliseconds(500));
+        REQUIRE(values[0] == 5);
+        REQUIRE(values[1] == 5);
+        REQUIRE(values[2] == 0);
+        REQUIRE(!scheduler.isRunning(id2));
+        REQUIRE(scheduler.isRunning(id3));
+
+        scheduler.update(sf::milliseconds(500));
+        REQUIRE(values[0] == 10);
+        REQUIRE(values[1] == 5);
+        REQUIRE(values[2] == 5);
+    }
+
+    SECTION("Many animations") {
+        std::vector<float> values(5000, 0);
+        for (unsigned int i = 0; i < values.size(); ++i)
+            scheduler.animate(0.f, 1.f, sf::milliseconds(1 + i), [&values,i](float v){ values[i] = v; });
+
+        REQUIRE(scheduler.getAnimationCount() == 5000);
+        scheduler.update(sf::milliseconds(2500));
+        REQUIRE(scheduler.getAnimationCount() == 2500);
+        REQUIRE(values[0] == 1);
+        REQUIRE(values[2499] == 1);
+        REQUIRE(tgui::compareFloats(values[4999], 0.5f));
+
+        scheduler.update(sf::milliseconds(2500));
+        REQUIRE(scheduler.getAnimationCount() == 0);
+        REQUIRE(values[4999] == 1);
+    }
+
+    SECTION("Gui") {
+        tgui::Gui gui;
+        auto widget = tgui::ClickableWidget::create();
+        widget->setPosition(30, 15);
+        gui.add(widget);
+
+        // Show animations of widgets in the gui run on the scheduler of the gui
+        widget->showWithEffect(tgui::ShowAnimationType::SlideFromLeft, sf::milliseconds(300));
+        REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 1);
+
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+        REQUIRE(gui.getAnimationScheduler().getAnimationCount() == 0);
+    }
+}
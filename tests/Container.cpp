@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <fstream>
 
 TEST_CASE("[Container]")
 {
@@ -71,6 +72,17 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetNames()[0] == "widget1");
         REQUIRE(container->getWidgetNames()[1] == "");
         REQUIRE(container->getWidgetNames()[2] == "widget3");
+
+        // Reserving storage doesn't add widgets
+        auto group = tgui::Group::create();
+        auto first = tgui::ClickableWidget::create();
+        group->add(first);
+        group->reserveWidgets(100);
+        REQUIRE(group->getWidgets().size() == 1);
+        for (unsigned int i = 0; i < 100; ++i)
+            group->add(tgui::ClickableWidget::create());
+        REQUIRE(group->getWidgets().size() == 101);
+        REQUIRE(group->getWidgets()[0] == first);
     }
 
     SECTION("get")
@@ -130,6 +142,57 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("renaming")
+        {
+            auto child = tgui::Label::create();
+            container->add(child, "name");
+
+            REQUIRE(container->setWidgetName(widget3, "name"));
+            REQUIRE(container->get("name") == widget3);
+            REQUIRE(container->get("w3") == nullptr);
+
+            REQUIRE(container->setWidgetName(widget3, "w3"));
+            REQUIRE(container->get("name") == child);
+            REQUIRE(container->get("w3") == widget3);
+        }
+
+        SECTION("names differing in case")
+        {
+            auto child1 = tgui::Label::create();
+            auto child2 = tgui::Label::create();
+            container->add(child1, "Name");
+            container->add(child2, "name");
+            REQUIRE(container->get("Name") == child1);
+            REQUIRE(container->get("name") == child2);
+            REQUIRE(container->get("NAME") == nullptr);
+
+            container->remove(child1);
+            REQUIRE(container->get("Name") == nullptr);
+            REQUIRE(container->get("name") == child2);
+        }
+
+        SECTION("path")
+        {
+            auto panel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            widget2->add(panel, "Inner");
+            panel->add(label, "w4");
+
+            REQUIRE(container->get("w2.w5") == widget5);
+            REQUIRE(container->get("w2.Inner") == panel);
+            REQUIRE(container->get("w2.Inner.w4") == label);
+            REQUIRE(container->get("w2.w4") == widget4);
+            REQUIRE(container->get("w2.Inner.w5") == nullptr);
+            REQUIRE(container->get("w1.w4") == nullptr);
+            REQUIRE(container->get("w2.") == nullptr);
+
+            // A widget of which the name contains a dot is still found
+            auto child = tgui::Label::create();
+            panel->add(child, "w2.w5");
+            REQUIRE(container->get("w2.w5") == widget5);
+            REQUIRE(widget2->get("w2.w5") == child);
+        }
     }
 
     SECTION("remove")
@@ -265,6 +328,418 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("spatial index")
+    {
+        auto group = tgui::Group::create({2000, 2000});
+        REQUIRE(!group->isSpatialIndexEnabled());
+        group->setSpatialIndexEnabled(true, 50);
+        REQUIRE(group->isSpatialIndexEnabled());
+
+        std::vector<unsigned int> clickCount(100, 0);
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({40, 40});
+            widget->setPosition({(i % 10) * 50.f, (i / 10) * 50.f});
+            widget->connect("Clicked", [&clickCount,i]{ clickCount[i]++; });
+            group->add(widget);
+            widgets.push_back(widget);
+        }
+
+        unsigned int bigWidgetClickCount = 0;
+        auto bigWidget = tgui::ClickableWidget::create({1000, 1000});
+        bigWidget->connect("Clicked", [&]{ bigWidgetClickCount++; });
+
+        auto click = [&](tgui::Vector2f pos){
+                group->leftMousePressed(pos);
+                group->leftMouseReleased(pos);
+                group->mouseNoLongerDown();
+            };
+
+        auto totalClickCount = [&]{
+                unsigned int count = bigWidgetClickCount;
+                for (auto c : clickCount)
+                    count += c;
+                return count;
+            };
+
+        click({70, 80});
+        REQUIRE(clickCount[11] == 1);
+        REQUIRE(totalClickCount() == 1);
+
+        // Clicking between the widgets
+        click({45, 45});
+        REQUIRE(totalClickCount() == 1);
+
+        // Widgets in front are found first, even when they are too large to be stored in the grid cells
+        group->add(bigWidget);
+        click({70, 80});
+        REQUIRE(bigWidgetClickCount == 1);
+        REQUIRE(totalClickCount() == 2);
+
+        bigWidget->moveToBack();
+        click({70, 80});
+        REQUIRE(clickCount[11] == 2);
+        REQUIRE(totalClickCount() == 3);
+
+        group->remove(bigWidget);
+        click({1500, 1500});
+        REQUIRE(totalClickCount() == 3);
+
+        // The index is updated when a widget moves or is resized
+        widgets[0]->setPosition({1480, 1480});
+        click({1500, 1500});
+        REQUIRE(clickCount[0] == 1);
+        click({10, 10});
+        REQUIRE(totalClickCount() == 4);
+
+        widgets[1]->setSize({250, 250});
+        click({220, 220});
+        REQUIRE(clickCount[1] == 0);
+        REQUIRE(clickCount[44] == 1);
+        widgets[44]->setVisible(false);
+        click({220, 220});
+        REQUIRE(clickCount[1] == 1);
+        REQUIRE(totalClickCount() == 6);
+
+        // The widget on which the mouse went down keeps receiving mouse move events while dragging
+        auto slider = tgui::Slider::create(0, 10);
+        slider->setPosition({0, 1900});
+        slider->setSize({200, 20});
+        group->add(slider);
+        group->leftMousePressed({2, 1910});
+        group->mouseMoved({100, 1700});
+        REQUIRE(slider->getValue() == 5);
+        group->leftMouseReleased({100, 1700});
+        group->mouseNoLongerDown();
+        group->mouseMoved({200, 1700});
+        REQUIRE(slider->getValue() == 5);
+
+        // Copying the container also copies the index setting
+        auto copiedGroup = tgui::Group::copy(group);
+        REQUIRE(copiedGroup->isSpatialIndexEnabled());
+
+        group->setSpatialIndexEnabled(false);
+        REQUIRE(!group->isSpatialIndexEnabled());
+        click({220, 220});
+        REQUIRE(clickCount[1] == 2);
+    }
+
+    SECTION("spatial index after reordering")
+    {
+        auto layout = tgui::VerticalLayout::create({100, 300});
+        layout->setSpatialIndexEnabled(true, 50);
+
+        std::vector<unsigned int> clickCount(3, 0);
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create();
+            widget->connect("Clicked", [&clickCount,i]{ clickCount[i]++; });
+            widgets.push_back(widget);
+        }
+
+        auto click = [&](tgui::Vector2f pos){
+                layout->leftMousePressed(pos);
+                layout->leftMouseReleased(pos);
+                layout->mouseNoLongerDown();
+            };
+
+        layout->add(widgets[0]);
+        layout->add(widgets[1]);
+        click({50, 20});
+        click({50, 280});
+        REQUIRE(clickCount == std::vector<unsigned int>{1, 1, 0});
+
+        // Inserting a widget in front of the others changes the indices of all widgets in the layout
+        layout->insert(0, widgets[2]);
+        REQUIRE(layout->get(0) == widgets[2]);
+        click({50, 20});
+        click({50, 150});
+        click({50, 280});
+        REQUIRE(clickCount == std::vector<unsigned int>{2, 2, 1});
+    }
+
+    SECTION("spatial index after the full size changes")
+    {
+        auto group = tgui::Group::create({400, 100});
+        group->setSpatialIndexEnabled(true, 50);
+
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setSize({20, 20});
+        radioButton->setTextSize(16);
+        group->add(radioButton);
+
+        auto click = [&](tgui::Vector2f pos){
+                group->leftMousePressed(pos);
+                group->leftMouseReleased(pos);
+                group->mouseNoLongerDown();
+            };
+
+        click({150, 10});
+        REQUIRE(!radioButton->isChecked());
+
+        // The text next to the radio button can be clicked as soon as it is long enough
+        radioButton->setText("Text that reaches several cells further");
+        REQUIRE(radioButton->getFullSize().x > 200);
+        click({150, 10});
+        REQUIRE(radioButton->isChecked());
+
+        radioButton->setChecked(false);
+        radioButton->setText("");
+        click({150, 10});
+        REQUIRE(!radioButton->isChecked());
+
+        // Moving the text further away with the renderer also updates the index
+        radioButton->setText("Text");
+        click({150, 10});
+        REQUIRE(!radioButton->isChecked());
+        radioButton->getRenderer()->setTextDistanceRatio(6);
+        click({150, 10});
+        REQUIRE(radioButton->isChecked());
+    }
+
+    SECTION("update")
+    {
+        struct TimeDependentWidget : public tgui::ClickableWidget
+        {
+            void setTimeDependent(bool timeDependent)
+            {
+                m_needsUpdates = timeDependent;
+                updateTimeDependency();
+            }
+
+            void update(sf::Time elapsedTime) override
+            {
+                ClickableWidget::update(elapsedTime);
+                updateCount++;
+            }
+
+            bool isTimeDependent() const override
+            {
+                return ClickableWidget::isTimeDependent() || m_needsUpdates;
+            }
+
+            unsigned int updateCount = 0;
+            bool m_needsUpdates = false;
+        };
+
+        auto outerGroup = tgui::Group::create();
+        auto innerGroup = tgui::Group::create();
+        auto widget = std::make_shared<TimeDependentWidget>();
+        auto otherWidget = std::make_shared<TimeDependentWidget>();
+        outerGroup->add(innerGroup);
+        innerGroup->add(widget);
+        innerGroup->add(otherWidget);
+
+        // Widgets are only updated while they are time-dependent
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 0);
+
+        widget->setTimeDependent(true);
+        outerGroup->update(sf::milliseconds(10));
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 2);
+        REQUIRE(otherWidget->updateCount == 0);
+
+        widget->setTimeDependent(false);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 2);
+
+        // Widgets that were already time-dependent are registered when added
+        innerGroup->remove(widget);
+        widget->setTimeDependent(true);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 2);
+        innerGroup->add(widget);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 3);
+
+        // Invisible widgets aren't updated
+        innerGroup->setVisible(false);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 3);
+        innerGroup->setVisible(true);
+
+        innerGroup->remove(widget);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(widget->updateCount == 3);
+
+        // Widgets are time-dependent while they are being animated
+        otherWidget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        outerGroup->update(sf::milliseconds(60));
+        REQUIRE(otherWidget->updateCount == 1);
+        outerGroup->update(sf::milliseconds(60));
+        REQUIRE(otherWidget->updateCount == 2);
+        outerGroup->update(sf::milliseconds(60));
+        REQUIRE(otherWidget->updateCount == 2);
+
+        // Custom widgets that only override update can register to be updated every frame
+        struct UpdatedWidget : public tgui::ClickableWidget
+        {
+            UpdatedWidget()
+            {
+                setUpdatedEveryFrame(true);
+            }
+
+            void update(sf::Time elapsedTime) override
+            {
+                ClickableWidget::update(elapsedTime);
+                updateCount++;
+            }
+
+            unsigned int updateCount = 0;
+        };
+
+        auto updatedWidget = std::make_shared<UpdatedWidget>();
+        innerGroup->add(updatedWidget);
+        outerGroup->update(sf::milliseconds(10));
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(updatedWidget->updateCount == 2);
+
+        auto copiedWidget = std::make_shared<UpdatedWidget>(*updatedWidget);
+        copiedWidget->updateCount = 0;
+        innerGroup->add(copiedWidget);
+        outerGroup->update(sf::milliseconds(10));
+        REQUIRE(copiedWidget->updateCount == 1);
+    }
+
+    SECTION("load and save widgets")
+    {
+        widget1->setText("Label 1");
+        widget2->setSize(200, 100);
+
+        std::stringstream stream;
+        container->saveWidgetsToStream(stream);
+
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(stream);
+        REQUIRE(group->getWidgets().size() == 3);
+        REQUIRE(group->get<tgui::Label>("w1")->getText() == "Label 1");
+        REQUIRE(group->get<tgui::Panel>("w2")->getSize() == sf::Vector2f(200, 100));
+        REQUIRE(group->get<tgui::Panel>("w2")->getWidgets().size() == 2);
+        REQUIRE(group->get("w2.w5") != nullptr);
+
+        // Saving again gives the same result
+        std::stringstream stream2;
+        group->saveWidgetsToStream(stream2);
+        REQUIRE(stream2.str() == stream.str());
+
+        // The existing widgets are kept when the stream contains an error
+        std::stringstream invalidStream{"Label.First { Text = \"1\"; }\nLabel.Second { Text = \"2\"; }\nLabel.Third {"};
+        REQUIRE_THROWS_AS(group->loadWidgetsFromStream(invalidStream), tgui::Exception);
+        REQUIRE(group->getWidgets().size() == 3);
+        REQUIRE(group->get<tgui::Label>("w1")->getText() == "Label 1");
+
+        std::stringstream invalidWidgetStream{"Label.First { Text = \"1\"; }\nNonexistentWidget.Second {}"};
+        REQUIRE_THROWS_AS(group->loadWidgetsFromStream(invalidWidgetStream), tgui::Exception);
+        REQUIRE(group->getWidgets().size() == 3);
+    }
+
+    SECTION("load hidden widgets lazily")
+    {
+        const std::string form = "Panel.Page1 {\n"
+                                 "    Label.Title { Text = \"Page 1\"; }\n"
+                                 "}\n"
+                                 "Panel.Page2 {\n"
+                                 "    Visible = false;\n"
+                                 "    Label.Title { Text = \"Page 2\"; }\n"
+                                 "    Panel.Nested {\n"
+                                 "        Visible = false;\n"
+                                 "        Button.Button { Text = \"Nested\"; }\n"
+                                 "    }\n"
+                                 "}\n"
+                                 "ChildWindow.Window {\n"
+                                 "    Visible = false;\n"
+                                 "    Label.Text { Text = \"Window\"; }\n"
+                                 "}\n";
+
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(std::stringstream{form}, true);
+        REQUIRE(group->getWidgets().size() == 3);
+
+        // The widgets inside hidden containers are created when the container is shown
+        auto page1 = std::static_pointer_cast<tgui::Panel>(group->getWidgets()[0]);
+        auto page2 = std::static_pointer_cast<tgui::Panel>(group->getWidgets()[1]);
+        REQUIRE(page1->getWidgets().size() == 1);
+        page2->setVisible(true);
+        REQUIRE(page2->getWidgets().size() == 2);
+        REQUIRE(page2->get<tgui::Label>("Title")->getText() == "Page 2");
+
+        // Nested hidden containers stay lazy, but accessing their widgets creates them
+        REQUIRE(group->get<tgui::Button>("Page2.Nested.Button")->getText() == "Nested");
+
+        auto window = std::static_pointer_cast<tgui::ChildWindow>(group->getWidgets()[2]);
+        window->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(100));
+        REQUIRE(window->getWidgets().size() == 1);
+
+        // Saving a lazily loaded form gives the same result as saving a form that was loaded at once
+        auto lazyGroup = tgui::Group::create();
+        lazyGroup->loadWidgetsFromStream(std::stringstream{form}, true);
+        auto eagerGroup = tgui::Group::create();
+        eagerGroup->loadWidgetsFromStream(std::stringstream{form});
+
+        std::stringstream lazyStream;
+        std::stringstream eagerStream;
+        lazyGroup->saveWidgetsToStream(lazyStream);
+        eagerGroup->saveWidgetsToStream(eagerStream);
+        REQUIRE(lazyStream.str() == eagerStream.str());
+
+        // Errors in sections of hidden containers are only found when the widgets are created
+        auto invalidGroup = tgui::Group::create();
+        REQUIRE_NOTHROW(invalidGroup->loadWidgetsFromStream(std::stringstream{"Panel.Hidden { Visible = false; Unknown.Widget {} }"}, true));
+        REQUIRE_THROWS_AS(invalidGroup->get<tgui::Panel>("Hidden")->setVisible(true), tgui::Exception);
+    }
+
+    SECTION("binary form")
+    {
+        auto group = tgui::Group::create();
+        group->loadWidgetsFromStream(std::stringstream{"Renderer.1 { TextColor = Red; }\n"
+                                                       "Button.Ok { Text = \"Ok\"; Renderer = &1; }\n"
+                                                       "Panel.Panel {\n"
+                                                       "    Visible = false;\n"
+                                                       "    Label.Text { Text = \"Text\"; Renderer = &1; }\n"
+                                                       "    ListBox.List { Items = [\"a, b\", c]; }\n"
+                                                       "}\n"});
+
+        std::stringstream textStream;
+        group->saveWidgetsToStream(textStream);
+
+        // Loading the binary form gives the same widgets as loading the text format
+        std::stringstream binaryStream;
+        group->saveWidgetsToBinaryStream(binaryStream);
+        REQUIRE(binaryStream.str().size() < textStream.str().size());
+
+        auto binaryGroup = tgui::Group::create();
+        binaryGroup->loadWidgetsFromBinaryStream(binaryStream);
+        std::stringstream binaryTextStream;
+        binaryGroup->saveWidgetsToStream(binaryTextStream);
+        REQUIRE(binaryTextStream.str() == textStream.str());
+
+        std::ofstream{"WidgetFileBinaryForm.bin", std::ios::binary} << binaryStream.str();
+        auto fileGroup = tgui::Group::create();
+        REQUIRE_NOTHROW(fileGroup->loadWidgetsFromFile("WidgetFileBinaryForm.bin"));
+        REQUIRE(fileGroup->get<tgui::ListBox>("Panel.List")->getItemCount() == 2);
+
+        // Restoring a snapshot replaces all widgets
+        const std::string snapshot = group->saveSnapshot();
+        group->get<tgui::Button>("Ok")->setText("Changed");
+        group->add(tgui::Button::create(), "Extra");
+        group->restoreSnapshot(snapshot);
+        REQUIRE(group->getWidgets().size() == 2);
+        REQUIRE(group->get<tgui::Button>("Ok")->getText() == "Ok");
+
+        std::stringstream restoredStream;
+        group->saveWidgetsToStream(restoredStream);
+        REQUIRE(restoredStream.str() == textStream.str());
+
+        // A corrupt snapshot leaves the container unchanged
+        REQUIRE_THROWS_AS(group->restoreSnapshot("Button.Ok {}"), tgui::Exception);
+        REQUIRE_THROWS_AS(group->restoreSnapshot(snapshot.substr(0, snapshot.size() / 2)), tgui::Exception);
+        REQUIRE(group->getWidgets().size() == 2);
+        REQUIRE(group->get<tgui::Button>("Ok")->getText() == "Ok");
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
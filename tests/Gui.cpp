@@ -0,0 +1,195 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <sstream>
+#include <thread>
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 100);
+    tgui::Gui gui{target};
+
+    SECTION("Posting functions")
+    {
+        std::vector<int> order;
+        gui.post([&]{ order.push_back(1); });
+        gui.post([&]{ order.push_back(2); });
+        REQUIRE(order.empty());
+
+        gui.draw();
+        REQUIRE(order == std::vector<int>{1, 2});
+
+        gui.post([&]{ order.push_back(3); });
+        sf::Event event;
+        event.type = sf::Event::GainedFocus;
+        gui.handleEvent(event);
+        REQUIRE(order == std::vector<int>{1, 2, 3});
+
+        // Functions that are posted while executing a posted function are executed the next time
+        gui.post([&]{ order.push_back(4); gui.post([&]{ order.push_back(5); }); });
+        gui.processPostedFunctions();
+        REQUIRE(order == std::vector<int>{1, 2, 3, 4});
+        gui.processPostedFunctions();
+        REQUIRE(order == std::vector<int>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("Posted function that throws")
+    {
+        std::vector<int> order;
+        gui.post([&]{ order.push_back(1); throw std::runtime_error{"Posted function failed"}; });
+        gui.post([&]{ order.push_back(2); });
+
+        REQUIRE_THROWS_AS(gui.processPostedFunctions(), std::runtime_error);
+        REQUIRE(order == std::vector<int>{1});
+
+        // The remaining function is still executed the next time the queue is processed
+        gui.processPostedFunctions();
+        REQUIRE(order == std::vector<int>{1, 2});
+    }
+
+    SECTION("Coalescing updates")
+    {
+        auto progressBar = tgui::ProgressBar::create();
+        gui.add(progressBar);
+
+        unsigned int callCount = 0;
+        std::vector<int> order;
+        gui.post([&]{ order.push_back(1); });
+        for (unsigned int i = 0; i <= 50; ++i)
+            gui.post([=,&callCount]{ callCount++; progressBar->setValue(i); }, progressBar.get());
+        gui.post([&]{ order.push_back(2); });
+
+        gui.draw();
+        REQUIRE(callCount == 1);
+        REQUIRE(progressBar->getValue() == 50);
+        REQUIRE(order == std::vector<int>{1, 2});
+    }
+
+    SECTION("Time budget")
+    {
+        REQUIRE(gui.getPostedFunctionsTimeBudget() == sf::Time::Zero);
+        gui.setPostedFunctionsTimeBudget(sf::microseconds(1));
+        REQUIRE(gui.getPostedFunctionsTimeBudget() == sf::microseconds(1));
+
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < 3; ++i)
+            gui.post([&]{ std::this_thread::sleep_for(std::chrono::milliseconds(1)); count++; });
+
+        // At least one function is executed, even when the budget is exceeded
+        gui.processPostedFunctions();
+        REQUIRE(count == 1);
+        gui.processPostedFunctions();
+        gui.processPostedFunctions();
+        REQUIRE(count == 3);
+    }
+
+    SECTION("Posting from other threads")
+    {
+        std::vector<unsigned int> values;
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&gui,&values,t]{
+                for (unsigned int i = 0; i < 1000; ++i)
+                    gui.post([&values,t,i]{ values.push_back(t * 1000 + i); });
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        gui.processPostedFunctions();
+        REQUIRE(values.size() == 4000);
+
+        // Functions posted from the same thread are executed in the same order
+        std::vector<unsigned int> lastValuePerThread(4, 0);
+        for (unsigned int value : values)
+        {
+            REQUIRE(value >= lastValuePerThread[value / 1000]);
+            lastValuePerThread[value / 1000] = value;
+        }
+    }
+
+    SECTION("Profiling")
+    {
+        auto panel = tgui::Panel::create();
+        panel->add(tgui::Button::create("Inner"));
+        gui.add(panel);
+        gui.add(tgui::Button::create("Outer"));
+
+        REQUIRE(!gui.isProfilingEnabled());
+        gui.draw();
+        REQUIRE(gui.getFrameStatistics().drawCalls == 0);
+        REQUIRE(gui.getFrameStatistics().widgetTypes.empty());
+
+        gui.setProfilingEnabled(true);
+        REQUIRE(gui.isProfilingEnabled());
+
+    #ifdef TGUI_ENABLE_PROFILER
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 10;
+        event.mouseMove.y = 10;
+        gui.handleEvent(event);
+        gui.draw();
+
+        const tgui::FrameStatistics& statistics = gui.getFrameStatistics();
+        REQUIRE(statistics.events == 1);
+        REQUIRE(statistics.drawCalls > 0);
+        REQUIRE(statistics.vertices > 0);
+        REQUIRE(statistics.widgetTypes.at("Button").draw.count == 2);
+        REQUIRE(statistics.widgetTypes.at("Panel").draw.count == 1);
+        REQUIRE(statistics.widgetTypes.at("Panel").draw.selfTime <= statistics.widgetTypes.at("Panel").draw.time);
+
+        // Statistics only contain the last frame
+        gui.draw();
+        REQUIRE(gui.getFrameStatistics().events == 0);
+        REQUIRE(gui.getFrameStatistics().widgetTypes.at("Button").draw.count == 2);
+
+        // Renderer changes are measured as well
+        panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+        gui.draw();
+        REQUIRE(gui.getFrameStatistics().widgetTypes.at("Panel").rendererChanged.count == 1);
+
+        std::stringstream stream;
+        gui.startChromeTrace();
+        gui.draw();
+        gui.stopChromeTrace(stream);
+        const std::string trace = stream.str();
+        REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+        REQUIRE(trace.find("\"name\":\"Gui::draw\"") != std::string::npos);
+        REQUIRE(trace.find("\"name\":\"Button\",\"cat\":\"draw\"") != std::string::npos);
+        REQUIRE(trace.find("\"ph\":\"C\"") != std::string::npos);
+    #endif
+
+        gui.setProfilingEnabled(false);
+        gui.draw();
+        REQUIRE(gui.getFrameStatistics().drawCalls == 0);
+    }
+}
@@ -27,6 +27,8 @@
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Gui.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Err.hpp>
+#include <sstream>
 
 using namespace tgui::bind_functions;
 using tgui::Layout;
@@ -360,6 +362,158 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Recalculating layouts")
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        auto button1 = std::make_shared<tgui::Button>();
+        auto button2 = std::make_shared<tgui::Button>();
+        auto button3 = std::make_shared<tgui::Button>();
+        panel->add(button1, "b1");
+        panel->add(button2, "b2");
+        panel->add(button3, "b3");
+
+        SECTION("Each layout is only recalculated once")
+        {
+            button1->setSize({"&.w / 2", "&.h"});
+            button2->setSize({"&.w / 4", "&.h"});
+            button3->setSize({"b1.w + b2.w + &.w", "&.h"});
+
+            unsigned int sizeChangeCount = 0;
+            button3->connect("SizeChanged", [&]{ sizeChangeCount++; });
+
+            panel->setSize(400, 100);
+            REQUIRE(sizeChangeCount == 1);
+            REQUIRE(button3->getSize() == sf::Vector2f(700, 100));
+
+            button3->disconnectAll("SizeChanged");
+        }
+
+        SECTION("Deferred updates")
+        {
+            sf::RenderTexture texture;
+            texture.create(20, 15);
+            tgui::Gui gui{texture};
+            gui.add(panel);
+
+            button1->setSize({"&.w / 2", "&.h"});
+            button2->setSize({"b1.size"});
+
+            panel->setSize(100, 40);
+            REQUIRE(button2->getSize() == sf::Vector2f(50, 40));
+
+            REQUIRE(!gui.getLayoutUpdatesDeferred());
+            gui.setLayoutUpdatesDeferred(true);
+            REQUIRE(gui.getLayoutUpdatesDeferred());
+
+            panel->setSize(400, 100);
+            panel->setSize(300, 200);
+            REQUIRE(panel->getSize() == sf::Vector2f(300, 200));
+            REQUIRE(button1->getSize() == sf::Vector2f(50, 40));
+            REQUIRE(button2->getSize() == sf::Vector2f(50, 40));
+
+            gui.draw();
+            REQUIRE(button1->getSize() == sf::Vector2f(150, 200));
+            REQUIRE(button2->getSize() == sf::Vector2f(150, 200));
+
+            panel->setSize(120, 50);
+            gui.updateLayouts();
+            REQUIRE(button2->getSize() == sf::Vector2f(60, 50));
+
+            panel->setSize(200, 50);
+            gui.setLayoutUpdatesDeferred(false);
+            REQUIRE(button2->getSize() == sf::Vector2f(100, 50));
+        }
+
+        SECTION("Deferred updates only affect their own gui")
+        {
+            sf::RenderTexture texture;
+            texture.create(20, 15);
+            tgui::Gui gui1{texture};
+            tgui::Gui gui2{texture};
+            gui1.add(panel);
+
+            auto panel2 = tgui::Panel::create({100, 40});
+            auto button4 = tgui::Button::create();
+            button4->setSize({"&.w / 2", "&.h"});
+            panel2->add(button4);
+            gui2.add(panel2);
+
+            button1->setSize({"&.w / 2", "&.h"});
+            panel->setSize(100, 40);
+            REQUIRE(button1->getSize() == sf::Vector2f(50, 40));
+            REQUIRE(button4->getSize() == sf::Vector2f(50, 40));
+
+            gui1.setLayoutUpdatesDeferred(true);
+            panel->setSize(200, 80);
+            panel2->setSize(200, 80);
+            REQUIRE(button1->getSize() == sf::Vector2f(50, 40));
+            REQUIRE(button4->getSize() == sf::Vector2f(100, 80));
+
+            gui2.updateLayouts();
+            REQUIRE(button1->getSize() == sf::Vector2f(50, 40));
+
+            gui1.updateLayouts();
+            REQUIRE(button1->getSize() == sf::Vector2f(100, 80));
+
+            // Postponed layouts are recalculated when the widget is moved to a gui that doesn't defer its updates
+            panel->setSize(300, 100);
+            REQUIRE(button1->getSize() == sf::Vector2f(100, 80));
+            gui1.remove(panel);
+            gui2.add(panel);
+            gui1.updateLayouts();
+            REQUIRE(button1->getSize() == sf::Vector2f(150, 100));
+            gui1.setLayoutUpdatesDeferred(false);
+        }
+
+        SECTION("Circular dependency")
+        {
+            std::stringstream errorStream;
+            std::streambuf* oldbuf = sf::err().rdbuf(errorStream.rdbuf());
+
+            tgui::Layout::clearCircularDependency();
+            REQUIRE(tgui::Layout::getCircularDependency() == "");
+
+            button1->setSize({"b2.w + 10", "10"});
+            REQUIRE(tgui::Layout::getCircularDependency() == "");
+            button2->setSize({"b1.w + 10", "10"});
+            REQUIRE(tgui::Layout::getCircularDependency() == "b2.size depends on b1.size depends on b2.size");
+            REQUIRE(errorStream.str() == "TGUI Warning: circular dependency between layouts: b2.size depends on b1.size depends on b2.size.\n");
+
+            // The layouts that aren't part of the cycle are still recalculated
+            button3->setSize({"b1.w", "b2.h"});
+            REQUIRE(button3->getSize() == sf::Vector2f(button1->getSize().x, 10));
+
+            // The cycle is remembered until it is cleared
+            REQUIRE(tgui::Layout::getCircularDependency() == "b2.size depends on b1.size depends on b2.size");
+            tgui::Layout::clearCircularDependency();
+            REQUIRE(tgui::Layout::getCircularDependency() == "");
+
+            panel->removeAllWidgets();
+            button1 = nullptr;
+            button2 = nullptr;
+            sf::err().rdbuf(oldbuf);
+        }
+
+        SECTION("Circular dependency between three layouts")
+        {
+            std::stringstream errorStream;
+            std::streambuf* oldbuf = sf::err().rdbuf(errorStream.rdbuf());
+
+            tgui::Layout::clearCircularDependency();
+            button1->setSize({"b3.w + 10", "10"});
+            button2->setSize({"b1.w + 10", "10"});
+            button3->setSize({"b2.w + 10", "10"});
+            REQUIRE(tgui::Layout::getCircularDependency() == "b3.size depends on b2.size depends on b1.size depends on b3.size");
+            tgui::Layout::clearCircularDependency();
+
+            panel->removeAllWidgets();
+            button1 = nullptr;
+            button2 = nullptr;
+            button3 = nullptr;
+            sf::err().rdbuf(oldbuf);
+        }
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -0,0 +1,130 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Loading/BinaryForm.hpp>
+#include <sstream>
+
+namespace
+{
+    std::string toBinaryForm(const std::string& input)
+    {
+        std::stringstream textStream{input};
+        const auto rootNode = tgui::DataIO::parse(textStream);
+
+        std::stringstream binaryStream;
+        tgui::BinaryForm::emit(*rootNode, binaryStream);
+        return binaryStream.str();
+    }
+
+    struct RecordingVisitor : public tgui::DataIO::Visitor
+    {
+        void beginNode(const std::string& name) override
+        {
+            events.push_back("begin " + name);
+        }
+
+        void property(const std::string& key, std::unique_ptr<tgui::DataIO::ValueNode> value) override
+        {
+            if (value->listNode)
+                events.push_back(key + " = [" + tgui::to_string(value->valueList.size()) + "]");
+            else
+                events.push_back(key + " = " + value->value.toAnsiString());
+        }
+
+        void endNode() override
+        {
+            events.push_back("end");
+        }
+
+        std::vector<std::string> events;
+    };
+}
+
+TEST_CASE("[BinaryForm]")
+{
+    SECTION("Same result as DataIO")
+    {
+        testSameTreeAsDataIO([](const std::string& input){
+                std::stringstream binaryStream{toBinaryForm(input)};
+                REQUIRE(tgui::BinaryForm::isBinaryForm(binaryStream));
+                return tgui::BinaryForm::parse(binaryStream);
+            });
+    }
+
+    SECTION("Visitor")
+    {
+        std::stringstream stream{toBinaryForm("Global = 5;\n"
+                                              "Button.Ok {\n"
+                                              "    Text = \"Ok\";\n"
+                                              "    Items = [a, b, c];\n"
+                                              "    Renderer { TextColor = Red; }\n"
+                                              "}\n"
+                                              "Label {}")};
+
+        RecordingVisitor visitor;
+        tgui::BinaryForm::parse(stream, visitor);
+        REQUIRE(visitor.events == std::vector<std::string>{"global = 5", "begin Button.Ok", "items = [3]", "text = \"Ok\"",
+                                                           "begin Renderer", "textcolor = Red", "end", "end", "begin Label", "end"});
+    }
+
+    SECTION("Strings are only stored once")
+    {
+        std::string input;
+        for (unsigned int i = 0; i < 50; ++i)
+            input += "Button.Button" + tgui::to_string(i) + " { Renderer { TextColor = Red; BackgroundColor = Green; } }\n";
+
+        REQUIRE(toBinaryForm(input).size() < input.size() / 2);
+    }
+
+    SECTION("Non-ASCII characters")
+    {
+        const std::string utf8 = u8"\u00E9t\u00E9 \u20AC";
+        auto rootNode = std::make_unique<tgui::DataIO::Node>();
+        rootNode->propertyValuePairs["Text"] = std::make_unique<tgui::DataIO::ValueNode>(sf::String::fromUtf8(utf8.begin(), utf8.end()));
+
+        std::stringstream stream;
+        tgui::BinaryForm::emit(*rootNode, stream);
+        const auto tree = tgui::BinaryForm::parse(stream);
+        REQUIRE(tree->propertyValuePairs["text"]->value == rootNode->propertyValuePairs["Text"]->value);
+    }
+
+    SECTION("Errors")
+    {
+        std::stringstream textStream{"Text = Value;"};
+        REQUIRE(!tgui::BinaryForm::isBinaryForm(textStream));
+        REQUIRE(textStream.tellg() == 0);
+        REQUIRE_THROWS_AS(tgui::BinaryForm::parse(textStream), tgui::Exception);
+
+        const std::string binaryForm = toBinaryForm("Section { Property = Value; }");
+        for (std::size_t length = 0; length < binaryForm.size(); ++length)
+        {
+            std::stringstream stream{binaryForm.substr(0, length)};
+            REQUIRE_THROWS_AS(tgui::BinaryForm::parse(stream), tgui::Exception);
+        }
+
+        std::stringstream unknownRecord{binaryForm.substr(0, binaryForm.size() - 1) + '\x7F'};
+        REQUIRE_THROWS_AS(tgui::BinaryForm::parse(unknownRecord), tgui::Exception);
+    }
+}
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Loading/DataDocument.hpp>
+
+TEST_CASE("[DataDocument]")
+{
+    SECTION("Same result as DataIO")
+    {
+        testSameTreeAsDataIO([](const std::string& input){ return tgui::DataDocument::parse(input)->toNodeTree(); });
+    }
+
+    SECTION("Nodes")
+    {
+        const std::string input = "Global = 5;\n"
+                                  "Button.Ok {\n"
+                                  "    Text = \"Ok\";\n"
+                                  "    Size = (100, 30);\n"
+                                  "    Items = [\"a, b\", c ,d];\n"
+                                  "    Renderer { TextColor = Red; }\n"
+                                  "}\n"
+                                  "Label {}";
+
+        const auto document = tgui::DataDocument::parse(input.data(), input.size());
+        const auto& root = document->getRoot();
+        REQUIRE(root.parent == nullptr);
+        REQUIRE(root.findProperty("global") != nullptr);
+        REQUIRE(root.findProperty("global")->getValue() == "5");
+        REQUIRE(root.findProperty("Global") == nullptr);
+
+        const auto* button = root.firstChild;
+        REQUIRE(button != nullptr);
+        REQUIRE(button->name == "Button.Ok");
+        REQUIRE(button->parent == &root);
+        REQUIRE(button->nextSibling == root.lastChild);
+        REQUIRE(button->nextSibling->name == "Label");
+        REQUIRE(button->nextSibling->nextSibling == nullptr);
+
+        // Properties are stored in the order of the file
+        REQUIRE(button->firstProperty->key == "text");
+        REQUIRE(button->firstProperty->next->key == "size");
+        REQUIRE(button->firstProperty->next->next->key == "items");
+        REQUIRE(button->firstProperty->next->next->next == nullptr);
+
+        // Values refer directly to the input
+        const auto* size = button->findProperty("size");
+        REQUIRE(size->value == "(100, 30)");
+        REQUIRE(size->value.data >= input.data());
+        REQUIRE(size->value.data < input.data() + input.size());
+        REQUIRE(!size->isList());
+        REQUIRE(size->getListItems().empty());
+
+        const auto* items = button->findProperty("items");
+        REQUIRE(items->isList());
+        const auto listItems = items->getListItems();
+        REQUIRE(listItems.size() == 3);
+        REQUIRE(listItems[0] == "\"a, b\"");
+        REQUIRE(listItems[1] == "c");
+        REQUIRE(listItems[2] == "d");
+
+        REQUIRE(button->firstChild->name == "Renderer");
+        REQUIRE(button->firstChild->findProperty("textcolor")->getValue() == "Red");
+        REQUIRE(document->getArenaCapacity() > 0);
+    }
+
+    SECTION("Errors")
+    {
+        for (const std::string input : {"/ {}", "{ / }", "name", "name ", "{", "{{", "{ name{", "{ /**/ ", ";", "name;", "}",
+                                        "{ Property;", "{ Property }", "{ Property", "{;", "{ Property = Value",
+                                        "{ { Property = Value /", "{ Property= \"", "{ Property = =", "{ Property = {",
+                                        "{ Property = ; "})
+        {
+            REQUIRE_THROWS_AS(tgui::DataDocument::parse(input), tgui::Exception);
+        }
+    }
+}
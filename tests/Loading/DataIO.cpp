@@ -200,6 +200,70 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("visitor")
+    {
+        struct Visitor : public tgui::DataIO::Visitor
+        {
+            void beginNode(const std::string& name) override
+            {
+                events.push_back("begin " + name);
+            }
+
+            void property(const std::string& key, std::unique_ptr<tgui::DataIO::ValueNode> value) override
+            {
+                events.push_back(key + "=" + value->value + (value->listNode ? " (list)" : ""));
+            }
+
+            void endNode() override
+            {
+                events.push_back("end");
+            }
+
+            std::vector<std::string> events;
+        };
+
+        std::stringstream input("Global = 1; Child1 { B = 2; A = [x, y]; Nested = { C = 3; }; } { } Global = 4");
+        Visitor visitor;
+        REQUIRE_THROWS_AS(tgui::DataIO::parse(input, visitor), tgui::Exception);
+
+        // Everything in front of the error has been passed to the visitor
+        REQUIRE(visitor.events == std::vector<std::string>{"global=1", "begin Child1", "b=2", "a=[x, y] (list)", "begin Nested",
+                                                           "c=3", "end", "end", "begin ", "end"});
+    }
+
+    SECTION("Writer")
+    {
+        std::stringstream input("Global = 1; Child1 { Property = Value; Nested { A = 1; B = 2; } Empty {} } { Property = Value; }");
+        auto rootNode = tgui::DataIO::parse(input);
+
+        std::stringstream emitted;
+        tgui::DataIO::emit(rootNode, emitted);
+        REQUIRE(emitted.str() == "global = 1;\n"
+                                 "\n"
+                                 "Child1 {\n"
+                                 "    property = Value;\n"
+                                 "\n"
+                                 "    Nested {\n"
+                                 "        a = 1;\n"
+                                 "        b = 2;\n"
+                                 "    }\n"
+                                 "\n"
+                                 "    Empty {\n"
+                                 "    }\n"
+                                 "}\n"
+                                 "\n"
+                                 "{\n"
+                                 "    property = Value;\n"
+                                 "}\n");
+
+        // Parsing directly into a writer gives the same output as emitting the parsed tree
+        std::stringstream input2(emitted.str());
+        std::stringstream written;
+        tgui::DataIO::Writer writer{written};
+        tgui::DataIO::parse(input2, writer);
+        REQUIRE(written.str() == emitted.str());
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
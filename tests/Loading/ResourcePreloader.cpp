@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Loading/ResourcePreloader.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Texture.hpp>
+#include <mutex>
+#include <thread>
+
+TEST_CASE("[ResourcePreloader]")
+{
+    std::mutex mutex;
+    std::vector<std::string> loadedFiles;
+    std::vector<std::thread::id> loadingThreads;
+
+    const auto oldImageLoader = tgui::Texture::getImageLoader();
+    tgui::Texture::setImageLoader([&](const sf::String& filename){
+            std::lock_guard<std::mutex> lock(mutex);
+            loadedFiles.push_back(filename);
+            loadingThreads.push_back(std::this_thread::get_id());
+
+            auto image = std::make_unique<sf::Image>();
+            image->create(4, 3);
+            return image;
+        });
+
+    tgui::priv::ThreadPool threadPool{2};
+
+    SECTION("Images")
+    {
+        std::unique_ptr<sf::Image> image;
+        {
+            tgui::ResourcePreloader preloader{&threadPool};
+            auto future = preloader.preloadImage("resources/image.png");
+            REQUIRE(preloader.preloadImage("resources/image.png").valid());
+
+            REQUIRE(tgui::ResourcePreloader::findImage("resources/image.png", image));
+            REQUIRE(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            REQUIRE(image != nullptr);
+            REQUIRE(image->getSize() == sf::Vector2u(4, 3));
+
+            // Every caller gets its own copy of the image
+            std::unique_ptr<sf::Image> image2;
+            REQUIRE(tgui::ResourcePreloader::findImage("resources/image.png", image2));
+            REQUIRE(image2 != nullptr);
+            REQUIRE(image2.get() != image.get());
+
+            REQUIRE(!tgui::ResourcePreloader::findImage("resources/other.png", image2));
+        }
+
+        REQUIRE(loadedFiles == std::vector<std::string>{"resources/image.png"});
+        REQUIRE(loadingThreads[0] != std::this_thread::get_id());
+
+        // The image is no longer available once the preloader is gone
+        REQUIRE(!tgui::ResourcePreloader::findImage("resources/image.png", image));
+    }
+
+    SECTION("Nodes")
+    {
+        auto node = std::make_unique<tgui::DataIO::Node>();
+        node->name = "Picture.Pic";
+        node->children.push_back(std::make_unique<tgui::DataIO::Node>());
+        node->children[0]->parent = node.get();
+        node->children[0]->name = "Renderer";
+        node->children[0]->propertyValuePairs["texture"] = std::make_unique<tgui::DataIO::ValueNode>("\"resources/image.png\"");
+        node->children[0]->propertyValuePairs["opacity"] = std::make_unique<tgui::DataIO::ValueNode>("0.5");
+        node->children.push_back(std::make_unique<tgui::DataIO::Node>());
+        node->children[1]->parent = node.get();
+        node->children[1]->name = "Renderer";
+        node->children[1]->propertyValuePairs["texturebackground"] = std::make_unique<tgui::DataIO::ValueNode>("\"resources/image.png\" Part(0, 0, 2, 2)");
+        node->children[1]->propertyValuePairs["texturethumb"] = std::make_unique<tgui::DataIO::ValueNode>("None");
+
+        tgui::ResourcePreloader preloader{&threadPool};
+        const auto resources = preloader.preload(*node);
+        REQUIRE(resources.size() == 2);
+
+        resources[0].wait();
+        resources[1].wait();
+        REQUIRE(tgui::ResourcePreloader::isReady(resources));
+        REQUIRE(loadedFiles == std::vector<std::string>{"resources/image.png"});
+
+        // The texture manager uses the preloaded image instead of calling the image loader again
+        tgui::Texture texture;
+        auto textureData = tgui::TextureManager::getTexture(texture, "resources/image.png");
+        REQUIRE(textureData != nullptr);
+        REQUIRE(textureData->image->getSize() == sf::Vector2u(4, 3));
+        REQUIRE(loadedFiles.size() == 1);
+        tgui::TextureManager::removeTexture(textureData);
+    }
+
+    SECTION("Fonts")
+    {
+        tgui::ResourcePreloader preloader{&threadPool};
+        preloader.preloadFont("resources/DejaVuSans.ttf").wait();
+
+        std::shared_ptr<sf::Font> font;
+        REQUIRE(tgui::ResourcePreloader::findFont("resources/DejaVuSans.ttf", font));
+        REQUIRE(!tgui::ResourcePreloader::findFont("resources/Other.ttf", font));
+    }
+
+    tgui::Texture::setImageLoader(oldImageLoader);
+}
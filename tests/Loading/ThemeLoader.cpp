@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Loading/BinaryThemeLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <fstream>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -110,6 +113,80 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
     }
 
+    SECTION("load properties with nested sections")
+    {
+        auto properties = loader->loadProperties("resources/ThemeNested.txt", "ListBox1");
+        REQUIRE(properties.size() == 2);
+        REQUIRE(properties["backgroundcolor"].getString() == "White");
+        REQUIRE(properties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(properties["scrollbar"].getRenderer()->findProperty("thumbcolor")->getString() == "Green");
+        REQUIRE(properties["scrollbar"].getRenderer()->findProperty("trackcolor")->getString() == "Red");
+
+        properties = loader->loadProperties("resources/ThemeNested.txt", "ComboBox4");
+        REQUIRE(properties.size() == 1);
+        auto listBox = properties["listbox"].getRenderer();
+        REQUIRE(listBox->findProperty("backgroundcolor")->getString() == "Magenta");
+        REQUIRE(listBox->findProperty("scrollbar")->getRenderer()->findProperty("thumbcolor")->getString() == "Green");
+
+        properties = loader->loadProperties("resources/ThemeNested.txt", "ListBox3");
+        REQUIRE(properties["scrollbar"].getRenderer()->findProperty("trackcolor")->getString() == "Yellow");
+
+        // Sections that refer to the same section share its data, but changing the data of one doesn't affect the others
+        auto scrollbar1 = loader->loadProperties("resources/ThemeNested.txt", "ListBox1")["scrollbar"].getRenderer();
+        auto scrollbar2 = loader->loadProperties("resources/ThemeNested.txt", "ListBox1")["scrollbar"].getRenderer();
+        REQUIRE(scrollbar1 != scrollbar2);
+        REQUIRE(scrollbar1->base != nullptr);
+        REQUIRE(scrollbar1->base == scrollbar2->base);
+        REQUIRE(scrollbar1->base == loader->loadProperties("resources/ThemeNested.txt", "ComboBox1")["listbox"].getRenderer()
+                                          ->findProperty("scrollbar")->getRenderer()->base);
+
+        scrollbar1->propertyValuePairs["thumbcolor"] = tgui::ObjectConverter{sf::String{"Black"}};
+        REQUIRE(scrollbar1->findProperty("thumbcolor")->getString() == "Black");
+        REQUIRE(scrollbar2->findProperty("thumbcolor")->getString() == "Green");
+
+        // Renderers that are nested two levels deep also get their own override
+        auto comboBoxListBox1 = loader->loadProperties("resources/ThemeNested.txt", "ComboBox1")["listbox"].getRenderer();
+        auto comboBoxListBox2 = loader->loadProperties("resources/ThemeNested.txt", "ComboBox1")["listbox"].getRenderer();
+        auto nestedScrollbar1 = comboBoxListBox1->propertyValuePairs["scrollbar"].getRenderer();
+        auto nestedScrollbar2 = comboBoxListBox2->propertyValuePairs["scrollbar"].getRenderer();
+        REQUIRE(nestedScrollbar1 != nestedScrollbar2);
+        REQUIRE(nestedScrollbar1->base == nestedScrollbar2->base);
+        REQUIRE(nestedScrollbar1->base == scrollbar1->base);
+
+        nestedScrollbar1->propertyValuePairs["trackcolor"] = tgui::ObjectConverter{sf::String{"Black"}};
+        REQUIRE(nestedScrollbar1->findProperty("trackcolor")->getString() == "Black");
+        REQUIRE(nestedScrollbar2->findProperty("trackcolor")->getString() == "Red");
+        REQUIRE(scrollbar2->findProperty("trackcolor")->getString() == "Red");
+
+        REQUIRE(loader->loadProperties("", "ListBox1").empty());
+        REQUIRE_THROWS_AS(loader->loadProperties("resources/ThemeNested.txt", "NonexistentClassName"), tgui::Exception);
+    }
+
+    SECTION("load theme with invalid references")
+    {
+        std::ofstream file{"ThemeInvalidReferences.txt"};
+        file << "Button {\n"
+                "    TextColor = Red;\n"
+                "}\n"
+                "ListBox {\n"
+                "    Scrollbar = &Scrollbar;\n"
+                "}\n"
+                "Scrollbar {\n"
+                "    Arrow = &ListBox;\n"
+                "}\n";
+        file.close();
+
+        REQUIRE_THROWS_AS(loader->load("ThemeInvalidReferences.txt", "Button"), tgui::Exception);
+
+        file.open("ThemeInvalidReferences.txt");
+        file << "ListBox {\n"
+                "    Scrollbar = &Nonexistent;\n"
+                "}\n";
+        file.close();
+
+        REQUIRE_THROWS_AS(loader->loadProperties("ThemeInvalidReferences.txt", "ListBox"), tgui::Exception);
+    }
+
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
@@ -190,3 +267,95 @@ TEST_CASE("[ThemeLoader]")
         }
     }
 }
+
+TEST_CASE("[BinaryThemeLoader]")
+{
+    tgui::BinaryThemeLoader::flushCache();
+
+    auto loader = std::make_shared<tgui::BinaryThemeLoader>();
+
+    SECTION("nested sections")
+    {
+        REQUIRE_NOTHROW(tgui::BinaryThemeLoader::compile("resources/ThemeNested.txt", "ThemeNested.tgtheme"));
+
+        REQUIRE(loader->canLoad("ThemeNested.tgtheme", "ListBox1"));
+        REQUIRE(loader->canLoad("ThemeNested.tgtheme", "scrollbarsection"));
+        REQUIRE(!loader->canLoad("ThemeNested.tgtheme", "NonexistentClassName"));
+        REQUIRE_THROWS_AS(loader->loadProperties("ThemeNested.tgtheme", "NonexistentClassName"), tgui::Exception);
+
+        auto properties = loader->loadProperties("ThemeNested.tgtheme", "ListBox1");
+        REQUIRE(properties.size() == 2);
+        REQUIRE(properties["backgroundcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(properties["backgroundcolor"].getColor() == sf::Color::White);
+        REQUIRE(properties["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs.size() == 2);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(properties["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        properties = loader->loadProperties("ThemeNested.tgtheme", "ComboBox4");
+        REQUIRE(properties.size() == 1);
+        auto listBox = properties["listbox"].getRenderer();
+        REQUIRE(listBox->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBox->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+
+        // The values can still be loaded as strings
+        REQUIRE(loader->load("ThemeNested.tgtheme", "ListBox3").size() == 1);
+    }
+
+    SECTION("values")
+    {
+        std::ofstream file{"ThemeBinaryValues.txt"};
+        file << "Button {\n"
+                "    TextColor = rgba(10, 20, 30, 40);\n"
+                "    BorderColor = NotAColor;\n"
+                "    Borders = (1, 2, 3, 4);\n"
+                "    Padding = (10%, 5);\n"
+                "    Opacity = 0.5;\n"
+                "    TextStyle = Bold | Italic;\n"
+                "    TransparentTexture = true;\n"
+                "    Font = \"DejaVuSans.ttf\";\n"
+                "    CustomProperty = \"Some text\";\n"
+                "}\n";
+        file.close();
+
+        tgui::BinaryThemeLoader::compile("ThemeBinaryValues.txt", "ThemeBinaryValues.tgtheme");
+
+        auto properties = loader->loadProperties("ThemeBinaryValues.tgtheme", "Button");
+        REQUIRE(properties.size() == 9);
+        REQUIRE(properties["textcolor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(properties["textcolor"].getColor() == sf::Color(10, 20, 30, 40));
+        REQUIRE(properties["bordercolor"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(properties["borders"].getType() == tgui::ObjectConverter::Type::Outline);
+        REQUIRE(properties["borders"].getOutline() == tgui::Outline(1, 2, 3, 4));
+        REQUIRE(properties["padding"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(properties["opacity"].getType() == tgui::ObjectConverter::Type::Number);
+        REQUIRE(properties["opacity"].getNumber() == 0.5f);
+        REQUIRE(properties["textstyle"].getType() == tgui::ObjectConverter::Type::TextStyle);
+        REQUIRE(properties["textstyle"].getTextStyle() == (sf::Text::Bold | sf::Text::Italic));
+        REQUIRE(properties["transparenttexture"].getType() == tgui::ObjectConverter::Type::Bool);
+        REQUIRE(properties["transparenttexture"].getBool());
+        REQUIRE(properties["font"].getString() == "\"DejaVuSans.ttf\"");
+        REQUIRE(properties["customproperty"].getString() == "\"Some text\"");
+
+        // Themes use the loader to create their renderers
+        tgui::Theme::setThemeLoader(loader);
+        tgui::Theme theme{"ThemeBinaryValues.tgtheme"};
+        REQUIRE(theme.getRenderer("Button")->propertyValuePairs["textcolor"].getColor() == sf::Color(10, 20, 30, 40));
+        tgui::Theme::setThemeLoader(std::make_shared<tgui::DefaultThemeLoader>());
+    }
+
+    SECTION("text theme")
+    {
+        REQUIRE(loader->load("resources/ThemeNested.txt", "ListBox1").size() == 2);
+        REQUIRE(loader->loadProperties("resources/ThemeNested.txt", "ListBox1")["backgroundcolor"].getType() == tgui::ObjectConverter::Type::String);
+    }
+
+    SECTION("corrupt file")
+    {
+        std::ofstream file{"ThemeBinaryCorrupt.tgtheme", std::ios::binary};
+        file.write("TGUITHM\x1A\x01\0\0\0\xFF\xFF", 14);
+        file.close();
+
+        REQUIRE_THROWS_AS(loader->preload("ThemeBinaryCorrupt.tgtheme"), tgui::Exception);
+    }
+}
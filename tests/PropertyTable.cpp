@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/PropertyTable.hpp>
+#include <TGUI/Renderers/ButtonRenderer.hpp>
+
+TEST_CASE("[PropertyTable]")
+{
+    SECTION("Interning") {
+        const auto id = tgui::priv::internPropertyName("textcolor");
+        REQUIRE(tgui::priv::internPropertyName("textcolor") == id);
+        REQUIRE(tgui::priv::internPropertyName("TextColor") != id);
+        REQUIRE(tgui::priv::getPropertyName(id) == "textcolor");
+    }
+
+    SECTION("Predefined ids") {
+        REQUIRE(tgui::priv::internPropertyName("textcolor") == tgui::Property::TextColor);
+        REQUIRE(tgui::priv::internPropertyName("titlebarheight") == tgui::Property::TitleBarHeight);
+        REQUIRE(tgui::priv::internPropertyName("some custom property") >= tgui::Property::BuiltinPropertyCount);
+
+        // The ids are in the same order as the names, widgets are notified about renderer changes in this order
+        for (tgui::PropertyId id = 1; id < tgui::Property::BuiltinPropertyCount; ++id)
+            REQUIRE(tgui::priv::getPropertyName(id - 1) < tgui::priv::getPropertyName(id));
+    }
+
+    SECTION("Access by name and id") {
+        tgui::PropertyTable table;
+        REQUIRE(table.empty());
+
+        const auto id = tgui::priv::internPropertyName("opacity");
+        REQUIRE(table.get(id) == nullptr);
+
+        table["opacity"] = {0.5f};
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.get(id) != nullptr);
+        REQUIRE(table.get(id)->getNumber() == 0.5f);
+
+        table[id] = {0.25f};
+        REQUIRE(table.size() == 1);
+        REQUIRE(table.find("opacity")->second.getNumber() == 0.25f);
+
+        table[tgui::priv::internPropertyName("font")] = {"resources/DejaVuSans.ttf"};
+        REQUIRE(table.count("font") == 1);
+
+        // Iteration is sorted by name
+        REQUIRE(table.begin()->first == "font");
+
+        REQUIRE(table.erase("opacity") == 1);
+        REQUIRE(table.erase("opacity") == 0);
+        REQUIRE(table.get(id) == nullptr);
+        REQUIRE(table.size() == 1);
+
+        table.clear();
+        REQUIRE(table.empty());
+        REQUIRE(table.get(tgui::priv::internPropertyName("font")) == nullptr);
+    }
+
+    SECTION("Copy") {
+        tgui::PropertyTable table{{{"bordercolor", {sf::Color::Red}}, {"opacity", {0.5f}}}};
+        const auto id = tgui::priv::internPropertyName("bordercolor");
+        REQUIRE(table.get(id)->getColor() == sf::Color::Red);
+
+        tgui::PropertyTable copy{table};
+        copy[id] = {sf::Color::Green};
+        REQUIRE(table.get(id)->getColor() == sf::Color::Red);
+        REQUIRE(copy.get(id)->getColor() == sf::Color::Green);
+
+        table = copy;
+        REQUIRE(table.get(id)->getColor() == sf::Color::Green);
+
+        table = tgui::PropertyTable::Map{};
+        REQUIRE(table.get(id) == nullptr);
+    }
+
+    SECTION("Renderer") {
+        tgui::ButtonRenderer renderer;
+        renderer.setBorderColor(sf::Color::Blue);
+        REQUIRE(renderer.getBorderColor() == sf::Color::Blue);
+
+        // Properties set by name are found by the getters and the other way around
+        renderer.setProperty("TextColor", {sf::Color::Yellow});
+        REQUIRE(renderer.getTextColor() == sf::Color::Yellow);
+        REQUIRE(renderer.getProperty("bordercolor").getColor() == sf::Color::Blue);
+
+        renderer.getData()->propertyValuePairs["textcolorhover"] = {sf::Color::Cyan};
+        REQUIRE(renderer.getTextColorHover() == sf::Color::Cyan);
+
+        renderer.getData()->propertyValuePairs.erase("bordercolor");
+        REQUIRE(renderer.getBorderColor() == sf::Color::Black);
+    }
+}
@@ -0,0 +1,283 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/RenderCommandList.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/to_string.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace
+{
+    std::size_t countCommands(const tgui::RenderCommandList& commands, tgui::RenderCommand::Type type)
+    {
+        return static_cast<std::size_t>(std::count_if(commands.getCommands().begin(), commands.getCommands().end(),
+                                                      [type](const tgui::RenderCommand& command){ return command.type == type; }));
+    }
+
+    void requireIdenticalCommands(const tgui::RenderCommandList& left, const tgui::RenderCommandList& right)
+    {
+        REQUIRE(left.getCommands().size() == right.getCommands().size());
+        for (std::size_t i = 0; i < left.getCommands().size(); ++i)
+        {
+            const tgui::RenderCommand& leftCommand = left.getCommands()[i];
+            const tgui::RenderCommand& rightCommand = right.getCommands()[i];
+            REQUIRE(leftCommand.type == rightCommand.type);
+            REQUIRE(leftCommand.primitiveType == rightCommand.primitiveType);
+            REQUIRE(leftCommand.first == rightCommand.first);
+            REQUIRE(leftCommand.count == rightCommand.count);
+            REQUIRE(leftCommand.clipRect.getPosition() == rightCommand.clipRect.getPosition());
+            REQUIRE(leftCommand.clipRect.getSize() == rightCommand.clipRect.getSize());
+            REQUIRE(leftCommand.states.texture == rightCommand.states.texture);
+            REQUIRE(std::equal(leftCommand.states.transform.getMatrix(), leftCommand.states.transform.getMatrix() + 16,
+                               rightCommand.states.transform.getMatrix()));
+        }
+
+        REQUIRE(left.getVertices().size() == right.getVertices().size());
+        for (std::size_t i = 0; i < left.getVertices().size(); ++i)
+        {
+            REQUIRE(left.getVertices()[i].position == right.getVertices()[i].position);
+            REQUIRE(left.getVertices()[i].color == right.getVertices()[i].color);
+            REQUIRE(left.getVertices()[i].texCoords == right.getVertices()[i].texCoords);
+        }
+
+        REQUIRE(left.getTextCount() == right.getTextCount());
+        for (std::size_t i = 0; i < left.getTextCount(); ++i)
+            REQUIRE(left.getText(i).getString() == right.getText(i).getString());
+    }
+}
+
+TEST_CASE("[RenderCommandList]")
+{
+    tgui::RenderCommandList commands;
+
+    sf::RectangleShape rect{{100, 50}};
+    rect.setPosition({10, 20});
+    rect.setFillColor(sf::Color::Red);
+
+    SECTION("Shapes")
+    {
+        commands.addShape(rect, sf::RenderStates::Default);
+        REQUIRE(commands.getDrawCallCount() == 1);
+        REQUIRE(commands.getCommands()[0].type == tgui::RenderCommand::Type::Vertices);
+        REQUIRE(commands.getCommands()[0].primitiveType == sf::PrimitiveType::TriangleFan);
+        REQUIRE(commands.getCommands()[0].count == 6);
+        REQUIRE(commands.getVertices()[0].position == sf::Vector2f(50, 25));
+        REQUIRE(commands.getVertices()[0].color == sf::Color::Red);
+        REQUIRE(commands.getDrawnArea() == Approx(5000));
+
+        // The outline is a separate draw call
+        commands.clear();
+        rect.setOutlineThickness(2);
+        commands.addShape(rect, sf::RenderStates::Default);
+        REQUIRE(commands.getDrawCallCount() == 2);
+        REQUIRE(commands.getCommands()[1].primitiveType == sf::PrimitiveType::TriangleStrip);
+        REQUIRE(commands.getCommands()[1].count == 10);
+        REQUIRE(commands.getDrawnArea() == Approx(104 * 54));
+    }
+
+    SECTION("Clipping")
+    {
+        sf::RenderStates states;
+        states.transform.translate(10, 20);
+
+        commands.pushClip(states, {0, 0}, {50, 100});
+        commands.addShape(rect, sf::RenderStates::Default);
+        commands.pushClip(sf::RenderStates::Default, {0, 0}, {40, 40});
+        commands.addShape(rect, sf::RenderStates::Default);
+        commands.popClip();
+        commands.popClip();
+        commands.addShape(rect, sf::RenderStates::Default);
+
+        REQUIRE(commands.getDrawCallCount() == 3);
+        REQUIRE(commands.getDrawnArea() == Approx(50 * 50 + 30 * 20 + 100 * 50));
+    }
+
+    SECTION("Clipping objects")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        {
+            const tgui::priv::RenderCommandRecorder recorder{commands};
+            const tgui::Clipping clipping{target, {}, {0, 0}, {20, 20}};
+            REQUIRE(countCommands(commands, tgui::RenderCommand::Type::PushClip) == 1);
+            REQUIRE(countCommands(commands, tgui::RenderCommand::Type::PopClip) == 0);
+        }
+
+        REQUIRE(countCommands(commands, tgui::RenderCommand::Type::PopClip) == 1);
+
+        // The view of the target isn't changed while recording
+        REQUIRE(target.getView().getViewport() == sf::FloatRect(0, 0, 1, 1));
+    }
+
+    SECTION("Append")
+    {
+        commands.addShape(rect, sf::RenderStates::Default);
+
+        tgui::RenderCommandList otherCommands;
+        rect.setFillColor(sf::Color::Blue);
+        otherCommands.addShape(rect, sf::RenderStates::Default);
+
+        commands.append(otherCommands);
+        REQUIRE(commands.getCommands().size() == 2);
+        REQUIRE(commands.getCommands()[1].first == 6);
+        REQUIRE(commands.getVertices()[commands.getCommands()[1].first].color == sf::Color::Blue);
+    }
+
+    SECTION("Recording a gui without target")
+    {
+        tgui::Gui gui;
+        gui.setView(sf::View{sf::FloatRect{0, 0, 400, 300}});
+
+        auto panel = tgui::Panel::create({200, 100});
+        panel->add(tgui::Label::create("Hello"));
+        gui.add(panel);
+
+        auto listBox = tgui::ListBox::create();
+        listBox->setPosition({200, 0});
+        listBox->addItem("Item");
+        gui.add(listBox);
+
+        gui.draw(commands);
+        REQUIRE(commands.getDrawCallCount() > 0);
+        REQUIRE(countCommands(commands, tgui::RenderCommand::Type::PushClip) > 0);
+        REQUIRE(countCommands(commands, tgui::RenderCommand::Type::PushClip) == countCommands(commands, tgui::RenderCommand::Type::PopClip));
+        REQUIRE(commands.getDrawnArea() >= 200 * 100);
+
+        REQUIRE(countCommands(commands, tgui::RenderCommand::Type::Text) == commands.getTextCount());
+        std::size_t helloTexts = 0;
+        for (std::size_t i = 0; i < commands.getTextCount(); ++i)
+        {
+            if (commands.getText(i).getString() == "Hello")
+                helloTexts++;
+        }
+        REQUIRE(helloTexts == 1);
+
+        // Recording again gives the same commands
+        const std::size_t commandCount = commands.getCommands().size();
+        gui.draw(commands);
+        REQUIRE(commands.getCommands().size() == commandCount);
+
+        // The recorded list can be drawn on a render target
+        sf::RenderTexture target;
+        target.create(400, 300);
+        target.setView(gui.getView());
+        target.draw(commands);
+    }
+
+    SECTION("Recording in parallel")
+    {
+        tgui::Gui gui;
+        gui.setView(sf::View{sf::FloatRect{0, 0, 400, 300}});
+
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            auto panel = tgui::Panel::create({100, 75});
+            panel->setPosition({(i % 4) * 100.f, (i / 4) * 75.f});
+            panel->add(tgui::Label::create("Panel " + tgui::to_string(i)));
+
+            auto listBox = tgui::ListBox::create();
+            listBox->setPosition({0, 25});
+            listBox->setSize({100, 50});
+            for (unsigned int j = 0; j < 5; ++j)
+                listBox->addItem("Item " + tgui::to_string(j));
+            panel->add(listBox);
+
+            panel->setVisible(i != 5);
+            gui.add(panel);
+        }
+
+        tgui::RenderCommandList serialCommands;
+        gui.draw(serialCommands);
+
+        REQUIRE(!gui.isParallelDrawingEnabled());
+        gui.setParallelDrawingEnabled(true, 3);
+        REQUIRE(gui.isParallelDrawingEnabled());
+
+        // The output is the same as when the widgets are recorded on a single thread, every time
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            gui.draw(commands);
+            requireIdenticalCommands(commands, serialCommands);
+        }
+
+        // Fonts are only locked while the widgets are being recorded
+        REQUIRE(!tgui::priv::ParallelRecordingScope::isActive());
+
+        // Widgets are still recorded on one thread while profiling
+        gui.setProfilingEnabled(true);
+        gui.draw(commands);
+        requireIdenticalCommands(commands, serialCommands);
+        gui.setProfilingEnabled(false);
+
+        gui.setParallelDrawingEnabled(false);
+        REQUIRE(!gui.isParallelDrawingEnabled());
+        gui.draw(commands);
+        requireIdenticalCommands(commands, serialCommands);
+    }
+
+    SECTION("Recording text boxes in parallel")
+    {
+        tgui::Gui gui;
+        gui.setView(sf::View{sf::FloatRect{0, 0, 400, 300}});
+
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            auto panel = tgui::Panel::create({200, 300});
+            panel->setPosition({i * 200.f, 0});
+
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                auto textBox = tgui::TextBox::create();
+                textBox->setPosition({0, j * 100.f});
+                textBox->setSize({200, 100});
+                textBox->setTextSize(12 + 2 * j);
+                textBox->setText("Text box " + tgui::to_string(i) + "-" + tgui::to_string(j) + "\nSecond line\nThird line");
+                panel->add(textBox);
+            }
+
+            gui.add(panel);
+        }
+
+        gui.getContainer()->getWidgets()[1]->cast<tgui::Panel>()->getWidgets()[1]->setFocused(true);
+
+        tgui::RenderCommandList serialCommands;
+        gui.draw(serialCommands);
+        REQUIRE(serialCommands.getTextCount() > 0);
+
+        gui.setParallelDrawingEnabled(true, 3);
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            gui.draw(commands);
+            requireIdenticalCommands(commands, serialCommands);
+        }
+    }
+}
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Slider.hpp>
 
 TEST_CASE("[Signal]")
 {
@@ -141,4 +142,115 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("emit")
+    {
+        unsigned int count = 0;
+        tgui::Slider::Ptr slider = tgui::Slider::create();
+        slider->connect("ValueChanged", [&](float value){ REQUIRE(value == 5); count++; });
+        slider->connect("ValueChanged", [&](tgui::Widget::Ptr w, const std::string& signalName, float value){
+                REQUIRE(w == slider);
+                REQUIRE(signalName == "ValueChanged");
+                REQUIRE(value == 5);
+                count++;
+            });
+        REQUIRE(slider->onValueChange.emit(slider.get(), 5));
+        REQUIRE(count == 2);
+
+        tgui::Slider::Ptr slider2 = tgui::Slider::create();
+        REQUIRE(!slider2->onValueChange.emit(slider2.get(), 5));
+    }
+
+    SECTION("Nested emit")
+    {
+        std::vector<float> values;
+        tgui::Slider::Ptr slider = tgui::Slider::create();
+        slider->setMaximum(10);
+        slider->connect("ValueChanged", [&](float value){
+                values.push_back(value);
+                if (value < 3)
+                    slider->setValue(value + 1);
+                values.push_back(value);
+            });
+
+        slider->setValue(1);
+        REQUIRE(values == std::vector<float>{1, 2, 3, 3, 2, 1});
+    }
+
+    SECTION("Disconnect while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int id1 = 0;
+        id1 = widget->connect("PositionChanged", [&](){ count1++; widget->disconnect(id1); });
+        widget->connect("PositionChanged", [&](){ count2++; });
+        widget->setPosition(10, 10);
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 2);
+
+        count2 = 0;
+        widget->connect("SizeChanged", [&](){ widget->disconnectAll("SizeChanged"); });
+        widget->connect("SizeChanged", [&](){ count2++; });
+        widget->setSize(100, 100);
+        widget->setSize(200, 200);
+        REQUIRE(count2 == 0);
+    }
+
+    SECTION("Destroying widget while emitting")
+    {
+        unsigned int count = 0;
+        auto widget2 = tgui::ClickableWidget::create();
+        widget2->connect("PositionChanged", [&](){ count++; widget2 = nullptr; });
+        widget2->connect("PositionChanged", [&](){ count++; });
+        tgui::Widget* widgetPtr = widget2.get();
+        widget2->onPositionChange.emit(widgetPtr, {10, 10});
+        REQUIRE(widget2 == nullptr);
+        REQUIRE(count == 1);
+    }
+
+    SECTION("Exception thrown by handler")
+    {
+        unsigned int count = 0;
+        bool throwException = true;
+        tgui::Signal signal{"Test"};
+        signal.connect([&](){ count++; if (throwException) throw std::runtime_error{"Handler failed"}; });
+        const unsigned int id = signal.connect([&](){ count++; });
+        REQUIRE_THROWS_AS(signal.emit(widget.get()), std::runtime_error);
+        REQUIRE(count == 1);
+
+        // The signal is no longer considered to be emitting, so disconnecting erases the handler immediately
+        REQUIRE(signal.disconnect(id));
+        REQUIRE(!signal.disconnect(id));
+
+        throwException = false;
+        REQUIRE(signal.emit(widget.get()));
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Move assignment while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        tgui::Signal signal{"Test"};
+        signal.connect([&](){
+                count1++;
+                tgui::Signal other{"Other"};
+                other.connect([&](){ count3++; });
+                signal = std::move(other);
+            });
+        signal.connect([&](){ count2++; });
+        signal.connect([&](){ count2++; });
+
+        REQUIRE(signal.emit(widget.get()));
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 0);
+
+        REQUIRE(signal.emit(widget.get()));
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 1);
+    }
 }
@@ -0,0 +1,294 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <algorithm>
+
+namespace
+{
+    void requirePixels(const tgui::SoftwareRenderTarget& target, sf::IntRect rect, const sf::Color& color)
+    {
+        for (int y = rect.top; y < rect.top + rect.height; ++y)
+        {
+            for (int x = rect.left; x < rect.left + rect.width; ++x)
+                REQUIRE(target.getPixel(x, y) == color);
+        }
+    }
+
+    void testSoftwareDraw(tgui::Gui& gui, unsigned int width, unsigned int height, const std::string& filename)
+    {
+        tgui::SoftwareRenderTarget target{width, height};
+        target.clear({25, 130, 10});
+        target.draw(gui);
+        target.saveToFile("Software_" + filename);
+    #ifndef TGUI_SKIP_DRAW_TESTS
+        compareImageFiles("Software_" + filename, "expected/" + filename);
+    #endif
+    }
+}
+
+TEST_CASE("[SoftwareRenderTarget]")
+{
+    tgui::SoftwareRenderTarget target{40, 30};
+    tgui::RenderCommandList commands;
+
+    SECTION("Clear")
+    {
+        REQUIRE(target.getSize() == sf::Vector2u(40, 30));
+        REQUIRE(target.getPixel(0, 0) == sf::Color(0, 0, 0, 0));
+        REQUIRE(target.getView().getSize() == sf::Vector2f(40, 30));
+
+        target.clear(sf::Color::Blue);
+        requirePixels(target, {0, 0, 40, 30}, sf::Color::Blue);
+        REQUIRE(target.getPixelsPtr()[2] == 255);
+        REQUIRE(target.copyToImage().getSize() == sf::Vector2u(40, 30));
+    }
+
+    SECTION("Solid quads")
+    {
+        target.clear(sf::Color::Blue);
+
+        sf::RectangleShape rect{{20, 10}};
+        rect.setPosition({5, 8});
+        rect.setFillColor(sf::Color::Red);
+        commands.addShape(rect, {});
+        target.draw(commands);
+
+        requirePixels(target, {5, 8, 20, 10}, sf::Color::Red);
+        requirePixels(target, {4, 8, 1, 10}, sf::Color::Blue);
+        requirePixels(target, {25, 8, 1, 10}, sf::Color::Blue);
+        requirePixels(target, {5, 7, 20, 1}, sf::Color::Blue);
+        requirePixels(target, {5, 18, 20, 1}, sf::Color::Blue);
+    }
+
+    SECTION("Alpha blending")
+    {
+        target.clear(sf::Color::Blue);
+
+        // The width isn't a multiple of 4, so that pixels are blended both in groups and one by one
+        sf::RectangleShape rect{{7, 3}};
+        rect.setPosition({1, 1});
+        rect.setFillColor({255, 0, 0, 128});
+        commands.addShape(rect, {});
+        target.draw(commands);
+
+        // The diagonal that is shared by both triangles of the rectangle isn't blended twice
+        requirePixels(target, {1, 1, 7, 3}, {128, 0, 127, 255});
+        requirePixels(target, {8, 1, 1, 3}, sf::Color::Blue);
+
+        // Colors are interpolated between the vertices
+        commands.clear();
+        target.clear(sf::Color::Black);
+        const sf::Vertex vertices[] = {{{0, 0}, sf::Color::Black}, {{0, 30}, sf::Color::Black},
+                                       {{40, 0}, sf::Color::White}, {{40, 30}, sf::Color::White}};
+        commands.addVertices(vertices, 4, sf::PrimitiveType::TriangleStrip, {});
+        target.draw(commands);
+        REQUIRE(target.getPixel(0, 15).r < 10);
+        REQUIRE(target.getPixel(20, 15).r > 120);
+        REQUIRE(target.getPixel(20, 15).r < 135);
+        REQUIRE(target.getPixel(39, 15).r > 245);
+    }
+
+    SECTION("Textures")
+    {
+        sf::Image image;
+        image.create(2, 2, sf::Color::Red);
+        image.setPixel(1, 0, sf::Color::Green);
+        image.setPixel(0, 1, sf::Color::Blue);
+        image.setPixel(1, 1, sf::Color::Transparent);
+
+        sf::Texture texture;
+        texture.loadFromImage(image);
+        texture.setSmooth(false);
+
+        const sf::Vertex vertices[] = {{{10, 10}, sf::Color::White, {0, 0}}, {{10, 30}, sf::Color::White, {0, 2}},
+                                       {{30, 10}, sf::Color::White, {2, 0}}, {{30, 30}, sf::Color::White, {2, 2}}};
+        commands.addVertices(vertices, 4, sf::PrimitiveType::TriangleStrip, {&texture});
+
+        target.clear(sf::Color::Yellow);
+        target.draw(commands);
+        requirePixels(target, {10, 10, 10, 10}, sf::Color::Red);
+        requirePixels(target, {20, 10, 10, 10}, sf::Color::Green);
+        requirePixels(target, {10, 20, 10, 10}, sf::Color::Blue);
+        requirePixels(target, {20, 20, 10, 10}, sf::Color::Yellow);
+    }
+
+    SECTION("Clipping")
+    {
+        target.clear(sf::Color::Blue);
+
+        sf::RectangleShape rect{{40, 30}};
+        rect.setFillColor(sf::Color::Red);
+
+        sf::RenderStates states;
+        states.transform.translate({5, 5});
+        commands.pushClip(states, {5, 5}, {20, 10});
+        commands.pushClip({}, {0, 0}, {20, 40});
+        commands.addShape(rect, {});
+        commands.popClip();
+        commands.popClip();
+        target.draw(commands);
+
+        requirePixels(target, {10, 10, 10, 10}, sf::Color::Red);
+        requirePixels(target, {20, 10, 10, 10}, sf::Color::Blue);
+        requirePixels(target, {0, 0, 40, 10}, sf::Color::Blue);
+        requirePixels(target, {0, 20, 40, 10}, sf::Color::Blue);
+
+        // Nothing is clipped anymore after the clipping areas were removed
+        commands.addShape(rect, {});
+        target.draw(commands);
+        requirePixels(target, {0, 0, 40, 30}, sf::Color::Red);
+    }
+
+    SECTION("View")
+    {
+        target.clear(sf::Color::Blue);
+        target.setView(sf::View{sf::FloatRect{0, 0, 20, 15}});
+
+        sf::RectangleShape rect{{5, 5}};
+        rect.setPosition({5, 5});
+        rect.setFillColor(sf::Color::Red);
+        commands.addShape(rect, {});
+        target.draw(commands);
+
+        requirePixels(target, {10, 10, 10, 10}, sf::Color::Red);
+        requirePixels(target, {0, 0, 40, 10}, sf::Color::Blue);
+        requirePixels(target, {0, 20, 40, 10}, sf::Color::Blue);
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        gui.setView(sf::View{sf::FloatRect{0, 0, 40, 30}});
+
+        auto panel = tgui::Panel::create({20, 10});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+        gui.add(panel);
+
+        target.clear(sf::Color::Blue);
+        target.draw(gui);
+        requirePixels(target, {10, 10, 20, 10}, sf::Color::Red);
+        requirePixels(target, {0, 0, 40, 10}, sf::Color::Blue);
+        requirePixels(target, {0, 20, 40, 10}, sf::Color::Blue);
+    }
+}
+
+TEST_CASE("[SoftwareRenderTarget] Expected images")
+{
+    // The images that were drawn with OpenGL for the widget tests are used to check the result of the software rasterizer
+    tgui::Gui gui;
+
+    SECTION("Picture")
+    {
+        gui.setView(sf::View{sf::FloatRect{0, 0, 60, 40}});
+
+        auto picture = tgui::Picture::create();
+        picture->getRenderer()->setTexture("resources/image.png");
+        picture->setPosition(10, 5);
+        picture->setSize(40, 30);
+        gui.add(picture);
+
+        testSoftwareDraw(gui, 60, 40, "Picture.png");
+    }
+
+    SECTION("Panel")
+    {
+        gui.setView(sf::View{sf::FloatRect{0, 0, 200, 150}});
+
+        auto panel = tgui::Panel::create({180, 140});
+        panel->setPosition({10, 5});
+        panel->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        panel->getRenderer()->setBorderColor(sf::Color::Red);
+        panel->getRenderer()->setBorders({1, 2, 3, 4});
+        panel->getRenderer()->setPadding({5, 6, 7, 8});
+        panel->getRenderer()->setOpacity(0.7f);
+        gui.add(panel);
+
+        auto picture = tgui::Picture::create("resources/image.png");
+        picture->setSize({150, 100});
+        picture->setPosition({50, 55});
+        panel->add(picture);
+
+        testSoftwareDraw(gui, 200, 150, "Panel.png");
+    }
+
+    SECTION("Label")
+    {
+        auto label = tgui::Label::create();
+        label->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        label->getRenderer()->setTextColor(sf::Color::Red);
+        label->setPosition(10, 5);
+        gui.add(label);
+
+        SECTION("Simple")
+        {
+            gui.setView(sf::View{sf::FloatRect{0, 0, 110, 40}});
+            label->setText(L"Test gÊ");
+            label->setTextSize(24);
+            label->getRenderer()->setTextStyle(sf::Text::Style::Italic);
+
+            testSoftwareDraw(gui, 110, 40, "Label_Simple.png");
+        }
+
+        SECTION("Complex")
+        {
+            gui.setView(sf::View{sf::FloatRect{0, 0, 420, 215}});
+            label->setText("Bacon ipsum dolor amet alcatra jerky turkey ball tip jowl beef. Shank landjaeger frankfurter, doner burgdoggen strip steak chicken pancetta jowl. Pork loin leberkas meatloaf ham shoulder cow hamburger pancetta. Rump turducken ribeye salami pork chop sirloin. Leberkas alcatra filet mignon jerky pork belly.");
+            label->setTextSize(18);
+            label->setSize(400, 205);
+            label->getRenderer()->setBackgroundColor(sf::Color::Blue);
+            label->getRenderer()->setBorderColor(sf::Color::Yellow);
+            label->getRenderer()->setBorders({1, 2, 3, 4});
+            label->getRenderer()->setPadding({4, 3, 2, 1});
+            label->getRenderer()->setOpacity(0.7f);
+
+            testSoftwareDraw(gui, 420, 215, "Label_Complex.png");
+        }
+
+        SECTION("Glyphs added after the previous draw")
+        {
+            gui.setView(sf::View{sf::FloatRect{0, 0, 110, 40}});
+            label->setTextSize(20);
+            label->setText("aaa");
+
+            tgui::SoftwareRenderTarget reusedTarget{110, 40};
+            reusedTarget.draw(gui);
+
+            // The copy of the font texture from the first draw doesn't contain these glyphs yet
+            label->setText("xyz");
+            reusedTarget.clear(sf::Color::Transparent);
+            reusedTarget.draw(gui);
+
+            tgui::SoftwareRenderTarget newTarget{110, 40};
+            newTarget.draw(gui);
+            REQUIRE(std::equal(reusedTarget.getPixelsPtr(), reusedTarget.getPixelsPtr() + 110 * 40 * 4, newTarget.getPixelsPtr()));
+        }
+    }
+}
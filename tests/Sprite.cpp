@@ -100,6 +100,31 @@ TEST_CASE("[Sprite]")
         REQUIRE(sprite.getVisibleRect() == sf::FloatRect(10, 10, 30, 30));
     }
 
+    SECTION("Copies share the data until one of them changes")
+    {
+        sprite.setTexture(tgui::Texture{sf::Texture{}});
+        sprite.setSize({80, 60});
+
+        const tgui::Sprite copy = sprite;
+        const tgui::Sprite& constSprite = sprite;
+        REQUIRE(&copy.getTexture() == &constSprite.getTexture());
+
+        // Setting the same values doesn't stop the data from being shared
+        sprite.setSize({80, 60});
+        sprite.setOpacity(1);
+        sprite.setVisibleRect({});
+        REQUIRE(&copy.getTexture() == &constSprite.getTexture());
+
+        sprite.setPosition({10, 20});
+        REQUIRE(&copy.getTexture() == &constSprite.getTexture());
+
+        sprite.setSize({40, 30});
+        REQUIRE(&copy.getTexture() != &constSprite.getTexture());
+        REQUIRE(copy.getSize() == sf::Vector2f(80, 60));
+        REQUIRE(sprite.getSize() == sf::Vector2f(40, 30));
+        REQUIRE(copy.getTexture() == sprite.getTexture());
+    }
+
     SECTION("isTransparentPixel")
     {
         sprite.setPosition({10, 20});
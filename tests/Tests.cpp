@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Panel.hpp>
+#include <fstream>
+#include <sstream>
 
 void mouseCallback(unsigned int& count, sf::Vector2f pos)
 {
@@ -161,3 +163,40 @@ void testWidgetRenderer(tgui::WidgetRenderer* renderer)
         REQUIRE_THROWS_AS(renderer->setProperty("NonexistentProperty", ""), tgui::Exception);
     }
 }
+
+void testSameTreeAsDataIO(const std::function<std::unique_ptr<tgui::DataIO::Node>(const std::string&)>& parse)
+{
+    std::vector<std::string> inputs = {
+        "",
+        "Property = Value;",
+        "Child { Child2 { Property = Value; } }",
+        "Child { Child2 = { Property = Value; }; }",
+        "Child { Child2 { Property = Value; }; };",
+        "Property = [a,b,c,d];",
+        "Property = [];",
+        "{ Property//\n= [\"a\", \"\\\"b\\\"\", \"\\\\c\\\\\"]; }",
+        "name{}",
+        "\"SpecialChars.{}=:;/*#//\\t\\\"\\\\\" { Property\r\n//txt\n = \"\\\\\\\"Value\\\"\\\\\"; }",
+        "A { Value = x  \t y /* comment */ z; Value = \"last\"; Na/**/me = 1; }",
+        "Button.A { Text = Same; } Button.B { Text = Same; } Button.C { Text = Other; }"
+    };
+
+    for (const auto& filename : {"resources/ThemeComments.txt", "resources/ThemeSpecialCases.txt", "resources/ThemeNested.txt"})
+    {
+        std::ifstream file{filename};
+        std::stringstream contents;
+        contents << file.rdbuf();
+        inputs.push_back(contents.str());
+    }
+
+    for (const auto& input : inputs)
+    {
+        std::stringstream inputStream{input};
+        std::stringstream expectedStream;
+        tgui::DataIO::emit(tgui::DataIO::parse(inputStream), expectedStream);
+
+        std::stringstream stream;
+        tgui::DataIO::emit(parse(input), stream);
+        REQUIRE(stream.str() == expectedStream.str());
+    }
+}
@@ -42,7 +42,9 @@
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <functional>
 
 #define TEST_DRAW_INIT(width, height, widget) \
             sf::RenderTexture target; \
@@ -78,6 +80,9 @@ void testClickableWidgetSignals(tgui::ClickableWidget::Ptr widget);
 
 void testWidgetRenderer(tgui::WidgetRenderer* renderer);
 
+// Parses a set of widget and theme files with the given function and checks that the tree is the same as the one from DataIO
+void testSameTreeAsDataIO(const std::function<std::unique_ptr<tgui::DataIO::Node>(const std::string&)>& parse);
+
 template <typename WidgetType>
 void testSavingWidget(std::string name, std::shared_ptr<WidgetType> widget, bool loadFromTheme = true)
 {
@@ -73,6 +73,22 @@ TEST_CASE("[Text]")
         REQUIRE(text.getStyle() == sf::Text::Italic);
     }
 
+    SECTION("Copies share the text until one of them changes")
+    {
+        text.setString("MyString");
+        tgui::Text copy = text;
+        REQUIRE(&copy.getString() == &text.getString());
+
+        copy.setCharacterSize(20);
+        REQUIRE(&copy.getString() != &text.getString());
+        REQUIRE(copy.getString() == "MyString");
+        REQUIRE(text.getCharacterSize() != 20);
+
+        tgui::Text copy2 = text;
+        text.setString("Changed");
+        REQUIRE(copy2.getString() == "MyString");
+    }
+
     SECTION("Size")
     {
         text.setFont("resources/DejaVuSans.ttf");
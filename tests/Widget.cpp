@@ -24,8 +24,10 @@
 
 #include "Tests.hpp"
 #include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
 
 TEST_CASE("[Widget]")
 {
@@ -266,6 +268,68 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getProperty("NonexistentProperty").getString() == "Text");
         }
 
+        SECTION("Deprecated rendererChanged function")
+        {
+            struct CustomButton : public tgui::Button
+            {
+                using Button::rendererChanged;
+
+                void rendererChanged(const std::string& property) override
+                {
+                    if (property == "customcolor")
+                        changedProperties.push_back(property);
+                    else
+                        Button::rendererChanged(property);
+                }
+
+                std::vector<std::string> changedProperties;
+            };
+
+            auto customButton = std::make_shared<CustomButton>();
+            customButton->getRenderer()->setProperty("CustomColor", "red");
+            customButton->getRenderer()->setTextColor("blue");
+            REQUIRE(customButton->changedProperties == std::vector<std::string>{"customcolor"});
+
+            REQUIRE_THROWS_AS(customButton->getRenderer()->setProperty("NonexistentProperty", "Text"), tgui::Exception);
+        }
+
+        SECTION("Batched updates")
+        {
+            std::vector<std::vector<tgui::PropertyId>> notifications;
+            renderer->subscribe(&notifications, [&](const std::vector<tgui::PropertyId>& properties){ notifications.push_back(properties); });
+
+            renderer->setOpacity(0.5f);
+            REQUIRE(notifications.size() == 1);
+            REQUIRE(notifications[0] == std::vector<tgui::PropertyId>{tgui::Property::Opacity});
+
+            notifications.clear();
+            renderer->beginUpdate();
+            renderer->setOpacity(0.8f);
+            renderer->beginUpdate();
+            renderer->setFont("resources/DejaVuSans.ttf");
+            renderer->setOpacity(0.7f);
+            renderer->endUpdate();
+            REQUIRE(notifications.empty());
+            renderer->endUpdate();
+
+            REQUIRE(notifications.size() == 1);
+            REQUIRE(notifications[0] == std::vector<tgui::PropertyId>{tgui::Property::Font, tgui::Property::Opacity});
+            REQUIRE(widget->getRenderer()->getOpacity() == 0.7f);
+
+            // Nothing is reported when no property changed
+            notifications.clear();
+            renderer->beginUpdate();
+            renderer->setOpacity(0.7f);
+            renderer->endUpdate();
+            REQUIRE(notifications.empty());
+
+            // Unknown properties are still reported by the widget when the update ends
+            renderer->unsubscribe(&notifications);
+            renderer->beginUpdate();
+            renderer->setProperty("NonexistentProperty", "Text");
+            REQUIRE_THROWS_AS(renderer->endUpdate(), tgui::Exception);
+        }
+
         SECTION("Clone")
         {
             renderer->setOpacity(0.5f);
@@ -277,6 +341,95 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Overrides")
+        {
+            auto sharedData = tgui::RendererData::create({{"opacity", 0.8f}});
+
+            auto widget1 = tgui::ClickableWidget::create();
+            auto widget2 = tgui::ClickableWidget::create();
+            widget1->setRenderer(sharedData);
+            widget2->setRenderer(sharedData);
+
+            // Only the changed property is stored in the widget
+            widget1->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            REQUIRE(widget1->getRenderer()->getData() != sharedData);
+            REQUIRE(widget1->getRenderer()->getData()->propertyValuePairs.size() == 1);
+            REQUIRE(widget1->getRenderer()->getData()->base == sharedData);
+            REQUIRE(widget1->getRenderer()->getOpacity() == 0.8f);
+            REQUIRE(widget1->getRenderer()->getFont() != nullptr);
+            REQUIRE(widget2->getSharedRenderer()->getFont() == nullptr);
+            REQUIRE(widget1->getRenderer()->getPropertyValuePairs().size() == 2);
+
+            // Changes to the shared renderer still reach the widget, unless it overrides the property
+            std::vector<tgui::PropertyId> changedProperties;
+            widget1->getRenderer()->subscribe(&changedProperties, [&](tgui::PropertyId property){ changedProperties.push_back(property); });
+
+            widget2->getSharedRenderer()->setOpacity(0.6f);
+            REQUIRE(widget1->getRenderer()->getOpacity() == 0.6f);
+            REQUIRE(changedProperties == std::vector<tgui::PropertyId>{tgui::Property::Opacity});
+
+            changedProperties.clear();
+            widget1->getRenderer()->setOpacity(0.4f);
+            widget2->getSharedRenderer()->setOpacity(0.7f);
+            REQUIRE(widget1->getRenderer()->getOpacity() == 0.4f);
+            REQUIRE(widget2->getSharedRenderer()->getOpacity() == 0.7f);
+            REQUIRE(changedProperties == std::vector<tgui::PropertyId>{tgui::Property::Opacity});
+            widget1->getRenderer()->unsubscribe(&changedProperties);
+
+            // A clone contains all properties
+            auto clonedRenderer = widget1->getRenderer()->clone();
+            REQUIRE(clonedRenderer->base == nullptr);
+            REQUIRE(clonedRenderer->propertyValuePairs.size() == 2);
+        }
+
+        SECTION("Overrides of textures and nested renderers")
+        {
+            auto scrollbarData = tgui::RendererData::create({{"trackcolor", tgui::Color::Red}});
+            auto sharedData = tgui::RendererData::create({{"texturebackground", tgui::Texture{}}, {"scrollbar", scrollbarData}});
+
+            auto listBox1 = tgui::ListBox::create();
+            auto listBox2 = tgui::ListBox::create();
+            listBox1->setRenderer(sharedData);
+            listBox2->setRenderer(sharedData);
+
+            // Reading a texture or nested renderer does not copy it into the widget
+            REQUIRE(&listBox1->getRenderer()->getTextureBackground() == &sharedData->propertyValuePairs["texturebackground"].getTexture());
+            REQUIRE(listBox1->getRenderer()->getScrollbar() == scrollbarData);
+            REQUIRE(listBox1->getRenderer()->getData()->propertyValuePairs.size() == 0);
+
+            // Changing the base texture after the override was created still reaches the widget
+            const tgui::Texture texture1{sf::Texture{}};
+            const tgui::Texture texture2{sf::Texture{}};
+            const tgui::Texture texture3{sf::Texture{}};
+            REQUIRE(texture1.getData() != texture2.getData());
+
+            std::vector<tgui::PropertyId> changedProperties;
+            listBox1->getRenderer()->subscribe(&changedProperties, [&](tgui::PropertyId property){ changedProperties.push_back(property); });
+            listBox2->getSharedRenderer()->setTextureBackground(texture1);
+            REQUIRE(changedProperties == std::vector<tgui::PropertyId>{tgui::Property::TextureBackground});
+            REQUIRE(listBox1->getSharedRenderer()->getTextureBackground().getData() == texture1.getData());
+
+            auto newScrollbarData = tgui::RendererData::create({{"trackcolor", tgui::Color::Blue}});
+            listBox2->getSharedRenderer()->setScrollbar(newScrollbarData);
+            REQUIRE(listBox1->getSharedRenderer()->getScrollbar() == newScrollbarData);
+
+            // Only a setter stores the value in the widget
+            listBox1->getRenderer()->setTextureBackground(texture2);
+            listBox2->getSharedRenderer()->setTextureBackground(texture3);
+            REQUIRE(listBox1->getSharedRenderer()->getTextureBackground().getData() == texture2.getData());
+            REQUIRE(listBox2->getSharedRenderer()->getTextureBackground().getData() == texture3.getData());
+            listBox1->getRenderer()->unsubscribe(&changedProperties);
+
+            // A property that nobody set is stored in the base data when it is read
+            auto emptyData = tgui::RendererData::create();
+            auto listBox3 = tgui::ListBox::create();
+            listBox3->setRenderer(emptyData);
+            REQUIRE(listBox3->getRenderer()->getTextureBackground().getData() == nullptr);
+            REQUIRE(listBox3->getRenderer()->getData()->propertyValuePairs.get(tgui::Property::TextureBackground) == nullptr);
+            tgui::ListBoxRenderer(emptyData).setTextureBackground(texture1);
+            REQUIRE(listBox3->getSharedRenderer()->getTextureBackground().getData() == texture1.getData());
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
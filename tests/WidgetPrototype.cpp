@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/WidgetPrototype.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[WidgetPrototype]")
+{
+    auto row = tgui::Panel::create({400, 30});
+    row->getRenderer()->setBackgroundColor(sf::Color::Green);
+    row->add(tgui::Label::create("Name"), "Name");
+    auto button = tgui::Button::create("Remove");
+    button->setPosition({"Name.right + 10", 0});
+    row->add(button, "Remove");
+
+    auto prototype = tgui::WidgetPrototype::create(row);
+
+    SECTION("Instantiate")
+    {
+        auto instance = prototype->instantiate<tgui::Panel>();
+        REQUIRE(instance != nullptr);
+        REQUIRE(instance != row);
+        REQUIRE(instance->getParent() == nullptr);
+        REQUIRE(instance->getSize() == sf::Vector2f(400, 30));
+        REQUIRE(instance->getWidgets().size() == 2);
+        REQUIRE(instance->get<tgui::Label>("Name")->getText() == "Name");
+        REQUIRE(instance->get<tgui::Button>("Remove")->getText() == "Remove");
+        REQUIRE(instance->get("Remove")->getPosition().x == instance->get("Name")->getSize().x + 10);
+
+        // Instances have their own state
+        instance->get<tgui::Label>("Name")->setText("Changed");
+        REQUIRE(prototype->instantiate<tgui::Panel>()->get<tgui::Label>("Name")->getText() == "Name");
+    }
+
+    SECTION("Renderers are shared")
+    {
+        auto instance = prototype->instantiate();
+        REQUIRE(instance->getSharedRenderer()->getData() == prototype->getWidget()->getSharedRenderer()->getData());
+
+        prototype->getWidget()->getSharedRenderer()->setOpacity(0.5f);
+        REQUIRE(instance->getRenderer()->getOpacity() == 0.5f);
+    }
+
+    SECTION("Prototype is independent of original widget")
+    {
+        row->get<tgui::Label>("Name")->setText("Original");
+        row->add(tgui::Label::create(), "Extra");
+        auto instance = prototype->instantiate<tgui::Panel>();
+        REQUIRE(instance->getWidgets().size() == 2);
+        REQUIRE(instance->get<tgui::Label>("Name")->getText() == "Name");
+    }
+
+    SECTION("Instantiate many")
+    {
+        const auto instances = prototype->instantiate(100);
+        REQUIRE(instances.size() == 100);
+        for (const auto& instance : instances)
+            REQUIRE(std::static_pointer_cast<tgui::Panel>(instance)->getWidgets().size() == 2);
+        REQUIRE(instances[0] != instances[1]);
+
+        auto list = tgui::Panel::create();
+        list->reserveWidgets(instances.size());
+        for (const auto& instance : instances)
+            list->add(instance);
+        REQUIRE(list->getWidgets().size() == 100);
+    }
+}